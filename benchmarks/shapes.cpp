@@ -0,0 +1,214 @@
+/*
+** Micro-benchmark for filled shape tessellation.
+** Reports shapes per second for rounded rectangles and ellipses, generated
+** the old way (cosf/sinf per segment into a scratch buffer, then transformed
+** and colored into the batch) and through the engine's own generators in
+** Tessellation.hpp, which read the cached unit circle tables and write
+** straight into the batch.
+*/
+
+#include "common/Matrix.hpp"
+#include "common/math.hpp"
+#include "modules/graphics/Tessellation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int SHAPE_COUNT = 256;
+    constexpr int ITERATIONS  = 400;
+
+    /* what calculateEllipsePoints() gives for a 24 unit radius */
+    constexpr int POINTS = 21;
+
+    struct Shape
+    {
+        float x, y, w, h;
+    };
+
+    /* the batch side of polygon(): colors, then the transform kernel */
+    void submit(const Matrix4& transform, const Vector2* coords, int count, Vertex* stream)
+    {
+        Color32 color(255, 255, 255, 255);
+
+        for (int index = 0; index < count; index++)
+        {
+            stream[index].s     = 0;
+            stream[index].t     = 0;
+            stream[index].color = color;
+        }
+
+        transform.transformXY(stream, coords, count);
+    }
+
+    int referenceRoundedRectangle(const Matrix4& transform, const Shape& shape, float rx, float ry,
+                                  int points, std::vector<Vector2>& scratch, Vertex* stream)
+    {
+        const float x = shape.x, y = shape.y, w = shape.w, h = shape.h;
+
+        points = std::max(points / 4, 1);
+
+        const float halfPi = float(LOVE_M_PI / 2);
+        float shift        = halfPi / ((float)points + 1.0f);
+
+        size_t numCoords = (points + 2) * 4;
+        Vector2* coords  = scratch.data();
+
+        float phi = 0.0f;
+
+        for (int i = 0; i <= points + 2; ++i, phi += shift)
+            coords[i] = Vector2(x + rx * (1 - cosf(phi)), y + ry * (1 - sinf(phi)));
+
+        phi = halfPi;
+
+        for (int i = points + 2; i <= 2 * (points + 2); ++i, phi += shift)
+            coords[i] = Vector2(x + w - rx * (1 + cosf(phi)), y + ry * (1 - sinf(phi)));
+
+        phi = 2 * halfPi;
+
+        for (int i = 2 * (points + 2); i <= 3 * (points + 2); ++i, phi += shift)
+            coords[i] = Vector2(x + w - rx * (1 + cosf(phi)), y + h - ry * (1 + sinf(phi)));
+
+        phi = 3 * halfPi;
+
+        for (int i = 3 * (points + 2); i <= 4 * (points + 2); ++i, phi += shift)
+            coords[i] = Vector2(x + rx * (1 - cosf(phi)), y + h - ry * (1 + sinf(phi)));
+
+        coords[numCoords] = coords[0];
+
+        submit(transform, coords, (int)numCoords, stream);
+        return (int)numCoords;
+    }
+
+    int referenceEllipse(const Matrix4& transform, const Shape& shape, int points,
+                         std::vector<Vector2>& scratch, Vertex* stream)
+    {
+        float shift = float(LOVE_M_PI * 2) / points;
+        float phi   = 0.0f;
+
+        Vector2* coords = scratch.data();
+        coords[0]       = Vector2(shape.x, shape.y);
+
+        for (int index = 0; index < points; ++index, phi += shift)
+            coords[index + 1] = Vector2(shape.x + shape.w * cosf(phi), shape.y + shape.h * sinf(phi));
+
+        coords[points + 1] = coords[1];
+
+        submit(transform, coords, points + 2, stream);
+        return points + 2;
+    }
+
+    /* the engine's generators and batch writer, as GraphicsBase::rectangle()/ellipse() call them */
+    int cachedRoundedRectangle(const Matrix4& transform, const Shape& shape, float rx, float ry,
+                               int points, Vertex* stream)
+    {
+        points = std::max(points / 4, 1);
+
+        tessellation::VertexWriter emit(stream, transform, Color32(255, 255, 255, 255));
+        tessellation::roundedRectangle(shape.x, shape.y, shape.w, shape.h, rx, ry, points, emit);
+
+        return tessellation::getRoundedRectangleCount(points);
+    }
+
+    int cachedEllipse(const Matrix4& transform, const Shape& shape, int points, Vertex* stream)
+    {
+        tessellation::VertexWriter emit(stream, transform, Color32(255, 255, 255, 255));
+
+        emit(shape.x, shape.y);
+        tessellation::ellipse(shape.x, shape.y, shape.w, shape.h, points, emit);
+
+        return points + 2;
+    }
+
+    template<typename Function>
+    void run(const char* name, Function&& function)
+    {
+        function(); // warm up
+
+        const auto start = Clock::now();
+
+        for (int i = 0; i < ITERATIONS; i++)
+            function();
+
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        const double shapes  = (double)SHAPE_COUNT * ITERATIONS;
+
+        std::printf("%-36s %10.2f Kshapes/s\n", name, shapes / seconds / 1.0e3);
+    }
+
+    bool matches(const std::vector<Vertex>& a, const std::vector<Vertex>& b, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (std::fabs(a[i].x - b[i].x) > 1e-2f || std::fabs(a[i].y - b[i].y) > 1e-2f)
+                return false;
+        }
+
+        return true;
+    }
+} // namespace
+
+int main()
+{
+    Matrix4 transform(16.0f, 8.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+
+    std::vector<Shape> shapes(SHAPE_COUNT);
+
+    for (int i = 0; i < SHAPE_COUNT; i++)
+        shapes[i] = { (float)(i % 16) * 80.0f, (float)(i / 16) * 45.0f, 72.0f, 36.0f };
+
+    const int maxVertices = (POINTS + 2) * 4 + 1;
+
+    std::vector<Vector2> scratch(maxVertices);
+    std::vector<Vertex> stream(maxVertices * SHAPE_COUNT), streamReference(maxVertices * SHAPE_COUNT);
+
+    int rectangleVertices = 0;
+    int ellipseVertices   = 0;
+
+    run("reference rounded rectangle", [&] {
+        Vertex* out = streamReference.data();
+
+        for (const auto& shape : shapes)
+            out += referenceRoundedRectangle(transform, shape, 8.0f, 8.0f, POINTS, scratch, out);
+    });
+    run("cached rounded rectangle", [&] {
+        Vertex* out = stream.data();
+
+        for (const auto& shape : shapes)
+            out += cachedRoundedRectangle(transform, shape, 8.0f, 8.0f, POINTS, out);
+
+        rectangleVertices = (int)(out - stream.data());
+    });
+
+    bool ok = matches(stream, streamReference, rectangleVertices);
+
+    run("reference ellipse", [&] {
+        Vertex* out = streamReference.data();
+
+        for (const auto& shape : shapes)
+            out += referenceEllipse(transform, shape, POINTS, scratch, out);
+    });
+    run("cached ellipse", [&] {
+        Vertex* out = stream.data();
+
+        for (const auto& shape : shapes)
+            out += cachedEllipse(transform, shape, POINTS, out);
+
+        ellipseVertices = (int)(out - stream.data());
+    });
+
+    ok = ok && matches(stream, streamReference, ellipseVertices);
+
+    if (!ok)
+        std::printf("cached shapes do not match the reference!\n");
+
+    return ok ? 0 : 1;
+}
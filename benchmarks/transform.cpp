@@ -0,0 +1,142 @@
+/*
+** Micro-benchmark for the Matrix4 vertex transform kernels.
+** Reports vertices per second for each kernel next to the plain 4x4 loop
+** they replaced, over the vertex layouts the renderer actually streams.
+*/
+
+#include "common/Matrix.hpp"
+#include "modules/graphics/vertex.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int VERTEX_COUNT = 4096;
+    constexpr int ITERATIONS   = 2000;
+
+    /* the scalar reference: full 4x4 math, coefficients reloaded every vertex */
+    template<typename Vdst, typename Vsrc>
+    void referenceXY(const float* e, Vdst* dst, const Vsrc* src, int size)
+    {
+        for (int i = 0; i < size; i++)
+        {
+            float x = (e[0] * src[i].x) + (e[4] * src[i].y) + (0) + (e[12]);
+            float y = (e[1] * src[i].x) + (e[5] * src[i].y) + (0) + (e[13]);
+
+            dst[i].x = x;
+            dst[i].y = y;
+        }
+    }
+
+    template<typename Vdst, typename Vsrc>
+    void referenceXYZ(const float* e, Vdst* dst, const Vsrc* src, int size)
+    {
+        for (int i = 0; i < size; i++)
+        {
+            float x = (e[0] * src[i].x) + (e[4] * src[i].y) + (e[8] * src[i].z) + (e[12]);
+            float y = (e[1] * src[i].x) + (e[5] * src[i].y) + (e[9] * src[i].z) + (e[13]);
+            float z = (e[2] * src[i].x) + (e[6] * src[i].y) + (e[10] * src[i].z) + (e[14]);
+
+            dst[i].x = x;
+            dst[i].y = y;
+            dst[i].z = z;
+        }
+    }
+
+    template<typename Function>
+    void run(const char* name, Function&& function)
+    {
+        function(); // warm up
+
+        const auto start = Clock::now();
+
+        for (int i = 0; i < ITERATIONS; i++)
+            function();
+
+        const double seconds  = std::chrono::duration<double>(Clock::now() - start).count();
+        const double vertices = (double)VERTEX_COUNT * ITERATIONS;
+
+        std::printf("%-36s %10.2f Mvertices/s\n", name, vertices / seconds / 1.0e6);
+    }
+
+    template<typename V>
+    bool matches(const std::vector<V>& a, const std::vector<V>& b, bool checkZ)
+    {
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            if (std::fabs(a[i].x - b[i].x) > 1e-3f || std::fabs(a[i].y - b[i].y) > 1e-3f)
+                return false;
+
+            if constexpr (requires { a[i].z; })
+            {
+                if (checkZ && std::fabs(a[i].z - b[i].z) > 1e-3f)
+                    return false;
+            }
+        }
+
+        return true;
+    }
+} // namespace
+
+int main()
+{
+    Matrix4 affine(100.0f, 50.0f, 0.5f, 2.0f, 2.0f, 8.0f, 8.0f, 0.1f, 0.0f);
+    Matrix4 perspective = Matrix4::perspective(1.0f, 16.0f / 9.0f, 0.1f, 100.0f) * affine;
+
+    std::vector<Vector2> positions(VERTEX_COUNT);
+    std::vector<Vector3> positions3(VERTEX_COUNT);
+
+    for (int i = 0; i < VERTEX_COUNT; i++)
+    {
+        positions[i]  = Vector2((float)(std::rand() % 1280), (float)(std::rand() % 720));
+        positions3[i] = Vector3(positions[i].x, positions[i].y, (float)(i % 16));
+    }
+
+    std::vector<Vertex> packed(VERTEX_COUNT), packedReference(VERTEX_COUNT);
+    std::vector<XYf_STf_RGBAf> wide(VERTEX_COUNT), wideReference(VERTEX_COUNT);
+    std::vector<Vector3> out3(VERTEX_COUNT), out3Reference(VERTEX_COUNT);
+
+    const float* ea = affine.getElements();
+    const float* ep = perspective.getElements();
+
+    run("reference transformXY (Vertex)", [&] {
+        referenceXY(ea, packedReference.data(), positions.data(), VERTEX_COUNT);
+    });
+    run("transformXY (Vertex)", [&] {
+        affine.transformXY(packed.data(), positions.data(), VERTEX_COUNT);
+    });
+
+    run("reference transformXY (XYf_STf_RGBAf)", [&] {
+        referenceXY(ea, wideReference.data(), positions.data(), VERTEX_COUNT);
+    });
+    run("transformXY (XYf_STf_RGBAf)", [&] {
+        affine.transformXY(wide.data(), positions.data(), VERTEX_COUNT);
+    });
+
+    run("transformXY0 (Vector3)", [&] {
+        affine.transformXY0(out3.data(), positions.data(), VERTEX_COUNT);
+    });
+
+    run("reference transformXYZ (Vector3)", [&] {
+        referenceXYZ(ep, out3Reference.data(), positions3.data(), VERTEX_COUNT);
+    });
+    run("transformXYZ (Vector3)", [&] {
+        perspective.transformXYZ(out3.data(), positions3.data(), VERTEX_COUNT);
+    });
+
+    bool ok = matches(packed, packedReference, false) && matches(wide, wideReference, false) &&
+              matches(out3, out3Reference, true);
+
+    if (!ok)
+        std::printf("kernel output does not match the reference!\n");
+
+    return ok ? 0 : 1;
+}
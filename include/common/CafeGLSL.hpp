@@ -2,6 +2,7 @@
 
 #ifdef USE_CAFEGLSL
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -56,6 +57,12 @@ namespace love
          */
         static bool IsAvailable();
 
+        /**
+         * @brief Identify the loaded compiler build, for validating cached shaders
+         * @return Hash of the compiler module, or 0 if it was not loaded
+         */
+        static uint64_t GetBuildId();
+
         /**
          * @brief Compile a GLSL vertex shader to GX2VertexShader
          * @param source GLSL source code string
@@ -97,6 +104,9 @@ namespace love
     private:
         static bool s_initialized;
         static bool s_available;
+        static uint64_t s_buildId;
+
+        static uint64_t ComputeBuildId(const char* path);
 
 #ifdef __WIIU__
         static OSDynLoad_Module s_compilerModule;
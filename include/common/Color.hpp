@@ -154,9 +154,22 @@ namespace love
         Color32(uint8_t (&rgba)[4]) : r(rgba[0]), g(rgba[1]), b(rgba[2]), a(rgba[3])
         {}
 
+        Color32(const Color& color) :
+            r(as_uint8_t(color.r)),
+            g(as_uint8_t(color.g)),
+            b(as_uint8_t(color.b)),
+            a(as_uint8_t(color.a))
+        {}
+
         constexpr std::strong_ordering operator<=>(const Color32& other) const noexcept = default;
 
         uint8_t r, g, b, a;
+
+      private:
+        static uint8_t as_uint8_t(float in)
+        {
+            return (255.0f * std::clamp(in, 0.0f, 1.0f) + 0.5f);
+        }
     };
 
     static bool gammaCorrect = false;
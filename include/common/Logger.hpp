@@ -0,0 +1,164 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#define LOVE_LOG_LEVEL_TRACE 0
+#define LOVE_LOG_LEVEL_DEBUG 1
+#define LOVE_LOG_LEVEL_INFO  2
+#define LOVE_LOG_LEVEL_WARN  3
+#define LOVE_LOG_LEVEL_ERROR 4
+#define LOVE_LOG_LEVEL_OFF   5
+
+/*
+** Compile-time floor for log messages.
+** Anything below this level is discarded by the preprocessor/compiler and
+** its arguments are never evaluated. Set through CMake (LOVE_LOG_LEVEL).
+*/
+#ifndef LOVE_LOG_LEVEL
+    #if defined(__DEBUG__) && __DEBUG__
+        #define LOVE_LOG_LEVEL LOVE_LOG_LEVEL_DEBUG
+    #else
+        #define LOVE_LOG_LEVEL LOVE_LOG_LEVEL_WARN
+    #endif
+#endif
+
+#if defined(__GNUC__)
+    #define LOVE_LOG_FORMAT(index, first) __attribute__((format(printf, index, first)))
+#else
+    #define LOVE_LOG_FORMAT(index, first)
+#endif
+
+namespace love
+{
+    /*
+    ** Asynchronous logger.
+    **
+    ** Producers format into a fixed-size slot of a bounded lock-free ring
+    ** buffer and return immediately. A background writer thread drains the
+    ** ring into the log file, so no call site ever touches the filesystem.
+    ** When the ring is full, messages are dropped and counted instead of
+    ** blocking the caller. Messages longer than a slot take several
+    ** consecutive slots and are written back out as a single entry.
+    */
+    class Logger
+    {
+      public:
+        enum Level
+        {
+            LEVEL_TRACE = LOVE_LOG_LEVEL_TRACE,
+            LEVEL_DEBUG = LOVE_LOG_LEVEL_DEBUG,
+            LEVEL_INFO  = LOVE_LOG_LEVEL_INFO,
+            LEVEL_WARN  = LOVE_LOG_LEVEL_WARN,
+            LEVEL_ERROR = LOVE_LOG_LEVEL_ERROR,
+            LEVEL_OFF   = LOVE_LOG_LEVEL_OFF,
+            LEVEL_MAX_ENUM
+        };
+
+        enum Category
+        {
+            CATEGORY_CORE,
+            CATEGORY_LUA,
+            CATEGORY_GRAPHICS,
+            CATEGORY_SHADER,
+            CATEGORY_FONT,
+            CATEGORY_AUDIO,
+            CATEGORY_INPUT,
+            CATEGORY_EVENT,
+            CATEGORY_WINDOW,
+            CATEGORY_FILESYSTEM,
+            CATEGORY_MAX_ENUM
+        };
+
+        static constexpr size_t RING_CAPACITY = 512;
+        static constexpr size_t MESSAGE_SIZE  = 240;
+
+        /* longest message is MESSAGE_PARTS * (MESSAGE_SIZE - 1) characters, the rest is cut off */
+        static constexpr size_t MESSAGE_PARTS = 32;
+
+        /* default amount of non-error messages per category per second */
+        static constexpr uint32_t DEFAULT_RATE_LIMIT = 240;
+
+        /*
+        ** Opens the log file and starts the writer thread.
+        ** Messages logged before this are kept in the ring (up to its capacity).
+        */
+        static void start(const char* filepath = nullptr);
+
+        /* Drains the ring, stops the writer thread and closes the file. */
+        static void stop();
+
+        /* Blocks until everything logged so far has been written. */
+        static void flush();
+
+        static void setLevel(Level level);
+
+        static Level getLevel();
+
+        static void setCategoryEnabled(Category category, bool enabled);
+
+        static bool isCategoryEnabled(Category category);
+
+        /* 0 disables rate limiting */
+        static void setRateLimit(uint32_t messagesPerSecond);
+
+        static uint64_t getDroppedCount();
+
+        static uint64_t getSuppressedCount();
+
+        static bool isEnabled(Level level, Category category)
+        {
+            return level >= runtimeLevel.load(std::memory_order_relaxed) &&
+                   (categoryMask.load(std::memory_order_relaxed) & (1u << category)) != 0;
+        }
+
+        static void write(Level level, Category category, const char* format, ...) LOVE_LOG_FORMAT(3, 4);
+
+      private:
+        static std::atomic<Level> runtimeLevel;
+        static std::atomic<uint32_t> categoryMask;
+    };
+} // namespace love
+
+#define LOVE_LOG_ENABLED(level, category)              \
+    (LOVE_LOG_LEVEL_##level >= LOVE_LOG_LEVEL &&       \
+     ::love::Logger::isEnabled(::love::Logger::LEVEL_##level, ::love::Logger::CATEGORY_##category))
+
+/*
+** LOVE_LOG_<LEVEL>(CATEGORY, format, ...)
+** e.g. LOVE_LOG_DEBUG(GRAPHICS, "flushing %d vertices", count);
+*/
+#define LOVE_LOG(level, category, ...)                                                            \
+    do                                                                                            \
+    {                                                                                             \
+        if constexpr (LOVE_LOG_LEVEL_##level >= LOVE_LOG_LEVEL)                                   \
+        {                                                                                         \
+            if (::love::Logger::isEnabled(::love::Logger::LEVEL_##level,                          \
+                                          ::love::Logger::CATEGORY_##category))                   \
+                ::love::Logger::write(::love::Logger::LEVEL_##level,                              \
+                                      ::love::Logger::CATEGORY_##category, __VA_ARGS__);          \
+        }                                                                                         \
+    } while (0)
+
+#define LOVE_LOG_TRACE(category, ...) LOVE_LOG(TRACE, category, __VA_ARGS__)
+#define LOVE_LOG_DEBUG(category, ...) LOVE_LOG(DEBUG, category, __VA_ARGS__)
+#define LOVE_LOG_INFO(category, ...)  LOVE_LOG(INFO, category, __VA_ARGS__)
+#define LOVE_LOG_WARN(category, ...)  LOVE_LOG(WARN, category, __VA_ARGS__)
+#define LOVE_LOG_ERROR(category, ...) LOVE_LOG(ERROR, category, __VA_ARGS__)
+
+/*
+** Logs only the first `first` hits of a call site, then every `every`th.
+** Used for per-frame paths where a steady trickle is enough to follow along.
+*/
+#define LOVE_LOG_SAMPLED(level, category, first, every, ...)                                      \
+    do                                                                                            \
+    {                                                                                             \
+        if constexpr (LOVE_LOG_LEVEL_##level >= LOVE_LOG_LEVEL)                                   \
+        {                                                                                         \
+            static std::atomic<uint32_t> _loveLogHits { 0 };                                      \
+            const uint32_t _loveLogHit = _loveLogHits.fetch_add(1, std::memory_order_relaxed);    \
+            if (_loveLogHit < (first) || (_loveLogHit % (every)) == 0)                            \
+                LOVE_LOG(level, category, __VA_ARGS__);                                           \
+        }                                                                                         \
+    } while (0)
@@ -25,9 +25,44 @@
 #include "common/Vector.hpp"
 #include "common/math.hpp"
 
+#include <cstddef>
+#include <type_traits>
+
 namespace love
 {
 
+    namespace detail
+    {
+        /**
+         * Whether V stores `float x, y` (and z, for N = 3) next to each other, so
+         * the transform kernels can walk an array of V as a strided float stream.
+         **/
+        template<typename V, int N, typename = void>
+        struct PackedPosition : std::false_type
+        {};
+
+        template<typename V>
+        struct PackedPosition<V, 2,
+                              std::enable_if_t<std::is_standard_layout_v<V> &&
+                                               std::is_same_v<decltype(V::x), float> &&
+                                               std::is_same_v<decltype(V::y), float>>>
+            : std::bool_constant<offsetof(V, y) == offsetof(V, x) + sizeof(float)>
+        {};
+
+        template<typename V>
+        struct PackedPosition<V, 3,
+                              std::enable_if_t<std::is_standard_layout_v<V> &&
+                                               std::is_same_v<decltype(V::x), float> &&
+                                               std::is_same_v<decltype(V::y), float> &&
+                                               std::is_same_v<decltype(V::z), float>>>
+            : std::bool_constant<offsetof(V, y) == offsetof(V, x) + sizeof(float) &&
+                                 offsetof(V, z) == offsetof(V, y) + sizeof(float)>
+        {};
+
+        template<typename V, int N>
+        inline constexpr bool isPackedPosition = PackedPosition<V, N>::value;
+    } // namespace detail
+
     /**
      * This class is the basis for all transformations in LOVE. Although not really
      * needed for 2D, it contains 4x4 elements to be compatible with OpenGL without
@@ -38,6 +73,16 @@ namespace love
       private:
         static void multiply(const Matrix4& a, const Matrix4& b, float t[16]);
 
+        /**
+         * Transform kernels over strided float streams. Strides are in bytes,
+         * src and dst may overlap exactly (src == dst) but not partially.
+         * Uses SSE where available and a scalar loop with the coefficients
+         * hoisted into registers otherwise.
+         **/
+        void transformXY(float* dst, size_t dstStride, const float* src, size_t srcStride, int size) const;
+        void transformXY0(float* dst, size_t dstStride, const float* src, size_t srcStride, int size) const;
+        void transformXYZ(float* dst, size_t dstStride, const float* src, size_t srcStride, int size) const;
+
       public:
         static void multiply(const Matrix4& a, const Matrix4& b, Matrix4& result);
 
@@ -326,30 +371,52 @@ namespace love
     template<typename Vdst, typename Vsrc>
     void Matrix4::transformXY(Vdst* dst, const Vsrc* src, int size) const
     {
-        for (int i = 0; i < size; i++)
+        if constexpr (detail::isPackedPosition<Vdst, 2> && detail::isPackedPosition<Vsrc, 2>)
         {
-            // Store in temp variables in case src = dst
-            float x = (e[0] * src[i].x) + (e[4] * src[i].y) + (0) + (e[12]);
-            float y = (e[1] * src[i].x) + (e[5] * src[i].y) + (0) + (e[13]);
-
-            dst[i].x = x;
-            dst[i].y = y;
+            if (size > 0)
+                this->transformXY(&dst->x, sizeof(Vdst), &src->x, sizeof(Vsrc), size);
+        }
+        else
+        {
+            // Copy the coefficients out, writes to dst could otherwise alias e[].
+            const float e0 = e[0], e1 = e[1], e4 = e[4], e5 = e[5], e12 = e[12], e13 = e[13];
+
+            for (int i = 0; i < size; i++)
+            {
+                // Store in temp variables in case src = dst
+                float x = (e0 * src[i].x) + (e4 * src[i].y) + (e12);
+                float y = (e1 * src[i].x) + (e5 * src[i].y) + (e13);
+
+                dst[i].x = x;
+                dst[i].y = y;
+            }
         }
     }
 
     template<typename Vdst, typename Vsrc>
     void Matrix4::transformXY0(Vdst* dst, const Vsrc* src, int size) const
     {
-        for (int i = 0; i < size; i++)
+        if constexpr (detail::isPackedPosition<Vdst, 3> && detail::isPackedPosition<Vsrc, 2>)
         {
-            // Store in temp variables in case src = dst
-            float x = (e[0] * src[i].x) + (e[4] * src[i].y) + (0) + (e[12]);
-            float y = (e[1] * src[i].x) + (e[5] * src[i].y) + (0) + (e[13]);
-            float z = (e[2] * src[i].x) + (e[6] * src[i].y) + (0) + (e[14]);
-
-            dst[i].x = x;
-            dst[i].y = y;
-            dst[i].z = z;
+            if (size > 0)
+                this->transformXY0(&dst->x, sizeof(Vdst), &src->x, sizeof(Vsrc), size);
+        }
+        else
+        {
+            const float e0 = e[0], e1 = e[1], e2 = e[2], e4 = e[4], e5 = e[5], e6 = e[6];
+            const float e12 = e[12], e13 = e[13], e14 = e[14];
+
+            for (int i = 0; i < size; i++)
+            {
+                // Store in temp variables in case src = dst
+                float x = (e0 * src[i].x) + (e4 * src[i].y) + (e12);
+                float y = (e1 * src[i].x) + (e5 * src[i].y) + (e13);
+                float z = (e2 * src[i].x) + (e6 * src[i].y) + (e14);
+
+                dst[i].x = x;
+                dst[i].y = y;
+                dst[i].z = z;
+            }
         }
     }
 
@@ -365,16 +432,27 @@ namespace love
     template<typename Vdst, typename Vsrc>
     void Matrix4::transformXYZ(Vdst* dst, const Vsrc* src, int size) const
     {
-        for (int i = 0; i < size; i++)
+        if constexpr (detail::isPackedPosition<Vdst, 3> && detail::isPackedPosition<Vsrc, 3>)
         {
-            // Store in temp variables in case src = dst
-            float x = (e[0] * src[i].x) + (e[4] * src[i].y) + (e[8] * src[i].z) + (e[12]);
-            float y = (e[1] * src[i].x) + (e[5] * src[i].y) + (e[9] * src[i].z) + (e[13]);
-            float z = (e[2] * src[i].x) + (e[6] * src[i].y) + (e[10] * src[i].z) + (e[14]);
-
-            dst[i].x = x;
-            dst[i].y = y;
-            dst[i].z = z;
+            if (size > 0)
+                this->transformXYZ(&dst->x, sizeof(Vdst), &src->x, sizeof(Vsrc), size);
+        }
+        else
+        {
+            const float e0 = e[0], e1 = e[1], e2 = e[2], e4 = e[4], e5 = e[5], e6 = e[6];
+            const float e8 = e[8], e9 = e[9], e10 = e[10], e12 = e[12], e13 = e[13], e14 = e[14];
+
+            for (int i = 0; i < size; i++)
+            {
+                // Store in temp variables in case src = dst
+                float x = (e0 * src[i].x) + (e4 * src[i].y) + (e8 * src[i].z) + (e12);
+                float y = (e1 * src[i].x) + (e5 * src[i].y) + (e9 * src[i].z) + (e13);
+                float z = (e2 * src[i].x) + (e6 * src[i].y) + (e10 * src[i].z) + (e14);
+
+                dst[i].x = x;
+                dst[i].y = y;
+                dst[i].z = z;
+            }
         }
     }
 
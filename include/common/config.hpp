@@ -1,3 +1,12 @@
 #pragma once
 
 #define LOVE_UNUSED(x) (void)sizeof(x)
+
+/* SIMD instruction sets available to hand-written kernels */
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #define LOVE_SIMD_SSE
+#endif
+
+#if defined(__ARM_NEON)
+    #define LOVE_SIMD_NEON
+#endif
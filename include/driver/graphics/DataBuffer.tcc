@@ -0,0 +1,134 @@
+#pragma once
+
+#include "common/Object.hpp"
+
+#include "driver/graphics/StreamBuffer.tcc"
+#include "modules/graphics/Resource.hpp"
+#include "modules/graphics/vertex.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace love
+{
+    struct DataBufferFrame
+    {
+        /* advanced once per frame by GraphicsBase::advanceStreamBuffers */
+        static inline uint32_t current = 1;
+    };
+
+    /*
+    ** Long-lived vertex or index storage owned by a drawable (SpriteBatch,
+    ** Mesh), as opposed to the per-frame StreamBuffers used for batching.
+    **
+    ** Writes go straight to GPU-visible memory. A backing read by a draw in
+    ** the last BUFFER_FRAMES frames is never written in place: upload() moves
+    ** on to a free backing and copies everything once. Otherwise only the
+    ** range that changed is copied and flushed from the CPU cache.
+    */
+    template<typename T>
+    class DataBufferBase : public Object, public Resource
+    {
+      public:
+        virtual ~DataBufferBase()
+        {}
+
+        /* size in elements */
+        size_t getSize() const
+        {
+            return this->bufferSize;
+        }
+
+        BufferUsage getMode() const
+        {
+            return this->mode;
+        }
+
+        BufferDataUsage getDataUsage() const
+        {
+            return this->dataUsage;
+        }
+
+        /*
+        ** Copies source[offset, offset + count) into the buffer. `source` holds
+        ** the buffer's entire contents, the first `validCount` of which are in
+        ** use, in case the whole buffer has to be copied to a new backing.
+        */
+        void upload(const T* source, size_t validCount, size_t offset, size_t count)
+        {
+            validCount = std::min(validCount, this->bufferSize);
+
+            if (offset >= validCount || count == 0)
+                return;
+
+            count = std::min(count, validCount - offset);
+
+            if (this->isInFlight(this->active))
+            {
+                this->active = this->acquireBacking();
+
+                offset = 0;
+                count  = validCount;
+            }
+
+            T* data = this->lock(this->active);
+            std::copy_n(source + offset, count, data + offset);
+            this->unlock(this->active, offset, count);
+        }
+
+        /* a draw reading from the buffer was recorded this frame */
+        void markUsed()
+        {
+            this->usedFrames[this->active] = DataBufferFrame::current;
+        }
+
+        size_t getBackingCount() const
+        {
+            return this->usedFrames.size();
+        }
+
+      protected:
+        DataBufferBase(BufferUsage mode, BufferDataUsage dataUsage, size_t size) :
+            bufferSize(size),
+            mode(mode),
+            dataUsage(dataUsage),
+            active(0),
+            usedFrames {}
+        {}
+
+        virtual T* lock(size_t backing) = 0;
+
+        virtual void unlock(size_t backing, size_t offset, size_t count) = 0;
+
+        /* allocates another backing of bufferSize elements and returns its index */
+        virtual size_t createBacking() = 0;
+
+        bool isInFlight(size_t backing) const
+        {
+            const uint32_t used = this->usedFrames[backing];
+            return used != 0 && DataBufferFrame::current - used < BUFFER_FRAMES;
+        }
+
+        size_t acquireBacking()
+        {
+            for (size_t index = 0; index < this->usedFrames.size(); index++)
+            {
+                if (index != this->active && !this->isInFlight(index))
+                    return index;
+            }
+
+            const size_t index = this->createBacking();
+            this->usedFrames.push_back(0);
+
+            return index;
+        }
+
+        size_t bufferSize;
+
+        BufferUsage mode;
+        BufferDataUsage dataUsage;
+
+        size_t active;
+        std::vector<uint32_t> usedFrames;
+    };
+} // namespace love
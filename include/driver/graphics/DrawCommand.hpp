@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/Exception.hpp"
+#include "common/Matrix.hpp"
 
 #include "driver/graphics/StreamBuffer.hpp"
 
@@ -36,10 +37,15 @@ namespace love
 
         IndexDataType indexType  = INDEX_UINT16;
         size_t indexBufferOffset = 0;
+        size_t baseVertex        = 0; //< added to every index fetched
+        bool quadIndices         = false; //< indexBuffer is the shared quad index buffer
 
         TextureBase* texture = nullptr;
         CullMode cullMode    = CULL_NONE;
 
+        /* applied by the GPU as the model-view uniform, nullptr for pre-transformed vertices */
+        const Matrix4* transform = nullptr;
+
         bool isFont = false;
 
         DrawIndexedCommand(const VertexAttributes* attributes, const BufferBindings* buffers,
@@ -65,6 +71,9 @@ namespace love
         CullMode cullMode    = CULL_NONE;
         const BufferBindings* buffers;
 
+        /* see DrawIndexedCommand::transform */
+        const Matrix4* transform = nullptr;
+
         bool isFont = false;
     };
 
@@ -78,35 +87,53 @@ namespace love
         StreamBuffer<Vertex>* vertexBuffer  = nullptr;
         StreamBuffer<uint16_t>* indexBuffer = nullptr;
 
+        /* created on demand, once a frame streams more than 65535 indexed vertices */
+        StreamBuffer<uint32_t>* indexBuffer32 = nullptr;
+
+        /* immutable indices for QUAD_INDEX_BUFFER_QUADS quads, drawn with a base vertex */
+        StreamBuffer<uint16_t>* quadIndexBuffer = nullptr;
+
         PrimitiveType primitiveMode = PRIMITIVE_TRIANGLES;
         CommonFormat format         = CommonFormat::NONE;
         StrongRef<TextureBase> texture;
         ShaderBase::StandardShader shaderType = ShaderBase::STANDARD_DEFAULT;
 
-        int vertexCount = 0;
-        int indexCount  = 0;
+        int vertexCount  = 0;
+        int indexCount   = 0;
+        int indexCount32 = 0;
 
         int lastVertexCount = 0;
         int lastIndexCount  = 0;
 
-        MapInfo<Vertex> vertexBufferMap  = MapInfo<Vertex>();
-        MapInfo<uint16_t> indexBufferMap = MapInfo<uint16_t>();
+        MapInfo<Vertex> vertexBufferMap    = MapInfo<Vertex>();
+        MapInfo<uint16_t> indexBufferMap   = MapInfo<uint16_t>();
+        MapInfo<uint32_t> indexBufferMap32 = MapInfo<uint32_t>();
 
         bool flushing = false;
 
+        bool indexed            = false;
+        bool quadIndices        = false;
+        IndexDataType indexType = INDEX_UINT16; //< of the streamed indices
+
         bool isFont        = false;
         bool pushTransform = true;
     };
 
 #ifdef __WIIU__
     // Modest buffers for Wii U - enough for startup but not excessive
-    constexpr size_t INIT_VERTEX_BUFFER_SIZE = sizeof(Vertex) * 4096;  // 128KB - back to reasonable size
+    constexpr size_t INIT_VERTEX_BUFFER_SIZE = sizeof(Vertex) * 4096;  // 80KB - back to reasonable size
     constexpr size_t INIT_INDEX_BUFFER_SIZE  = sizeof(uint16_t) * 32768; // 64KB - enough for startup
 #else
     constexpr size_t INIT_VERTEX_BUFFER_SIZE = sizeof(Vertex) * 4096 * 1;
     constexpr size_t INIT_INDEX_BUFFER_SIZE  = sizeof(uint16_t) * LOVE_UINT16_MAX * 1;
 #endif
 
+    /* 16383 quads, the most whose vertices a uint16 index can address */
+    constexpr int QUAD_INDEX_BUFFER_QUADS    = LOVE_UINT16_MAX / 4;
+    constexpr int QUAD_INDEX_BUFFER_VERTICES = QUAD_INDEX_BUFFER_QUADS * 4;
+
     StreamBuffer<Vertex>* newVertexBuffer(size_t size);
     StreamBuffer<uint16_t>* newIndexBuffer(size_t size);
+    StreamBuffer<uint32_t>* newIndexBuffer32(size_t size);
+    StreamBuffer<uint16_t>* newQuadIndexBuffer();
 } // namespace love
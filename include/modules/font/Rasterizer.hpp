@@ -99,6 +99,12 @@ namespace love
 
         virtual TextShaper* newTextShaper() = 0;
 
+        /* an independent copy that can rasterize on another thread, nullptr if unsupported */
+        virtual Rasterizer* clone() const
+        {
+            return nullptr;
+        }
+
         float getDPIScale() const
         {
             return dpiScale;
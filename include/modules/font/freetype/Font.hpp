@@ -11,6 +11,14 @@ using SystemFontType = PlSharedFontType;
 #elif defined(__WIIU__)
     #include <coreinit/memory.h>
 using SystemFontType = OSSharedDataType;
+#elif defined(__OS__)
+/* host build: system fonts are regular files on disk */
+enum HostSystemFont
+{
+    HOST_FONT_STANDARD,
+    HOST_FONT_MAX_ENUM
+};
+using SystemFontType = HostSystemFont;
 #else
     #error "Unsupported platform for FreeType"
 #endif
@@ -50,6 +58,10 @@ namespace love
           { "korean",    OS_SHAREDDATATYPE_FONT_KOREAN    },
           { "taiwanese", OS_SHAREDDATATYPE_FONT_TAIWANESE }
         );
+#else
+        STRINGMAP_DECLARE(SystemFonts, HostSystemFont,
+          { "standard", HOST_FONT_STANDARD }
+        );
 #endif
         // clang-format on
 
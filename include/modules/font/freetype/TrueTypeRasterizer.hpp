@@ -37,6 +37,9 @@ namespace love
 
         TextShaper* newTextShaper() override;
 
+        /* uses its own FT_Library, so it never shares FreeType state with this one */
+        Rasterizer* clone() const override;
+
         ptrdiff_t getHandle() const override
         {
             return (ptrdiff_t)this->face;
@@ -59,5 +62,8 @@ namespace love
         FT_Face face;
         Hinting hinting;
         bool sdf;
+
+        int pointSize;
+        FT_Library ownedLibrary;
     };
 } // namespace love
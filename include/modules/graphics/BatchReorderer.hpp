@@ -0,0 +1,107 @@
+#pragma once
+
+#include "common/StrongRef.hpp"
+
+#include "driver/graphics/DrawCommand.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Holds back a short window of batched draws so that a draw can join an
+    ** earlier batch with the same state, as long as its screen-space bounds
+    ** don't overlap anything drawn in between. Vertices are written into the
+    ** window and replayed into the real batch in the new order.
+    **
+    ** Only formats that start with a 2D position can be bounded, anything
+    ** else (or anything too large for the window) goes straight through.
+    */
+    class BatchReorderer
+    {
+      public:
+        static constexpr int MAX_COMMANDS        = 64;
+        static constexpr size_t MAX_VERTEX_BYTES = 64 * 1024;
+
+        BatchReorderer();
+
+        void setEnabled(bool enabled)
+        {
+            this->enabled = enabled;
+        }
+
+        bool isEnabled() const
+        {
+            return this->enabled;
+        }
+
+        bool isEmpty() const
+        {
+            return this->pending.empty();
+        }
+
+        static bool canReorder(const BatchedDrawCommand& command);
+
+        /* whether `command` still fits in the window */
+        bool hasRoom(const BatchedDrawCommand& command) const;
+
+        /* returns where the caller writes the command's vertices */
+        void* push(const BatchedDrawCommand& command);
+
+        /*
+        ** Calls emit(command, vertices, size) for every pending draw in the
+        ** reordered sequence and empties the window. `reordered` counts draws
+        ** moved ahead of others, `merged` the batches saved by doing so.
+        */
+        template<typename Emit>
+        void drain(Emit&& emit, int& reordered, int& merged)
+        {
+            this->group(reordered, merged);
+
+            for (const auto& members : this->groups)
+            {
+                for (const int index : members)
+                {
+                    const auto& draw = this->pending[index];
+                    emit(draw.command, this->vertices.get() + draw.offset, draw.size);
+                }
+            }
+
+            this->pending.clear();
+            this->vertexBytes = 0;
+        }
+
+      private:
+        struct Pending
+        {
+            BatchedDrawCommand command;
+            size_t offset;
+            size_t size;
+
+            /* the command only has a raw pointer, the texture may be collected while it waits */
+            StrongRef<TextureBase> texture;
+        };
+
+        struct Bounds
+        {
+            float minX, minY;
+            float maxX, maxY;
+        };
+
+        static bool isCompatible(const BatchedDrawCommand& a, const BatchedDrawCommand& b);
+
+        Bounds getBounds(const Pending& draw) const;
+
+        void group(int& reordered, int& merged);
+
+        std::vector<Pending> pending;
+        std::unique_ptr<uint8_t[]> vertices;
+        size_t vertexBytes;
+
+        std::vector<std::vector<int>> groups;
+        std::vector<Bounds> groupBounds;
+
+        bool enabled;
+    };
+} // namespace love
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <list>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -14,6 +15,7 @@
 #include "modules/font/Rasterizer.hpp"
 #include "modules/font/TextShaper.hpp"
 
+#include "modules/graphics/GlyphPreloader.hpp"
 #include "modules/graphics/Texture.tcc"
 #include "modules/graphics/Volatile.hpp"
 #include "modules/graphics/vertex.hpp"
@@ -28,7 +30,7 @@ namespace love
         static inline Type type = Type("Font", &Object::type);
 
         using Codepoints  = std::vector<uint32_t>;
-        using GlyphVertex = XYf_STf_RGBAf;
+        using GlyphVertex = Vertex;
 
         enum AlignMode
         {
@@ -68,6 +70,13 @@ namespace love
         void printf(GraphicsBase* gfx, const std::vector<ColoredString>& text, float wrap, AlignMode align,
                     const Matrix4& m, const Color& constantColor);
 
+        /*
+        ** Adds the glyphs of `text` to the atlas ahead of time. In the
+        ** background they are rasterized on a worker thread and uploaded as
+        ** they finish, the next time this font generates vertices.
+        */
+        void preload(const std::string& text, bool background);
+
         float getHeight() const;
 
         int getWidth(const std::string& text);
@@ -127,6 +136,9 @@ namespace love
 
         static int fontCount;
 
+        /* how many print/printf layouts each font keeps around */
+        static constexpr size_t MAX_TEXT_LAYOUTS = 64;
+
       protected:
         static inline uint64_t packGlyphIndex(TextShaper::GlyphIndex glyphindex)
         {
@@ -153,8 +165,33 @@ namespace love
         void printv(GraphicsBase* gfx, const Matrix4& t, const std::vector<DrawCommand>& drawcommands,
                     const std::vector<GlyphVertex>& vertices);
 
+        /*
+        ** The generated vertices of a print (align is ALIGN_MAX_ENUM) or printf
+        ** call, reused while the text, settings and glyph textures are the same.
+        */
+        struct TextLayout
+        {
+            uint64_t hash;
+            std::vector<ColoredString> text;
+            Color constantColor;
+            float wrap;
+            AlignMode align;
+            uint32_t textureCacheID;
+            std::vector<DrawCommand> drawCommands;
+            std::vector<GlyphVertex> vertices;
+        };
+
+        const TextLayout& getTextLayout(const std::vector<ColoredString>& text, const Color& constantColor,
+                                        float wrap, AlignMode align);
+
+        void clearTextLayouts();
+
         virtual const Glyph& addGlyph(TextShaper::GlyphIndex glyphindex);
 
+        const Glyph& addGlyph(TextShaper::GlyphIndex glyphIndex, GlyphData* glyphData);
+
+        void uploadPreloadedGlyphs();
+
         StrongRef<TextShaper> shaper;
 
         int textureWidth;
@@ -163,6 +200,11 @@ namespace love
         std::vector<StrongRef<TextureBase>> textures;
         std::unordered_map<uint64_t, Glyph> glyphs;
 
+        /* reused when glyphs have to be converted to the atlas format */
+        std::vector<uint8_t> glyphStaging;
+
+        StrongRef<GlyphPreloader> glyphPreloader;
+
         PixelFormat pixelFormat;
         SamplerState samplerState;
 
@@ -175,6 +217,10 @@ namespace love
 
         uint32_t textureCacheID;
 
+        /* most recently used first */
+        std::list<TextLayout> textLayouts;
+        std::unordered_map<uint64_t, std::list<TextLayout>::iterator> textLayoutIndex;
+
         static constexpr int TEXTURE_PADDING = 2;
 
         virtual void createTexture() = 0;
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "common/StrongRef.hpp"
+
+#include "modules/font/GlyphData.hpp"
+#include "modules/font/Rasterizer.hpp"
+#include "modules/font/TextShaper.hpp"
+#include "modules/thread/Threadable.hpp"
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Rasterizes a font's glyphs on a worker thread with its own copies of the
+    ** font's rasterizers. Finished glyphs are collected by the main thread,
+    ** which only has to place them in the atlas and upload the pixels.
+    ** Rasterizers that can't be copied are left to the main thread.
+    */
+    class GlyphPreloader : public Threadable
+    {
+      public:
+        struct Result
+        {
+            TextShaper::GlyphIndex glyphIndex;
+            StrongRef<GlyphData> glyphData;
+        };
+
+        GlyphPreloader(const StrongRasterizers& rasterizers);
+
+        virtual ~GlyphPreloader();
+
+        void run() override;
+
+        /* returns false for glyphs whose rasterizer couldn't be copied */
+        bool canPreload(TextShaper::GlyphIndex glyphIndex) const;
+
+        void enqueue(const std::vector<TextShaper::GlyphIndex>& glyphIndices);
+
+        /* moves the glyphs finished so far into `results` */
+        void takeFinished(std::vector<Result>& results);
+
+        /* stops after the current glyph and joins the worker */
+        void stop();
+
+      private:
+        StrongRasterizers rasterizers;
+
+        std::deque<TextShaper::GlyphIndex> pending;
+        std::vector<Result> finished;
+
+        bool working;
+        bool stopping;
+
+        std::mutex mutex;
+    };
+} // namespace love
@@ -12,23 +12,28 @@
 #include "modules/font/Font.tcc"
 #include "modules/math/MathModule.hpp"
 
+#include "modules/graphics/BatchReorderer.hpp"
 #include "modules/graphics/Font.tcc"
 #include "modules/graphics/Shader.tcc"
+#include "modules/graphics/ShaderPreloader.hpp"
 #include "modules/graphics/ShaderStage.tcc"
 #include "modules/graphics/TextBatch.hpp"
 #include "modules/graphics/Texture.tcc"
+#include "modules/graphics/TextureAtlas.hpp"
 #include "modules/graphics/Volatile.hpp"
 #include "modules/graphics/renderstate.hpp"
 #include "modules/graphics/samplerstate.hpp"
 
 #include "driver/graphics/DrawCommand.hpp"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
 namespace love
 {
     class SpriteBatch;
+    class MeshBase;
     class ParticleSystem;
     class TextBatch;
     class Video;
@@ -183,6 +188,13 @@ namespace love
         {
             int drawCalls;
             int drawCallsBatched;
+            int drawCallsMerged;
+            int drawCallsReordered;
+            int batchesMergedByReordering;
+            int drawCallsCulled;
+            int drawCallsIndex32;
+            int stateChanges;
+            int stateChangesSkipped;
             int renderTargetSwitches;
             int shaderSwitches;
             int textures;
@@ -530,8 +542,23 @@ namespace love
         ShaderBase* newShader(const std::vector<std::string>& filepaths,
                               const ShaderBase::CompileOptions& options);
 
+        /* starts reading shader stage files on a worker thread, see ShaderPreloader */
+        void precompileShaders(const std::vector<std::string>& filepaths);
+
+        /* used by ShaderStage in place of reading `filepath` itself */
+        bool takePreloadedShaderStage(const std::string& filepath, std::vector<uint8_t>& code);
+
+        TextureAtlas& getTextureAtlas()
+        {
+            return this->textureAtlas;
+        }
+
         SpriteBatch* newSpriteBatch(TextureBase* texture, int size, BufferDataUsage usage);
 
+        MeshBase* newMesh(const std::vector<XYf_STf_RGBAf>& vertices, MeshDrawMode mode, BufferDataUsage usage);
+
+        MeshBase* newMesh(int vertexCount, MeshDrawMode mode, BufferDataUsage usage);
+
         virtual void initCapabilities() = 0;
 
         TextureBase* getDefaultTexture(TextureBase* texture);
@@ -602,18 +629,80 @@ namespace love
 
         void flushBatchedDraws();
 
+        /* lets batched draws join an earlier batch when they don't overlap what's in between */
+        void setBatchReorderingEnabled(bool enabled);
+
+        bool isBatchReorderingEnabled() const
+        {
+            return this->batchReorderer.isEnabled();
+        }
+
+        /* skips draws whose transformed bounds lie outside the render target and scissor */
+        void setCullingEnabled(bool enabled)
+        {
+            this->culling = enabled;
+        }
+
+        bool isCullingEnabled() const
+        {
+            return this->culling;
+        }
+
+        bool isCulled(const Matrix4& transform, const Vector2& min, const Vector2& max);
+
+        /* the render target (or backbuffer) area left uncovered by the scissor */
+        Rect getVisibleArea() const;
+
+        template<typename V>
+        bool isCulled(const Matrix4& transform, const V* vertices, int count)
+        {
+            if (!this->culling || count <= 0)
+                return false;
+
+            Vector2 min(vertices[0].x, vertices[0].y);
+            Vector2 max = min;
+
+            for (int index = 1; index < count; index++)
+            {
+                min.x = std::min(min.x, vertices[index].x);
+                min.y = std::min(min.y, vertices[index].y);
+                max.x = std::max(max.x, vertices[index].x);
+                max.y = std::max(max.y, vertices[index].y);
+            }
+
+            return this->isCulled(transform, min, max);
+        }
+
         static void flushBatchedDrawsGlobal();
 
         void advanceStreamBuffers();
 
         static void advanceStreamBuffersGlobal();
 
+        /* indices for QUAD_INDEX_BUFFER_QUADS quads, for drawables that keep their own vertices */
+        StreamBuffer<uint16_t>* getQuadIndexBuffer() const
+        {
+            return this->batchedDrawState.quadIndexBuffer;
+        }
+
         virtual void draw(const DrawIndexedCommand& command) = 0;
 
         virtual void draw(const DrawCommand& command) = 0;
 
+        /*
+        ** Backends that defer draws must issue them here. Called before the
+        ** batching stream buffers are released, since queued draws still
+        ** reference them.
+        */
+        virtual void submitDeferredDraws()
+        {}
+
         Stats getStats() const;
 
+        /* lets the backend fill in the counters only it knows about */
+        virtual void getBackendStats(Stats&) const
+        {}
+
         size_t getStackDepth() const
         {
             return this->stackTypeStack.size();
@@ -755,6 +844,8 @@ namespace love
 
         void draw(TextureBase* texture, Quad* quad, const Matrix4& matrix);
 
+        void drawInstanced(MeshBase* mesh, const Matrix4& matrix, int instanceCount);
+
         template<typename T>
         T* getScratchBuffer(size_t count)
         {
@@ -798,6 +889,19 @@ namespace love
       private:
         TextureBase* defaultTextures[TEXTURE_MAX_ENUM];
 
+        BatchedVertexData requestBatchedDrawInternal(const BatchedDrawCommand& command);
+
+        void drainBatchReorderer();
+
+        /* generate(emit) calls emit(x, y) once per vertex, which goes straight into the batch */
+        template<typename Generate>
+        void fillFan(int vertexCount, const Vector2& min, const Vector2& max, Generate&& generate);
+
+        BatchReorderer batchReorderer;
+        bool drainingReorderer;
+
+        bool culling;
+
       protected:
         int calculateEllipsePoints(float a, float b) const;
 
@@ -819,6 +923,11 @@ namespace love
         int pixelHeight;
 
         int drawCallsBatched;
+        int drawCallsMerged;
+        int drawCallsReordered;
+        int batchesMergedByReordering;
+        int drawCallsCulled;
+        int drawCallsIndex32;
         int drawCalls;
 
         BatchedDrawState batchedDrawState;
@@ -830,6 +939,9 @@ namespace love
         Capabilities capabilities;
 
         StrongRef<FontBase> defaultFont;
+        StrongRef<ShaderPreloader> shaderPreloader;
+
+        TextureAtlas textureAtlas;
 
         std::vector<ScreenshotInfo> pendingScreenshotCallbacks;
     };
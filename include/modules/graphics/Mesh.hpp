@@ -1,17 +1,35 @@
 #pragma once
 
+#include "common/Map.hpp"
+#include "common/Range.hpp"
+#include "common/StrongRef.hpp"
+
+#include "driver/graphics/DataBuffer.hpp"
+
 #include "modules/graphics/Drawable.hpp"
-#include "modules/graphics/Texture.hpp"
+#include "modules/graphics/Texture.tcc"
 #include "modules/graphics/vertex.hpp"
 
+#include <string>
+#include <vector>
+
 namespace love
 {
+    class GraphicsBase;
+
+    /*
+    ** Vertices (and optionally a vertex map) kept in GPU buffers that live as
+    ** long as the Mesh. Edits are tracked as dirty ranges and uploaded on the
+    ** next draw, draw ranges only change what is drawn.
+    **
+    ** The GPU copy uses the batching vertex format, getVertex() returns the
+    ** original values.
+    */
     class MeshBase : public Drawable
     {
       public:
         static love::Type type;
 
-        // Alias the global enum for backward compatibility
         using DrawMode = MeshDrawMode;
 
         enum AttributeStep
@@ -30,49 +48,119 @@ namespace love
             AttributeStep step;
         };
 
-        MeshBase(const std::vector<Vertex>& vertices, DrawMode mode, BufferDataUsage usage);
+        MeshBase(const std::vector<XYf_STf_RGBAf>& vertices, DrawMode mode, BufferDataUsage usage);
+
         MeshBase(int vertexCount, DrawMode mode, BufferDataUsage usage);
+
         virtual ~MeshBase();
 
-        virtual void setVertices(const std::vector<Vertex>& vertices);
-        virtual const std::vector<Vertex>& getVertices() const;
-        virtual void setVertex(size_t index, const Vertex& vertex);
-        virtual Vertex getVertex(size_t index) const;
+        /* replaces every vertex, resizing the mesh if the count differs */
+        void setVertices(const std::vector<XYf_STf_RGBAf>& vertices);
+
+        /* overwrites vertices.size() vertices starting at startVertex */
+        void setVertices(const std::vector<XYf_STf_RGBAf>& vertices, size_t startVertex);
+
+        const std::vector<XYf_STf_RGBAf>& getVertices() const;
+
+        void setVertex(size_t index, const XYf_STf_RGBAf& vertex);
+
+        XYf_STf_RGBAf getVertex(size_t index) const;
+
+        void setVertexMap(const std::vector<uint32_t>& map);
+
+        void setVertexMap();
+
+        const std::vector<uint32_t>& getVertexMap() const;
+
+        void setTexture(TextureBase* texture);
+
+        TextureBase* getTexture() const;
+
+        void setDrawMode(DrawMode mode);
+
+        DrawMode getDrawMode() const;
+
+        void setDrawRange(int start, int count);
+
+        void setDrawRange();
 
-        virtual void setVertexMap(const std::vector<uint32_t>& map);
-        virtual void setVertexMap();
-        virtual const std::vector<uint32_t>& getVertexMap() const;
+        bool getDrawRange(int& start, int& count) const;
 
-        virtual void setTexture(TextureBase* texture);
-        virtual TextureBase* getTexture() const;
+        size_t getVertexCount() const;
 
-        virtual void setDrawMode(DrawMode mode);
-        virtual DrawMode getDrawMode() const;
+        /*
+        ** Feeds the standard attribute `name` (VertexPosition, VertexTexCoord or
+        ** VertexColor) of `mesh` to this mesh's draws. Only STEP_PER_INSTANCE is
+        ** supported: shaders read it as inInstancePos, inInstanceTexCoord and
+        ** inInstanceColor, advancing once per instance. All attached attributes
+        ** must come from the same mesh.
+        */
+        void attachAttribute(const std::string& name, MeshBase* mesh, AttributeStep step);
 
-        virtual void setDrawRange(int start, int count);
-        virtual void setDrawRange();
-        virtual bool getDrawRange(int& start, int& count) const;
+        bool detachAttribute(const std::string& name);
 
-        virtual size_t getVertexCount() const;
+        /* uploads pending vertex and vertex map changes */
+        void flush();
 
-        // Implement the draw method from Drawable
         void draw(GraphicsBase* graphics, const Matrix4& transform) override;
 
+        void drawInstanced(GraphicsBase* graphics, const Matrix4& transform, int instanceCount);
+
         static bool getConstant(const char* in, DrawMode& out);
+
         static bool getConstant(DrawMode in, const char*& out);
+
         static std::vector<std::string> getConstants(DrawMode);
 
+        // clang-format off
+        STRINGMAP_DECLARE(AttributeSteps, AttributeStep,
+            { "pervertex",   STEP_PER_VERTEX   },
+            { "perinstance", STEP_PER_INSTANCE }
+        );
+
+        STRINGMAP_DECLARE(BuiltinAttributes, BuiltinVertexAttribute,
+            { "VertexPosition", ATTRIB_POS      },
+            { "VertexTexCoord", ATTRIB_TEXCOORD },
+            { "VertexColor",    ATTRIB_COLOR    }
+        );
+        // clang-format on
+
       protected:
-        std::vector<Vertex> vertices;
+        struct AttachedAttribute
+        {
+            BuiltinVertexAttribute attribute;
+            StrongRef<MeshBase> mesh;
+            AttributeStep step;
+        };
+
+        void createVertexBuffer();
+
+        void drawInternal(GraphicsBase* graphics, const Matrix4& transform, int instanceCount);
+
+        MeshBase* getInstanceMesh() const;
+
+        std::vector<AttachedAttribute> attachedAttributes;
+
+        std::vector<XYf_STf_RGBAf> vertices;
+        std::vector<Vertex> packedVertices;
         std::vector<uint32_t> vertexMap;
+
+        StrongRef<DataBuffer<Vertex>> vertexBuffer;
+        StrongRef<DataBuffer<uint16_t>> indexBuffer;
+        StrongRef<DataBuffer<uint32_t>> indexBuffer32;
+        IndexDataType indexType;
+
+        Range modifiedVertices;
+        bool vertexMapModified;
+
         DrawMode drawMode;
         BufferDataUsage usage;
-        TextureBase* texture;
-        
+        StrongRef<TextureBase> texture;
+
         bool hasDrawRange;
         int drawRangeStart;
         int drawRangeCount;
     };
 
     using Mesh = MeshBase;
-}
+} // namespace love
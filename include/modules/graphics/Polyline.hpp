@@ -68,7 +68,7 @@ namespace love
       protected:
         virtual void calc_overdraw_vertex_count(bool is_looping);
         virtual void render_overdraw(const std::vector<Vector2>& normals, float pixel_size, bool is_looping);
-        virtual void fill_color_array(Color constant_color, XYf_STf_RGBAf* attributes, int count);
+        virtual void fill_color_array(Color32 constant_color, Vertex* attributes, int count);
 
         /** Calculate line boundary points.
          *
@@ -125,7 +125,7 @@ namespace love
       protected:
         void calc_overdraw_vertex_count(bool is_looping) override;
         void render_overdraw(const std::vector<Vector2>& normals, float pixel_size, bool is_looping) override;
-        void fill_color_array(Color constant_color, XYf_STf_RGBAf* attributes, int count) override;
+        void fill_color_array(Color32 constant_color, Vertex* attributes, int count) override;
         void renderEdge(std::vector<Vector2>& anchors, std::vector<Vector2>& normals, Vector2& s,
                         float& len_s, Vector2& ns, const Vector2& q, const Vector2& r, float hw) override;
 
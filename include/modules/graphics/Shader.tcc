@@ -81,6 +81,17 @@ namespace love
             int count;
 
             std::string name;
+
+            /*
+            ** Where send() writes in the uniform staging block, filled in by the
+            ** backend. An element is `columns` vectors of `components` 32-bit
+            ** values; components is 0 for uniforms that can't be sent.
+            */
+            int components;
+            int columns;
+            size_t stride;       //< bytes between array elements
+            size_t columnStride; //< bytes between matrix columns
+            size_t offset[SHADERSTAGE_MAX_ENUM];
         };
 
         static ShaderBase* current;
@@ -96,13 +107,40 @@ namespace love
 
         const UniformInfo* getUniformInfo(const std::string& name) const;
 
+        /* resolved once per load, nullptr when the shader doesn't use it */
+        const UniformInfo* getBuiltinUniformInfo(BuiltinUniform builtin) const
+        {
+            return this->builtinUniformInfo[builtin];
+        }
+
+        /*
+        ** Copies `count` elements of 32-bit values into the staging block of
+        ** every stage using the uniform. Returns false if nothing changed.
+        ** When this shader is active, draws batched so far are flushed first
+        ** so they keep the old values.
+        */
+        bool sendUniform(const UniformInfo* info, const void* values, int count);
+
         virtual void attach() = 0;
 
         static void attachDefault(StandardShader type);
 
         static bool isDefaultActive();
 
+        // clang-format off
+        STRINGMAP_DECLARE(BuiltinUniforms, BuiltinUniform,
+            { "texture0",       BUILTIN_TEXTURE_MAIN      },
+            { "video_y",        BUILTIN_TEXTURE_VIDEO_Y   },
+            { "video_cb",       BUILTIN_TEXTURE_VIDEO_CB  },
+            { "video_cr",       BUILTIN_TEXTURE_VIDEO_CR  },
+            { "Transformation", BUILTIN_UNIFORMS_PER_DRAW }
+        );
+        // clang-format on
+
       protected:
+        /* fills builtinUniformInfo from the reflection data */
+        void mapBuiltinUniforms();
+
         struct Reflection
         {
             std::map<std::string, UniformInfo*> uniforms;
@@ -112,6 +150,10 @@ namespace love
         Reflection reflection;
         UniformInfo* builtinUniformInfo[BUILTIN_MAX_ENUM];
 
+        /* CPU copy of the user uniform blocks; uploaded by the backend when dirty */
+        std::vector<uint8_t> uniformStaging;
+        bool uniformsDirty;
+
         std::array<StrongRef<ShaderStageBase>, SHADERSTAGE_MAX_ENUM> stages;
         std::string debugName;
     };
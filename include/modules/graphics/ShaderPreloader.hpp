@@ -0,0 +1,71 @@
+#pragma once
+
+#include "modules/thread/Threadable.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Reads shader stage files on a worker thread so the main thread only has
+    ** to create the GX2 objects from them. A file is handed out through take()
+    ** once per time it was queued, so a .gsh holding both stages can be queued
+    ** for each; ShaderStage keeps its own copy for volatile reloads.
+    */
+    class ShaderPreloader : public Threadable
+    {
+      public:
+        ShaderPreloader();
+
+        virtual ~ShaderPreloader();
+
+        void run() override;
+
+        /* queues each file (or adds a take to one already queued), starting the worker if it is idle */
+        void enqueue(const std::vector<std::string>& filepaths);
+
+        /*
+        ** Copies the contents of `filepath` into `code`, waiting for the worker
+        ** if it hasn't read it yet. Returns false if the file was never queued
+        ** or couldn't be read.
+        */
+        bool take(const std::string& filepath, std::vector<uint8_t>& code);
+
+        /* drops every file not taken yet, a file still being read is discarded when done */
+        void clear();
+
+        /* stops after the current file and joins the worker */
+        void stop();
+
+      private:
+        enum EntryState
+        {
+            ENTRY_PENDING,
+            ENTRY_LOADED,
+            ENTRY_FAILED
+        };
+
+        struct Entry
+        {
+            EntryState state;
+            int takes;
+            std::vector<uint8_t> code;
+        };
+
+        static bool readFile(const std::string& filepath, std::vector<uint8_t>& code);
+
+        std::map<std::string, Entry> entries;
+        std::deque<std::string> pending;
+
+        bool working;
+        bool stopping;
+
+        std::mutex mutex;
+        std::condition_variable loaded;
+    };
+} // namespace love
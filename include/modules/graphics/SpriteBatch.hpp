@@ -7,9 +7,13 @@
 #include "common/Matrix.hpp"
 #include "common/Range.hpp"
 #include "common/StrongRef.hpp"
+#include "common/Vector.hpp"
 #include "common/math.hpp"
 
+#include "driver/graphics/DataBuffer.hpp"
+
 #include "modules/graphics/Drawable.hpp"
+#include "modules/graphics/SpriteGrid.hpp"
 #include "modules/graphics/vertex.hpp"
 
 namespace love
@@ -59,11 +63,24 @@ namespace love
 
         bool getDrawRange(int& start, int& count) const;
 
+        /* draw only the sprites under the visible area, found through a grid kept on add/set */
+        void setSpatialIndexEnabled(bool enabled);
+
+        bool isSpatialIndexEnabled() const
+        {
+            return this->spatialIndex;
+        }
+
         void draw(GraphicsBase* graphics, const Matrix4& matrix) override;
 
       private:
         void setBufferSize(int newSize);
 
+        void insertSprite(int index);
+
+        /* fills visibleRuns, false if every sprite in the range has to be drawn */
+        bool queryVisibleRuns(GraphicsBase* graphics, const Matrix4& transform, int start, int count);
+
         StrongRef<TextureBase> texture;
 
         int size;
@@ -74,10 +91,22 @@ namespace love
         CommonFormat vertexFormat;
         size_t vertexStride;
 
+        BufferDataUsage usage;
+
+        /* CPU copy of every sprite; modifiedSprites is uploaded to vertexBuffer on flush */
         Range modifiedSprites;
         std::vector<Vertex> buffer;
+        StrongRef<DataBuffer<Vertex>> vertexBuffer;
 
         int rangeStart;
         int rangeCount;
+
+        /* local bounds of every sprite added since the last clear, only ever grown */
+        Vector2 boundsMin;
+        Vector2 boundsMax;
+
+        bool spatialIndex;
+        SpriteGrid grid;
+        std::vector<SpriteGrid::Run> visibleRuns;
     };
 } // namespace love
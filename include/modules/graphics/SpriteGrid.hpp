@@ -0,0 +1,105 @@
+#pragma once
+
+#include "common/Vector.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Uniform grid over the sprites of a SpriteBatch, in the batch's local
+    ** coordinates. A sprite is listed in every cell its bounds touch, so a
+    ** query only visits the cells under the visible region and hands back
+    ** the sprites found there as runs of consecutive indices.
+    **
+    ** The cell size is picked from the first sprite inserted, which suits
+    ** tile maps built from same-sized quads. Sprites spanning too many cells
+    ** are kept in a separate list and returned by every query.
+    */
+    class SpriteGrid
+    {
+      public:
+        struct Run
+        {
+            int start;
+            int count;
+        };
+
+        /* cell edge, in multiples of the first sprite's larger side */
+        static constexpr float CELL_SPRITES = 8.0f;
+        static constexpr float DEFAULT_CELL_SIZE = 64.0f;
+
+        /* drawing the sprites in a gap this small is cheaper than another draw call */
+        static constexpr int MERGE_GAP = 16;
+
+        /* past this, a sprite goes to the large list and a query draws everything */
+        static constexpr int MAX_CELLS = 4096;
+
+        SpriteGrid();
+
+        /* replaces whatever bounds `sprite` had before */
+        void insert(int sprite, const Vector2& min, const Vector2& max);
+
+        void remove(int sprite);
+
+        void clear();
+
+        /*
+        ** Fills `runs` with the sprites in [start, start + count) whose bounds
+        ** may touch [min, max]. Returns false when the query isn't worth doing
+        ** and the whole range should be drawn.
+        */
+        bool query(const Vector2& min, const Vector2& max, int start, int count, std::vector<Run>& runs);
+
+      private:
+        struct CellRange
+        {
+            int x1, y1;
+            int x2, y2;
+
+            bool isValid() const
+            {
+                return x1 <= x2 && y1 <= y2;
+            }
+
+            int64_t getCellCount() const
+            {
+                return int64_t(x2 - x1 + 1) * int64_t(y2 - y1 + 1);
+            }
+        };
+
+        enum Placement : uint8_t
+        {
+            PLACEMENT_NONE,
+            PLACEMENT_CELLS,
+            PLACEMENT_LARGE
+        };
+
+        static uint64_t getKey(int x, int y)
+        {
+            return (uint64_t(uint32_t(x)) << 32) | uint32_t(y);
+        }
+
+        int getCell(float position) const;
+
+        /* false if the bounds aren't finite */
+        bool getCells(const Vector2& min, const Vector2& max, CellRange& range) const;
+
+        static void erase(std::vector<int>& sprites, int sprite);
+
+        float cellSize;
+
+        std::unordered_map<uint64_t, std::vector<int>> cells;
+        std::vector<int> large;
+
+        std::vector<CellRange> ranges;
+        std::vector<Placement> placements;
+
+        /* cells that have held a sprite since the last clear */
+        CellRange occupied;
+
+        std::vector<int> found;
+    };
+} // namespace love
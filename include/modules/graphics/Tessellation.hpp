@@ -0,0 +1,94 @@
+#pragma once
+
+#include "common/Color.hpp"
+#include "common/Matrix.hpp"
+#include "common/Vector.hpp"
+
+#include "modules/graphics/UnitCircle.hpp"
+#include "modules/graphics/vertex.hpp"
+
+namespace love
+{
+    /*
+    ** Outline generators for the curved shapes, read from the UnitCircle
+    ** tables. Each calls emit(x, y) once per point, so the same code fills a
+    ** batch directly or collects the outline for a polygon.
+    */
+    namespace tessellation
+    {
+        inline int getRoundedRectangleCount(int cornerPoints)
+        {
+            return (cornerPoints + 2) * 4;
+        }
+
+        /* each corner is a quarter of one circle table, starting at the top-left */
+        template<typename Emit>
+        void roundedRectangle(float x, float y, float w, float h, float rx, float ry, int cornerPoints,
+                              Emit&& emit)
+        {
+            const int segments = cornerPoints + 1;
+            const auto* circle = UnitCircle::get(segments * 4);
+
+            const Vector2 centers[4] = { Vector2(x + rx, y + ry), Vector2(x + w - rx, y + ry),
+                                         Vector2(x + w - rx, y + h - ry), Vector2(x + rx, y + h - ry) };
+
+            for (int corner = 0; corner < 4; corner++)
+            {
+                for (int index = 0; index <= segments; index++)
+                {
+                    const auto& unit = circle[corner * segments + index];
+                    emit(centers[corner].x - rx * unit.x, centers[corner].y - ry * unit.y);
+                }
+            }
+        }
+
+        /* points + 1 points, the last one closing the outline */
+        template<typename Emit>
+        void ellipse(float x, float y, float a, float b, int points, Emit&& emit)
+        {
+            const auto* circle = UnitCircle::get(points);
+
+            for (int index = 0; index <= points; index++)
+                emit(x + a * circle[index].x, y + b * circle[index].y);
+        }
+
+        /*
+        ** Writes emitted points into a batched vertex stream, transformed as
+        ** they're written so the stream is never read back.
+        */
+        struct VertexWriter
+        {
+            Vertex* stream;
+            const float* e;
+            bool is2D;
+            Color32 color;
+
+            VertexWriter(Vertex* stream, const Matrix4& transform, Color32 color) :
+                stream(stream),
+                e(transform.getElements()),
+                is2D(transform.isAffine2DTransform()),
+                color(color)
+            {}
+
+            void operator()(float px, float py)
+            {
+                if (this->is2D)
+                {
+                    this->stream->x = (e[0] * px) + (e[4] * py) + e[12];
+                    this->stream->y = (e[1] * px) + (e[5] * py) + e[13];
+                }
+                else
+                {
+                    this->stream->x = px;
+                    this->stream->y = py;
+                }
+
+                this->stream->s     = 0;
+                this->stream->t     = 0;
+                this->stream->color = this->color;
+
+                this->stream++;
+            }
+        };
+    } // namespace tessellation
+} // namespace love
@@ -169,6 +169,15 @@ namespace love
             int startLayer;
         };
 
+        /* where a texture packed by TextureAtlas lives in its page, page is null otherwise */
+        struct AtlasRegion
+        {
+            TextureBase* page;
+            Rect rect;
+            Vector2 offset;
+            Vector2 scale;
+        };
+
         static int64_t totalGraphicsMemory;
 
         TextureType getTextureType() const
@@ -309,6 +318,16 @@ namespace love
 
         Quad* getQuad();
 
+        const AtlasRegion& getAtlasRegion() const
+        {
+            return this->atlasRegion;
+        }
+
+        void setAtlasRegion(const AtlasRegion& region)
+        {
+            this->atlasRegion = region;
+        }
+
         virtual ptrdiff_t getRenderTargetHandle() const = 0;
 
         virtual ptrdiff_t getSamplerHandle() const = 0;
@@ -422,6 +441,8 @@ namespace love
         ViewInfo rootView;
         ViewInfo parentView;
 
+        AtlasRegion atlasRegion;
+
       private:
         void validateViewFormats() const;
     };
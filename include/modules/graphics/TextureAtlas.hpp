@@ -0,0 +1,85 @@
+#pragma once
+
+#include "common/StrongRef.hpp"
+
+#include "modules/graphics/Texture.tcc"
+#include "modules/graphics/Volatile.hpp"
+
+#include <vector>
+
+namespace love
+{
+    class GraphicsBase;
+
+    /*
+    ** Opt-in packing of small, static textures into shared pages so that
+    ** drawing different images one after another stays in one batch.
+    **
+    ** A packed texture keeps its own GPU copy for everything that isn't a
+    ** plain draw (meshes, sprite batches, shaders, quads reaching outside the
+    ** image) and TextureBase::draw remaps its texture coordinates into the
+    ** page. Packing trades memory for batching: every packed image is stored
+    ** twice, once on its own and once in a page.
+    **
+    ** Pages are grouped by pixel format and sampler state. Space freed by
+    ** destroyed textures is reused, a page is released when its last texture
+    ** goes away, and unloading volatile resources drops every page.
+    */
+    class TextureAtlas : public Volatile
+    {
+      public:
+        static constexpr int PAGE_SIZE       = 1024;
+        static constexpr int MAX_PACKED_SIZE = 256;
+        static constexpr int PADDING         = 1;
+
+        TextureAtlas();
+
+        virtual ~TextureAtlas();
+
+        void setEnabled(bool enabled);
+
+        bool isEnabled() const
+        {
+            return this->enabled;
+        }
+
+        /* copies a newly created texture into a page, returns false if it doesn't qualify */
+        bool pack(GraphicsBase* graphics, TextureBase* texture, const TextureBase::Slices* slices);
+
+        void remove(TextureBase* texture);
+
+        void clear();
+
+        int getPageCount() const
+        {
+            return (int)this->pages.size();
+        }
+
+        bool loadVolatile() override;
+
+        void unloadVolatile() override;
+
+      private:
+        struct Page
+        {
+            StrongRef<TextureBase> texture;
+            uint64_t samplerKey;
+
+            int x;
+            int y;
+            int rowHeight;
+
+            std::vector<TextureBase*> textures;
+            std::vector<Rect> freeRects;
+        };
+
+        static bool canPack(TextureBase* texture, const TextureBase::Slices* slices);
+
+        static bool allocate(Page& page, int width, int height, Rect& rect);
+
+        Page* createPage(GraphicsBase* graphics, PixelFormat format, const SamplerState& samplerState);
+
+        std::vector<Page> pages;
+        bool enabled;
+    };
+} // namespace love
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "common/Vector.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Shared (cos, sin) tables for tessellating ellipses and rounded corners.
+    **
+    ** A table for N segments holds N + 1 points around the unit circle,
+    ** starting at angle 0, with the last point repeating the first. Tables are
+    ** built on first use. The cache is emptied when it fills up, so returned
+    ** pointers are only valid until the next call to get().
+    */
+    class UnitCircle
+    {
+      public:
+        static constexpr size_t MAX_TABLES = 64;
+
+        static const Vector2* get(int segments);
+
+        static void clear();
+
+      private:
+        static std::unordered_map<int, std::vector<Vector2>> tables;
+    };
+} // namespace love
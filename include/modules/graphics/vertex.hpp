@@ -195,6 +195,7 @@ namespace love
         XYf_STf_RGBAf,  //< 2D position, 2D texture coordinates and 32-bit floating point RGBA color.
         XYf_STus_RGBAf, //< 2D position, 2D unsigned short texture coordinates and 32-bit floating point RGBA
                         // color.
+        XYf_STf_RGBAub, //< 2D position, 2D texture coordinates and 8-bit unorm RGBA color.
         XYf_RGBAf,
         XYf_STPf_RGBAf, //< 2D position, 3D texture coordinates and 32-bit floating point RGBA color.
     };
@@ -237,6 +238,13 @@ namespace love
         Color color;
     };
 
+    struct XYf_STf_RGBAub
+    {
+        float x, y;
+        float s, t;
+        Color32 color;
+    };
+
     struct XYf_STPf_RGBAf
     {
         float x, y;
@@ -244,7 +252,14 @@ namespace love
         Color color;
     };
 
-    using Vertex = XYf_STf_RGBAf;
+    /*
+    ** Format of the batched 2D pipeline (20 bytes). Color is unorm8 and must
+    ** be packed when written. Texture coordinates stay float so repeating
+    ** wrap modes can go outside [0, 1].
+    */
+    using Vertex = XYf_STf_RGBAub;
+
+    static_assert(sizeof(Vertex) == 20, "Batched vertices must stay tightly packed.");
 
     static constexpr size_t VERTEX_SIZE = sizeof(Vertex);
 
@@ -41,4 +41,6 @@ namespace Wrap_Font
     int setFallbacks(lua_State* L);
 
     int getDPIScale(lua_State* L);
+
+    int preload(lua_State* L);
 } // namespace Wrap_Font
@@ -153,7 +153,9 @@ namespace Wrap_Graphics
 
     int draw(lua_State* L);
 
-    // int newMesh(lua_State* L);
+    int drawInstanced(lua_State* L);
+
+    int newMesh(lua_State* L);
 
     int newTextBatch(lua_State* L);
 
@@ -171,6 +173,18 @@ namespace Wrap_Graphics
 
     int setDefaultFilter(lua_State* L);
 
+    int setTextureAtlasEnabled(lua_State* L);
+
+    int isTextureAtlasEnabled(lua_State* L);
+
+    int setBatchReorderingEnabled(lua_State* L);
+
+    int isBatchReorderingEnabled(lua_State* L);
+
+    int setCullingEnabled(lua_State* L);
+
+    int isCullingEnabled(lua_State* L);
+
     int setShader(lua_State* L);
     
     int getShader(lua_State* L);
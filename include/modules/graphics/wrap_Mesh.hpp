@@ -5,23 +5,46 @@
 
 namespace love
 {
-    MeshBase* luax_checkmesh(lua_State* L, int idx);
+    MeshBase* luax_checkmesh(lua_State* L, int index);
+
+    /* reads a {x, y, u, v, r, g, b, a} table */
+    XYf_STf_RGBAf luax_checkmeshvertex(lua_State* L, int index);
+
+    /* reads a table of vertex tables */
+    std::vector<XYf_STf_RGBAf> luax_checkmeshvertices(lua_State* L, int index);
+
     int open_mesh(lua_State* L);
-}
+} // namespace love
 
 namespace Wrap_Mesh
 {
     int setVertices(lua_State* L);
-    int getVertices(lua_State* L);
+
     int setVertex(lua_State* L);
+
     int getVertex(lua_State* L);
+
     int getVertexCount(lua_State* L);
+
     int setVertexMap(lua_State* L);
+
     int getVertexMap(lua_State* L);
+
+    int flush(lua_State* L);
+
     int setTexture(lua_State* L);
+
     int getTexture(lua_State* L);
+
     int setDrawMode(lua_State* L);
+
     int getDrawMode(lua_State* L);
+
     int setDrawRange(lua_State* L);
+
     int getDrawRange(lua_State* L);
-}
+
+    int attachAttribute(lua_State* L);
+
+    int detachAttribute(lua_State* L);
+} // namespace Wrap_Mesh
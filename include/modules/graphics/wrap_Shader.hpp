@@ -1,13 +1,21 @@
 #pragma once
 
-#include <common/luax.hpp>
+#include "common/luax.hpp"
 
 namespace love
 {
     class ShaderBase;
 
-    namespace Wrap_Shader
-    {
-        ShaderBase* CheckShader(lua_State* L, int index);
-    } // namespace Wrap_Shader
+    ShaderBase* luax_checkshader(lua_State* L, int index);
+
+    int open_shader(lua_State* L);
 } // namespace love
+
+namespace Wrap_Shader
+{
+    int send(lua_State* L);
+
+    int hasUniform(lua_State* L);
+
+    int getWarnings(lua_State* L);
+} // namespace Wrap_Shader
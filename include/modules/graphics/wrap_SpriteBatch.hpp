@@ -80,4 +80,8 @@ namespace Wrap_SpriteBatch
     int setDrawRange(lua_State* L);
 
     int getDrawRange(lua_State* L);
+
+    int setSpatialIndexEnabled(lua_State* L);
+
+    int isSpatialIndexEnabled(lua_State* L);
 } // namespace Wrap_SpriteBatch
@@ -5,7 +5,7 @@
 #include "modules/sound/Decoder.hpp"
 
 #define OV_EXCLUDE_STATIC_CALLBACKS
-#if !defined(__WIIU__)
+#if defined(__3DS__) || defined(__SWITCH__)
     #include <tremor/ivorbiscodec.h>
     #include <tremor/ivorbisfile.h>
 #else
@@ -1,20 +1,22 @@
 #pragma once
 
-#include <cstdio>
+#include "common/Logger.hpp"
+
 #include <cstdarg>
 
 namespace love
 {
+    /*
+    ** Legacy entry point kept for existing callers.
+    ** Everything is forwarded to love::Logger; prefer the LOVE_LOG_* macros,
+    ** which are compiled out when logging is disabled.
+    */
     class DebugLogger
     {
-    public:
+      public:
         static void init();
         static void close();
-        static void log(const char* format, ...);
+        static void log(const char* format, ...) LOVE_LOG_FORMAT(1, 2);
         static void logLuaError(const char* error);
-        
-    private:
-        static FILE* logFile;
-        static bool initialized;
     };
-}
+} // namespace love
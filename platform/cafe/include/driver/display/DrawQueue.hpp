@@ -0,0 +1,117 @@
+#pragma once
+
+#include "common/StrongRef.hpp"
+
+#include "driver/graphics/DrawCommand.hpp"
+#include "modules/graphics/Shader.tcc"
+#include "modules/graphics/Texture.tcc"
+
+#include <gx2/enum.h>
+#include <gx2r/buffer.h>
+
+#include <vector>
+
+namespace love
+{
+    struct Uniform;
+
+    /*
+    ** Deferred, per-frame draw list.
+    **
+    ** Graphics::draw records commands here instead of issuing them. GX2 replays
+    ** the list, in recording order, right before any fixed-function state
+    ** changes (blend, scissor, viewport, render target, clear) and at present.
+    ** Adjacent draws with the same shader, texture, primitive mode and buffer
+    ** whose ranges are contiguous are merged into one GX2 draw, and shader,
+    ** texture, vertex buffer and uniform binds that would not change anything
+    ** are skipped. Draws from the shared quad indices are contiguous when their
+    ** vertices are, whatever their base vertex.
+    */
+    class DrawQueue
+    {
+      public:
+        struct Stats
+        {
+            int recorded;
+            int merged;
+            int submitted;
+            int shaderBindsSkipped;
+            int textureBindsSkipped;
+            int uniformBindsSkipped;
+        };
+
+        DrawQueue();
+
+        /*
+        ** Returns true if the command was merged into the previous one.
+        ** `uniform` is a transformation block for this draw only, or nullptr
+        ** to use the one passed to submit(). `userUniforms` is the shader's
+        ** uploaded send() data, see Shader::getUniformUpload.
+        */
+        bool push(const DrawIndexedCommand& command, ShaderBase* shader, Uniform* uniform = nullptr,
+                  const uint8_t* userUniforms = nullptr);
+
+        bool push(const DrawCommand& command, ShaderBase* shader, Uniform* uniform = nullptr,
+                  const uint8_t* userUniforms = nullptr);
+
+        void submit(Uniform* uniform, uint32_t uniformGeneration);
+
+        /* the GX2 context was reset, rebind everything on the next draw */
+        void invalidate();
+
+        bool isEmpty() const
+        {
+            return this->draws.empty();
+        }
+
+        const Stats& getStats() const
+        {
+            return this->stats;
+        }
+
+        void resetStats()
+        {
+            this->stats = {};
+        }
+
+      private:
+        struct Draw
+        {
+            bool indexed;
+            GX2PrimitiveMode mode;
+
+            GX2RBuffer* vertexBuffer;
+            GX2RBuffer* instanceBuffer; //< per-instance attributes, or nullptr
+            GX2RBuffer* indexBuffer;
+            GX2IndexType indexType;
+
+            uint32_t first; //< first index, or first vertex when not indexed
+            uint32_t count;
+            uint32_t baseVertex;
+            uint32_t instanceCount;
+            bool quadIndices; //< see DrawIndexedCommand::quadIndices
+
+            StrongRef<TextureBase> texture;
+            StrongRef<ShaderBase> shader;
+
+            Uniform* uniform;
+            const uint8_t* userUniforms;
+        };
+
+        bool merge(const Draw& draw);
+
+        bool record(Draw& draw);
+
+        std::vector<Draw> draws;
+
+        GX2RBuffer* boundVertexBuffer;
+        GX2RBuffer* boundInstanceBuffer;
+        ShaderBase* boundShader;
+        TextureBase* boundTexture;
+        Uniform* boundUniform;
+        uint32_t boundUniformGeneration;
+        const uint8_t* boundUserUniforms;
+
+        Stats stats;
+    };
+} // namespace love
@@ -3,6 +3,7 @@
 #include "common/Map.hpp"
 #include "common/pixelformat.hpp"
 
+#include "driver/display/DrawQueue.hpp"
 #include "driver/display/Framebuffer.hpp"
 #include "driver/display/Renderer.tcc"
 #include "driver/display/Uniform.hpp"
@@ -12,6 +13,9 @@
 #include <gx2/sampler.h>
 #include <gx2/texture.h>
 
+#include <map>
+#include <memory>
+
 /* Enforces GLSL std140/std430 alignment rules for glm types */
 #define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES
 /* Enables usage of SIMD CPU instructions (requiring the above as well) */
@@ -66,15 +70,44 @@ namespace love
 
         void setVertexWinding(Winding winding);
 
-        void setSamplerState(TextureBase* texture, const SamplerState& state);
+        /* returns the shared sampler `texture` should switch to */
+        GX2Sampler* setSamplerState(TextureBase* texture, const SamplerState& state);
+
+        /* samplers are immutable and shared by every texture with the same state */
+        GX2Sampler* getSampler(const SamplerState& state);
 
         void ensureInFrame();
 
         void prepareDraw(GraphicsBase* graphics);
 
-        void bindTextureToUnit(TextureBase* texture, int unit);
+        void bindTextureToUnit(ShaderBase* shader, TextureBase* texture, int unit);
+
+        void bindTextureToUnit(ShaderBase* shader, GX2Texture* texture, GX2Sampler* sampler, int unit);
+
+        /* returns true if the draw was merged into the previous queued one */
+        bool queueDraw(const DrawIndexedCommand& command);
+
+        bool queueDraw(const DrawCommand& command);
+
+        /* issues every queued draw, must be called before GX2 state is changed */
+        void submitDraws();
+
+        const DrawQueue::Stats& getDrawQueueStats() const
+        {
+            return this->queue.getStats();
+        }
 
-        void bindTextureToUnit(GX2Texture* texture, GX2Sampler* sampler, int unit);
+        /* GX2 state writes this frame, and requests that matched the shadowed state */
+        struct StateStats
+        {
+            int emitted;
+            int skipped;
+        };
+
+        const StateStats& getStateStats() const
+        {
+            return this->stateStats;
+        }
 
         void setMode(int width, int height);
 
@@ -85,6 +118,7 @@ namespace love
             { PIXELFORMAT_R8_UNORM,         GX2_SURFACE_FORMAT_UNORM_R8          },
             { PIXELFORMAT_R16_UNORM,        GX2_SURFACE_FORMAT_UNORM_R16         },
             { PIXELFORMAT_RG8_UNORM,        GX2_SURFACE_FORMAT_UNORM_R8_G8       },
+            { PIXELFORMAT_LA8_UNORM,        GX2_SURFACE_FORMAT_UNORM_R8_G8       },
             { PIXELFORMAT_RGBA8_UNORM,      GX2_SURFACE_FORMAT_UNORM_R8_G8_B8_A8 },
             { PIXELFORMAT_RGB565_UNORM,     GX2_SURFACE_FORMAT_UNORM_R5_G6_B5    },
             { PIXELFORMAT_RGBA8_sRGB,       GX2_SURFACE_FORMAT_SRGB_R8_G8_B8_A8  },
@@ -173,6 +207,35 @@ namespace love
 
         GX2ColorBuffer* getFramebuffer();
 
+        /* a transformation block with `transform` as model-view, valid until the frame is reused */
+        Uniform* getTransformUniform(const Matrix4& transform);
+
+        static void writeUniform(Uniform* destination, const Uniform& source);
+
+        using SamplerKey = std::pair<uint64_t, uint16_t>;
+
+        enum ShadowedState
+        {
+            STATE_CONTEXT,
+            STATE_VIEWPORT,
+            STATE_SCISSOR,
+            STATE_CULL,
+            STATE_COLOR_MASK,
+            STATE_BLEND,
+            STATE_MAX_ENUM
+        };
+
+        static constexpr size_t MAX_TEXTURE_UNITS = 16;
+
+        /* the next request for each state is emitted, whatever the shadow holds */
+        void invalidateState();
+
+        /* returns false, and counts a skip, if `value` is what was last emitted */
+        template<typename T>
+        bool shadowState(ShadowedState state, T& shadow, const T& value);
+
+        void setCullControl(GX2FrontFace winding, bool cullBack, bool cullFront);
+
         struct Context : public ContextBase
         {
             bool cullBack;
@@ -189,6 +252,22 @@ namespace love
         } context;
 
         Uniform* uniform;
+        uint32_t uniformGeneration;
+
+        /* per-draw transformation blocks, recycled after BUFFER_FRAMES frames */
+        std::array<std::vector<Uniform*>, BUFFER_FRAMES> transformUniforms;
+        size_t transformUniformCount;
+        size_t transformUniformFrame;
+
+        DrawQueue queue;
+
+        uint32_t validState;
+        StateStats stateStats;
+
+        std::array<GX2Texture*, MAX_TEXTURE_UNITS> boundTextures;
+        std::array<GX2Sampler*, MAX_TEXTURE_UNITS> boundSamplers;
+
+        std::map<SamplerKey, std::unique_ptr<GX2Sampler>> samplers;
 
         bool inForeground;
 
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "common/Exception.hpp"
+#include "common/Logger.hpp"
+#include "driver/graphics/DataBuffer.tcc"
+
+#include <gx2/mem.h>
+#include <gx2r/buffer.h>
+
+#include <memory>
+
+namespace love
+{
+    template<typename T>
+    class DataBuffer final : public DataBufferBase<T>
+    {
+      public:
+        DataBuffer(BufferUsage mode, BufferDataUsage dataUsage, size_t size) :
+            DataBufferBase<T>(mode, dataUsage, size),
+            backings {}
+        {
+            this->createBacking();
+            this->usedFrames.push_back(0);
+        }
+
+        DataBuffer(DataBuffer&&) = delete;
+
+        DataBuffer& operator=(const DataBuffer&) = delete;
+
+        ~DataBuffer()
+        {
+            for (auto& buffer : this->backings)
+            {
+                if (GX2RBufferExists(buffer.get()))
+                    GX2RDestroyBufferEx(buffer.get(), GX2R_RESOURCE_BIND_NONE);
+            }
+        }
+
+        ptrdiff_t getHandle() const override
+        {
+            return (ptrdiff_t)this->backings[this->active].get();
+        }
+
+      protected:
+        T* lock(size_t backing) override
+        {
+            return (T*)GX2RLockBufferEx(this->backings[backing].get(), GX2R_RESOURCE_BIND_NONE);
+        }
+
+        void unlock(size_t backing, size_t offset, size_t count) override
+        {
+            auto* buffer = this->backings[backing].get();
+
+            /* flush only what was written instead of the whole buffer */
+            GX2RUnlockBufferEx(buffer, GX2R_RESOURCE_DISABLE_CPU_INVALIDATE | GX2R_RESOURCE_DISABLE_GPU_INVALIDATE);
+
+            const auto mode = (this->mode == BUFFERUSAGE_VERTEX) ? GX2_INVALIDATE_MODE_CPU_ATTRIBUTE_BUFFER
+                                                                 : GX2_INVALIDATE_MODE_CPU;
+
+            GX2Invalidate(mode, (T*)buffer->buffer + offset, count * sizeof(T));
+        }
+
+        size_t createBacking() override
+        {
+            /* GX2RBuffer addresses are recorded by queued draws, so they must not move */
+            auto buffer = std::make_unique<GX2RBuffer>();
+
+            buffer->elemCount = this->bufferSize;
+            buffer->elemSize  = sizeof(T);
+            buffer->flags     = getResourceFlags(this->mode, this->dataUsage);
+
+            if (!GX2RCreateBuffer(buffer.get()))
+            {
+                LOVE_LOG_ERROR(GRAPHICS, "GX2RCreateBuffer failed for %zu bytes", this->bufferSize * sizeof(T));
+                throw love::Exception("Failed to create DataBuffer");
+            }
+
+            this->backings.push_back(std::move(buffer));
+            return this->backings.size() - 1;
+        }
+
+      private:
+        static GX2RResourceFlags getResourceFlags(BufferUsage mode, BufferDataUsage dataUsage)
+        {
+            uint32_t flags = GX2R_RESOURCE_USAGE_CPU_WRITE | GX2R_RESOURCE_USAGE_GPU_READ;
+
+            if (mode == BUFFERUSAGE_VERTEX)
+                flags |= GX2R_RESOURCE_BIND_VERTEX_BUFFER;
+            else
+                flags |= GX2R_RESOURCE_BIND_INDEX_BUFFER;
+
+            /* static data is written once and never read back */
+            if (dataUsage != BUFFERDATAUSAGE_STATIC)
+                flags |= GX2R_RESOURCE_USAGE_CPU_READ;
+
+            return (GX2RResourceFlags)flags;
+        }
+
+        std::vector<std::unique_ptr<GX2RBuffer>> backings;
+    };
+} // namespace love
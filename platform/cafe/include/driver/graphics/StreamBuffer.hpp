@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/Logger.hpp"
 #include "driver/graphics/StreamBuffer.tcc"
 #include "modules/graphics/Volatile.hpp"
 
@@ -10,8 +11,6 @@
 #ifdef __WIIU__
 #include <coreinit/memheap.h>
 #include <coreinit/memory.h>
-#include <cstdio>
-#include "debug_log.h"
 #endif
 
 namespace love
@@ -36,18 +35,12 @@ namespace love
             // Wii U memory limit: Cap buffer size to prevent memory allocation failures
             const size_t WII_U_MAX_BUFFER_SIZE = 256 * 1024 * 1024; // 256MB limit
             const size_t requestedSize = size * sizeof(T);
-            
-            char debugMsg[256];
-            sprintf(debugMsg, "StreamBuffer constructor: mode=%d, requested elemCount=%zu, elemSize=%zu, totalSize=%zu bytes", 
-                    (int)mode, size, sizeof(T), requestedSize);
-            wiiu_debug_log_exception(debugMsg);
-            
+
             if (requestedSize > WII_U_MAX_BUFFER_SIZE)
             {
-                sprintf(debugMsg, "StreamBuffer size capped: requested %zu bytes, using %zu bytes (256MB limit)", 
-                        requestedSize, WII_U_MAX_BUFFER_SIZE);
-                wiiu_debug_log_exception(debugMsg);
-                
+                LOVE_LOG_WARN(GRAPHICS, "StreamBuffer size capped: requested %zu bytes, using %zu bytes",
+                              requestedSize, WII_U_MAX_BUFFER_SIZE);
+
                 size = WII_U_MAX_BUFFER_SIZE / sizeof(T);
             }
 #endif
@@ -56,26 +49,14 @@ namespace love
             this->buffer.elemSize  = sizeof(T);
             this->buffer.flags     = flags | BUFFER_CREATE_FLAGS;
 
-#ifdef __WIIU__
-            // Debug logging for buffer creation
-            sprintf(debugMsg, "Creating StreamBuffer: elemCount=%zu, elemSize=%zu, totalSize=%zu bytes, flags=0x%x", 
-                    size, sizeof(T), size * sizeof(T), this->buffer.flags);
-            wiiu_debug_log_exception(debugMsg);
-#endif
+            LOVE_LOG_DEBUG(GRAPHICS, "Creating StreamBuffer: %zu x %zu bytes, flags=0x%x", size, sizeof(T),
+                           (unsigned)this->buffer.flags);
 
             if (!GX2RCreateBuffer(&this->buffer))
             {
-#ifdef __WIIU__
-                sprintf(debugMsg, "GX2RCreateBuffer failed for buffer size %zu bytes", size * sizeof(T));
-                wiiu_debug_log_exception(debugMsg);
-#endif
+                LOVE_LOG_ERROR(GRAPHICS, "GX2RCreateBuffer failed for %zu bytes", size * sizeof(T));
                 throw love::Exception("Failed to create StreamBuffer");
             }
-
-#ifdef __WIIU__
-            sprintf(debugMsg, "StreamBuffer created successfully: %zu bytes", size * sizeof(T));
-            wiiu_debug_log_exception(debugMsg);
-#endif
         }
 
         StreamBuffer(StreamBuffer&&) = delete;
@@ -56,6 +56,10 @@ namespace love
 
         void draw(const DrawCommand& command) override;
 
+        void submitDeferredDraws() override;
+
+        void getBackendStats(Stats& stats) const override;
+
         using GraphicsBase::draw;
 
         void unsetMode() override;
@@ -4,8 +4,13 @@
 #include "modules/graphics/Shader.tcc"
 #include "modules/graphics/Volatile.hpp"
 
+#include "driver/graphics/StreamBuffer.tcc"
+
 #include <whb/gfx.h>
 
+#include <array>
+#include <vector>
+
 #include "driver/display/Uniform.hpp"
 
 namespace love
@@ -25,20 +30,51 @@ namespace love
 
         void attach() override;
 
+        /* binds the GX2 program, called when the draw queue is submitted */
+        void bind();
+
         std::string getWarnings() const;
 
-        void updateBuiltinUniforms(GraphicsBase* graphics, Uniform* uniform);
+        void updateBuiltinUniforms(Uniform* uniform);
+
+        /*
+        ** GPU copy of the user uniform blocks for draws recorded now, or
+        ** nullptr if the shader has none. Only copies when send() changed
+        ** something since the last call this frame.
+        */
+        const uint8_t* getUniformUpload();
+
+        void bindUniforms(const uint8_t* upload);
 
         ptrdiff_t getHandle() const override;
 
       private:
+        struct StagedBlock
+        {
+            ShaderStageType stage;
+            uint32_t location;
+            size_t offset; //< in uniformStaging
+            size_t size;
+        };
+
         void mapActiveUniforms();
 
-        bool setShaderStages(WHBGfxShaderGroup* group, std::array<StrongRef<ShaderStageBase>, 2> stages);
+        template<typename T>
+        void mapUniformBlocks(const T* shader, ShaderStageType stage);
+
+        void freeUniformUploads();
+
+        void initInstanceAttribute(const char* name, uint32_t offset, GX2AttribFormat format);
 
-        static constexpr auto INVALIDATE_UNIFORM_BLOCK =
-            GX2_INVALIDATE_MODE_CPU | GX2_INVALIDATE_MODE_UNIFORM_BLOCK;
+        bool setShaderStages(WHBGfxShaderGroup* group, std::array<StrongRef<ShaderStageBase>, 2> stages);
 
         WHBGfxShaderGroup program;
+
+        std::vector<StagedBlock> stagedBlocks;
+
+        std::array<std::vector<uint8_t*>, BUFFER_FRAMES> uniformUploads;
+        size_t uniformUploadCount;
+        uint32_t uniformUploadFrame;
+        const uint8_t* uniformUpload;
     };
 } // namespace love
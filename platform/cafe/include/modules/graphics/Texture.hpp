@@ -41,6 +41,6 @@ namespace love
 
         GX2Texture* texture    = nullptr;
         GX2ColorBuffer* target = nullptr;
-        GX2Sampler sampler;
+        GX2Sampler* sampler; //< owned by GX2's sampler cache
     };
 } // namespace love
@@ -1,7 +1,7 @@
 #include "boot.hpp"
 #include "common/Console.hpp"
 #include "common/service.hpp"
-#include "DebugLogger.hpp"
+#include "common/Logger.hpp"
 
 #include "driver/EventQueue.hpp"
 
@@ -73,85 +73,37 @@ namespace love
 
     int preInit()
     {
-        // Initialize debug logger (safe to call multiple times)
-        DebugLogger::init();
-        DebugLogger::log("=== PREINIT STARTED ===");
-        DebugLogger::log("preInit() called - beginning service initialization");
+        LOVE_LOG_INFO(CORE, "=== PREINIT STARTED ===");
 
         /* we aren't running Aroma */
         // if (getApplicationPath().empty())
         //     return -1;
 
         // Initialize services first without loading screen
-        DebugLogger::log("About to initialize %zu services", services.size());
-        
         int serviceCount = 0;
         for (const auto& service : services)
         {
-            DebugLogger::log("=== SERVICE INIT: %s ===", service.name);
-            DebugLogger::log("About to initialize service: %s", service.name);
-            
-#ifdef __WIIU__
-            // Also log to simple file for Cemu debugging
-            FILE* serviceLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (serviceLog) {
-                fprintf(serviceLog, "=== INITIALIZING SERVICE: %s ===\n", service.name);
-                fflush(serviceLog);
-                fclose(serviceLog);
-            }
-#endif
-            
             auto result = service.init();
             if (!result.success())
             {
-                DebugLogger::log("FAILED to initialize service: %s", service.name);
-#ifdef __WIIU__
-                FILE* serviceErrorLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (serviceErrorLog) {
-                    fprintf(serviceErrorLog, "FAILED TO INITIALIZE SERVICE: %s\n", service.name);
-                    fflush(serviceErrorLog);
-                    fclose(serviceErrorLog);
-                }
-#endif
+                LOVE_LOG_ERROR(CORE, "Failed to initialize service: %s", service.name);
                 return -1;
             }
-            DebugLogger::log("SUCCESS: Service %s initialized successfully", service.name);
             serviceCount++;
-            
-#ifdef __WIIU__
-            FILE* serviceOkLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (serviceOkLog) {
-                fprintf(serviceOkLog, "SUCCESS: Service %s initialized (%d/%zu)\n", service.name, serviceCount, services.size());
-                fflush(serviceOkLog);
-                fclose(serviceOkLog);
-            }
-#endif
+
+            LOVE_LOG_INFO(CORE, "Service %s initialized (%d/%zu)", service.name, serviceCount, services.size());
         }
 
-        DebugLogger::log("All %d services initialized successfully", serviceCount);
+        LOVE_LOG_INFO(CORE, "All %d services initialized successfully", serviceCount);
 
         // CEMU COMPATIBILITY: These functions cause problems in Cemu emulator
         // Commenting them out for better compatibility
-        DebugLogger::log("Skipping WPAD functions for Cemu compatibility");
         // WPADEnableWiiRemote(true);
         // WPADEnableURCC(true);
-        DebugLogger::log("WPAD functions skipped for Cemu compatibility");
 
-        DebugLogger::log("About to set main core ID");
         Console::setMainCoreId(OSGetCoreId());
-        DebugLogger::log("Main core ID set to: %u", OSGetCoreId());
+        LOVE_LOG_INFO(CORE, "Main core ID set to: %u", (unsigned)OSGetCoreId());
 
-        DebugLogger::log("=== PREINIT COMPLETED SUCCESSFULLY ===");
-        
-#ifdef __WIIU__
-        FILE* completedLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (completedLog) {
-            fprintf(completedLog, "=== PREINIT COMPLETED SUCCESSFULLY ===\n");
-            fflush(completedLog);
-            fclose(completedLog);
-        }
-#endif
-        
         return 0;
     }
 
@@ -246,130 +198,35 @@ namespace love
 
     static bool isRunning()
     {
-#ifdef __WIIU__
-        FILE* logFile_start = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile_start) {
-            fprintf(logFile_start, "isRunning(): Function entered\n");
-            fflush(logFile_start);
-            fclose(logFile_start);
-        }
-        
-        FILE* logFile_main = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile_main) {
-            fprintf(logFile_main, "isRunning(): About to call OSGetMainCoreId()\n");
-            fflush(logFile_main);
-            fclose(logFile_main);
-        }
-#endif
-
         uint32_t mainCoreId = OSGetMainCoreId();
-        
-#ifdef __WIIU__
-        FILE* logFile_core = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile_core) {
-            fprintf(logFile_core, "isRunning(): OSGetMainCoreId() returned %u\n", mainCoreId);
-            fflush(logFile_core);
-            fclose(logFile_core);
-        }
-        
-        FILE* logFile_check = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile_check) {
-            fprintf(logFile_check, "isRunning(): About to call Console::isMainCoreId()\n");
-            fflush(logFile_check);
-            fclose(logFile_check);
-        }
-#endif
 
         if (!Console::isMainCoreId(mainCoreId))
         {
-#ifdef __WIIU__
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "isRunning(): Not main core, calling ProcUISubProcessMessages(false)\n");
-                fflush(logFile);
-                fclose(logFile);
-            }
-#endif
             ProcUISubProcessMessages(false);
             return true;
         }
 
         const auto status = ProcUIProcessMessages(false);
 
-#ifdef __WIIU__
-        FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile2) {
-            fprintf(logFile2, "isRunning(): ProcUIProcessMessages(false) returned status: %d\n", status);
-            fflush(logFile2);
-            fclose(logFile2);
-        }
-#endif
-
         switch (status)
         {
             case PROCUI_STATUS_IN_FOREGROUND:
-#ifdef __WIIU__
-                {
-                    FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                    if (logFile3) {
-                        fprintf(logFile3, "isRunning(): PROCUI_STATUS_IN_FOREGROUND - sending focus(true)\n");
-                        fflush(logFile3);
-                        fclose(logFile3);
-                    }
-                }
-#endif
                 EventQueue::getInstance().sendFocus(true);
                 break;
             case PROCUI_STATUS_RELEASE_FOREGROUND:
-#ifdef __WIIU__
-                {
-                    FILE* logFile4 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                    if (logFile4) {
-                        fprintf(logFile4, "isRunning(): PROCUI_STATUS_RELEASE_FOREGROUND - sending focus(false)\n");
-                        fflush(logFile4);
-                        fclose(logFile4);
-                    }
-                }
-#endif
+                LOVE_LOG_DEBUG(CORE, "isRunning(): PROCUI_STATUS_RELEASE_FOREGROUND - sending focus(false)");
                 EventQueue::getInstance().sendFocus(false);
                 ProcUIDrawDoneRelease();
                 break;
             case PROCUI_STATUS_EXITING:
-#ifdef __WIIU__
-                {
-                    FILE* logFile5 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                    if (logFile5) {
-                        fprintf(logFile5, "isRunning(): PROCUI_STATUS_EXITING - returning false!\n");
-                        fflush(logFile5);
-                        fclose(logFile5);
-                    }
-                }
-#endif
+                LOVE_LOG_INFO(CORE, "isRunning(): PROCUI_STATUS_EXITING");
                 EventQueue::getInstance().sendQuit();
                 return false;
             default:
-#ifdef __WIIU__
-                {
-                    FILE* logFile6 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                    if (logFile6) {
-                        fprintf(logFile6, "isRunning(): Unknown ProcUI status: %d (falling through to return true)\n", status);
-                        fflush(logFile6);
-                        fclose(logFile6);
-                    }
-                }
-#endif
+                LOVE_LOG_DEBUG(CORE, "isRunning(): Unknown ProcUI status: %d", status);
                 break;
         }
 
-#ifdef __WIIU__
-        FILE* logFile7 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile7) {
-            fprintf(logFile7, "isRunning(): returning true\n");
-            fflush(logFile7);
-            fclose(logFile7);
-        }
-#endif
-
         return true;
     }
 
@@ -381,29 +238,13 @@ namespace love
         if (lua_istable(L, -1)) {
             lua_getfield(L, -1, "run");
             if (lua_isfunction(L, -1)) {
-                DebugLogger::log("User-defined love.run detected: using user main loop");
-#ifdef __WIIU__
-                FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile) {
-                    fprintf(logFile, "User-defined love.run detected: using user main loop\n");
-                    fflush(logFile);
-                    fclose(logFile);
-                }
-#endif
+                LOVE_LOG_INFO(CORE, "User-defined love.run detected: using user main loop");
             } else {
-                DebugLogger::log("No user-defined love.run: using default main loop");
-#ifdef __WIIU__
-                FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile) {
-                    fprintf(logFile, "No user-defined love.run: using default main loop\n");
-                    fflush(logFile);
-                    fclose(logFile);
-                }
-#endif
+                LOVE_LOG_INFO(CORE, "No user-defined love.run: using default main loop");
             }
             lua_pop(L, 1); // pop love.run
         } else {
-            DebugLogger::log("No global 'love' table found in Lua state");
+            LOVE_LOG_INFO(CORE, "No global 'love' table found in Lua state");
         }
         lua_pop(L, 1); // pop love
     }
@@ -415,190 +256,26 @@ namespace love
             logWhichLoveRun(L);
             checkedLoveRun = true;
         }
-        DebugLogger::log("mainLoop() called with argc=%d, shutdown=%s", argc, s_Shutdown ? "true" : "false");
-        
-#ifdef __WIIU__
-        // Additional simple logging for debugging freeze
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "mainLoop() entered, about to check shutdown\n");
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
-        
         // Check if running first before anything else
-#ifdef __WIIU__
-        FILE* logFile_pre = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile_pre) {
-            fprintf(logFile_pre, "About to call isRunning()...\n");
-            fflush(logFile_pre);
-            fclose(logFile_pre);
-        }
-#endif
-        
         bool running = true; // BYPASS isRunning() - force true
-        
-#ifdef __WIIU__
-        FILE* logFile0 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile0) {
-            fprintf(logFile0, "BYPASSED isRunning() - forced to: %s\n", running ? "true" : "false");
-            fflush(logFile0);
-            fclose(logFile0);
-        }
-#endif
-        
+
         if (!running)
-        {
-#ifdef __WIIU__
-            FILE* logFileExit = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFileExit) {
-                fprintf(logFileExit, "isRunning() is false, returning false from mainLoop()\n");
-                fflush(logFileExit);
-                fclose(logFileExit);
-            }
-#endif
             return false;
-        }
-        
+
         if (!s_Shutdown)
         {
-#ifdef __WIIU__
-            FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile2) {
-                fprintf(logFile2, "Not shutdown, about to call luax_resume()\n");
-                fflush(logFile2);
-                fclose(logFile2);
-            }
-#endif
-            DebugLogger::log("About to call luax_resume()...");
-            
-            // Pre-execution stack analysis
             int preStackTop = lua_gettop(L);
-            DebugLogger::log("Pre-execution stack analysis: %d items", preStackTop);
-            
-#ifdef __WIIU__
-            FILE* preLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (preLog) {
-                fprintf(preLog, "=== PRE-EXECUTION STACK ANALYSIS ===\n");
-                fprintf(preLog, "Stack has %d items before luax_resume()\n", preStackTop);
-                
-                for (int i = 1; i <= preStackTop; i++) {
-                    int type = lua_type(L, i);
-                    const char* typeName = lua_typename(L, type);
-                    fprintf(preLog, "Pre-Stack[%d]: %s", i, typeName);
-                    
-                    if (type == LUA_TSTRING) {
-                        const char* str = lua_tostring(L, i);
-                        if (str) fprintf(preLog, " = \"%s\"", str);
-                    } else if (type == LUA_TNUMBER) {
-                        double num = lua_tonumber(L, i);
-                        fprintf(preLog, " = %g", num);
-                    } else if (type == LUA_TBOOLEAN) {
-                        int b = lua_toboolean(L, i);
-                        fprintf(preLog, " = %s", b ? "true" : "false");
-                    } else if (type == LUA_TFUNCTION) {
-                        lua_Debug ar;
-                        lua_pushvalue(L, i); // Copy function to stack top
-                        if (lua_getinfo(L, ">n", &ar)) {
-                            fprintf(preLog, " (function: %s)", ar.name ? ar.name : "anonymous");
-                        }
-                    }
-                    fprintf(preLog, "\n");
-                }
-                
-                // Check what's at the top of the stack (what we're trying to resume)
-                if (preStackTop > 0) {
-                    int topType = lua_type(L, preStackTop);
-                    fprintf(preLog, "Top of stack (resume target): %s\n", lua_typename(L, topType));
-                    
-                    // CRITICAL: Check if we're trying to resume a non-thread
-                    if (topType != LUA_TTHREAD) {
-                        fprintf(preLog, "ERROR: Attempting to resume a %s instead of a thread!\n", lua_typename(L, topType));
-                        fprintf(preLog, "This will cause 'attempt to call a boolean value' error.\n");
-                        
-                        // Look for the actual thread in the stack
-                        for (int k = 1; k <= preStackTop; k++) {
-                            if (lua_type(L, k) == LUA_TTHREAD) {
-                                fprintf(preLog, "Found thread at stack position %d\n", k);
-                                lua_State* foundThread = lua_tothread(L, k);
-                                if (foundThread) {
-                                    int threadStatus = lua_status(foundThread);
-                                    fprintf(preLog, "Thread status: %d\n", threadStatus);
-                                }
-                                break;
-                            }
-                        }
-                    } else {
-                        // It's a thread, analyze it
-                        lua_State* thread = lua_tothread(L, preStackTop);
-                        if (thread) {
-                            int status = lua_status(thread);
-                            switch (status) {
-                                case 0: fprintf(preLog, "OK/SUSPENDED"); break;
-                                case 1: fprintf(preLog, "YIELDED"); break; // LUA_YIELD
-                                case LUA_ERRRUN: fprintf(preLog, "RUNTIME_ERROR"); break;
-                                case LUA_ERRSYNTAX: fprintf(preLog, "SYNTAX_ERROR"); break;
-                                case LUA_ERRMEM: fprintf(preLog, "MEMORY_ERROR"); break;
-                                case LUA_ERRERR: fprintf(preLog, "ERROR_HANDLER_ERROR"); break;
-                                default: fprintf(preLog, "UNKNOWN(%d)", status); break;
-                            }
-                            fprintf(preLog, "\n");
-                            
-                            // Check thread stack
-                            int threadStackTop = lua_gettop(thread);
-                            fprintf(preLog, "Thread stack has %d items\n", threadStackTop);
-                            for (int j = 1; j <= threadStackTop && j <= 5; j++) {
-                                int threadType = lua_type(thread, j);
-                                fprintf(preLog, "  Thread[%d]: %s", j, lua_typename(thread, threadType));
-                                if (threadType == LUA_TBOOLEAN) {
-                                    int b = lua_toboolean(thread, j);
-                                    fprintf(preLog, " = %s", b ? "true" : "false");
-                                }
-                                fprintf(preLog, "\n");
-                            }
-                        }
-                    }
-                }
-                
-                fprintf(preLog, "=== END PRE-EXECUTION ANALYSIS ===\n");
-                fflush(preLog);
-                fclose(preLog);
-            }
-#endif
-            
+
             // SAFETY CHECK: Verify we're resuming a thread, not a boolean
             if (preStackTop > 0) {
                 int topType = lua_type(L, preStackTop);
                 if (topType != LUA_TTHREAD) {
-                    DebugLogger::log("CRITICAL ERROR: Attempting to resume %s instead of thread!", lua_typename(L, topType));
-                    
-#ifdef __WIIU__
-                    FILE* errorLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-                    if (errorLog) {
-                        fprintf(errorLog, "=== CRITICAL STACK ERROR DETECTED ===\n");
-                        fprintf(errorLog, "Attempting to resume %s instead of thread!\n", lua_typename(L, topType));
-                        fprintf(errorLog, "This would cause 'attempt to call a boolean value' error.\n");
-                        
-                        // Show the problematic stack
-                        for (int i = 1; i <= preStackTop; i++) {
-                            int type = lua_type(L, i);
-                            fprintf(errorLog, "Stack[%d]: %s", i, lua_typename(L, type));
-                            if (type == LUA_TBOOLEAN) {
-                                int b = lua_toboolean(L, i);
-                                fprintf(errorLog, " = %s", b ? "true" : "false");
-                            }
-                            fprintf(errorLog, "\n");
-                        }
-                        
-                        fprintf(errorLog, "=== STACK ERROR PREVENTION ===\n");
-                        fflush(errorLog);
-                        fclose(errorLog);
-                    }
-#endif
-                    
+                    LOVE_LOG_ERROR(LUA, "Attempting to resume %s instead of thread!", lua_typename(L, topType));
+
+                    for (int i = 1; i <= preStackTop; i++)
+                        LOVE_LOG_ERROR(LUA, "  Stack[%d]: %s", i, luaL_typename(L, i));
+
                     // Emergency exit instead of crashing
-                    DebugLogger::log("Emergency exit to prevent Lua crash");
                     SYSLaunchMenu();
                     s_Shutdown = true;
                     return false;
@@ -606,64 +283,14 @@ namespace love
             }
             
             const auto resumeResult = luax_resume(L, argc, nres);
-#ifdef __WIIU__
-            FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile3) {
-                fprintf(logFile3, "luax_resume() returned, result=%d\n", resumeResult);
-                fflush(logFile3);
-                fclose(logFile3);
-            }
-#endif
-            DebugLogger::log("luax_resume() returned %d", resumeResult);
-            
             const auto yielding = (resumeResult == 1); // LUA_YIELD
-            DebugLogger::log("yielding = %s", yielding ? "true" : "false");
 
             if (!yielding)
             {
-                DebugLogger::log("=== CRITICAL: LUA THREAD COMPLETED/ERROR ===");
-                DebugLogger::log("luax_resume returned %d (not yielding)", resumeResult);
-                
-#ifdef __WIIU__
-                FILE* criticalLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (criticalLog) {
-                    fprintf(criticalLog, "=== CRITICAL: LUA THREAD COMPLETED/ERROR ===\n");
-                    fprintf(criticalLog, "luax_resume returned %d (not yielding)\n", resumeResult);
-                    
-                    if (resumeResult == 0) {
-                        fprintf(criticalLog, "LUA_OK: The main loop function COMPLETED instead of yielding!\n");
-                        fprintf(criticalLog, "This is why Lua execution stops after loading.\n");
-                        fprintf(criticalLog, "The love.run() function should yield continuously, not return.\n");
-                    } else {
-                        fprintf(criticalLog, "Lua error occurred: %d\n", resumeResult);
-                    }
-                    
-                    fflush(criticalLog);
-                    fclose(criticalLog);
-                }
-#endif
-                DebugLogger::log("=== THREAD COMPLETED ANALYSIS ===");
-                DebugLogger::log("Resume result: %d (0=LUA_OK, 1=LUA_YIELD, 2=LUA_ERRRUN)", resumeResult);
-                
-                if (resumeResult == 0) { // LUA_OK
-                    DebugLogger::log("DIAGNOSIS: Lua thread completed normally (returned)");
-                    DebugLogger::log("This means the boot function finished executing and returned a value");
-                    DebugLogger::log("Expected: Thread should yield indefinitely, not complete");
-                    DebugLogger::log("CAUSE: The main loop in boot.lua exited instead of yielding");
-                }
-                
+                LOVE_LOG_WARN(LUA, "Lua thread stopped yielding (luax_resume returned %d)", resumeResult);
+
                 // FALLBACK LOOP: When Lua stops, show a diagnostic black screen with text
-                DebugLogger::log("=== ENTERING C++ FALLBACK LOOP ===");
-                DebugLogger::log("Lua has stopped running. Displaying diagnostic screen.");
-                
 #ifdef __WIIU__
-                FILE* fallbackLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (fallbackLog) {
-                    fprintf(fallbackLog, "=== ENTERING C++ FALLBACK LOOP ===\n");
-                    fprintf(fallbackLog, "Displaying black screen with diagnostic text\n");
-                    fflush(fallbackLog);
-                    fclose(fallbackLog);
-                }
                 
                 // Initialize OSScreen for fallback display
                 static bool fallbackScreenInited = false;
@@ -754,29 +381,11 @@ namespace love
                     
                     fallbackFrameCount++;
                     
-                    // Log every 60 frames
-                    if (fallbackFrameCount % 60 == 0) {
-                        FILE* fallbackFrameLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-                        if (fallbackFrameLog) {
-                            fprintf(fallbackFrameLog, "Fallback loop frame %d\n", fallbackFrameCount);
-                            fflush(fallbackFrameLog);
-                            fclose(fallbackFrameLog);
-                        }
-                    }
-                    
                     // Small delay to prevent excessive CPU usage
                     OSSleepTicks(OSMillisecondsToTicks(16)); // ~60 FPS
                 }
                 
-                DebugLogger::log("=== EXITING C++ FALLBACK LOOP ===");
-                
-                FILE* exitLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (exitLog) {
-                    fprintf(exitLog, "=== EXITING C++ FALLBACK LOOP ===\n");
-                    fprintf(exitLog, "Fallback loop ran for %d frames\n", fallbackFrameCount);
-                    fflush(exitLog);
-                    fclose(exitLog);
-                }
+                LOVE_LOG_INFO(CORE, "Fallback loop ran for %d frames", fallbackFrameCount);
 #endif
                 // Check if there was a Lua error
                 if (resumeResult != 0) // LUA_OK is 0, any non-zero value is an error
@@ -933,11 +542,11 @@ namespace love
                         }
                     }
                     
-                    DebugLogger::log("=== ENHANCED LUA ERROR REPORT ===");
-                    DebugLogger::log("Error Type: %s (code: %d)", errorTypeStr, resumeResult);
-                    DebugLogger::log("Error Message: %s", errorText.c_str());
-                    DebugLogger::log("Current Function: %s", currentFunction.c_str());
-                    DebugLogger::log("Stack Info: %s", fullStackDump.c_str());
+                    LOVE_LOG_ERROR(LUA, "=== ENHANCED LUA ERROR REPORT ===");
+                    LOVE_LOG_ERROR(LUA, "Error Type: %s (code: %d)", errorTypeStr, resumeResult);
+                    LOVE_LOG_ERROR(LUA, "Error Message: %s", errorText.c_str());
+                    LOVE_LOG_ERROR(LUA, "Current Function: %s", currentFunction.c_str());
+                    LOVE_LOG_ERROR(LUA, "Stack Info: %s", fullStackDump.c_str());
                     
                     // ENHANCED: Write to console (stderr) and stdout for maximum visibility
                     fprintf(stderr, "\n=== LUA ERROR DETECTED ===\n");
@@ -968,11 +577,11 @@ namespace love
                     
                     // Special analysis for "attempt to call a boolean value" error
                     if (strstr(errorText.c_str(), "attempt to call a boolean value")) {
-                        DebugLogger::log("DIAGNOSIS: This error typically occurs when:");
-                        DebugLogger::log("1. A boolean value is being called as a function");
-                        DebugLogger::log("2. Wrong stack item is being resumed (boolean instead of thread)");
-                        DebugLogger::log("3. Function was overwritten with boolean value");
-                        DebugLogger::log("4. Module loading issue where function becomes boolean");
+                        LOVE_LOG_ERROR(LUA, "DIAGNOSIS: This error typically occurs when:");
+                        LOVE_LOG_ERROR(LUA, "1. A boolean value is being called as a function");
+                        LOVE_LOG_ERROR(LUA, "2. Wrong stack item is being resumed (boolean instead of thread)");
+                        LOVE_LOG_ERROR(LUA, "3. Function was overwritten with boolean value");
+                        LOVE_LOG_ERROR(LUA, "4. Module loading issue where function becomes boolean");
                         
                         printf("DIAGNOSIS: This error typically occurs when:\n");
                         printf("1. A boolean value is being called as a function\n");
@@ -983,10 +592,10 @@ namespace love
                     
                     // Special analysis for "attempt to index field" error
                     if (strstr(errorText.c_str(), "attempt to index field")) {
-                        DebugLogger::log("DIAGNOSIS: This error typically occurs when:");
-                        DebugLogger::log("1. Trying to access a field on a nil value");
-                        DebugLogger::log("2. Missing table or object initialization");
-                        DebugLogger::log("3. Shader or resource not loaded properly");
+                        LOVE_LOG_ERROR(LUA, "DIAGNOSIS: This error typically occurs when:");
+                        LOVE_LOG_ERROR(LUA, "1. Trying to access a field on a nil value");
+                        LOVE_LOG_ERROR(LUA, "2. Missing table or object initialization");
+                        LOVE_LOG_ERROR(LUA, "3. Shader or resource not loaded properly");
                         
                         printf("DIAGNOSIS: This error typically occurs when:\n");
                         printf("1. Trying to access a field on a nil value\n");
@@ -995,87 +604,34 @@ namespace love
                     }
                     
                     if (!stackFrames.empty()) {
-                        DebugLogger::log("Stack Frames:\n%s", stackFrames.c_str());
+                        LOVE_LOG_ERROR(LUA, "Stack Frames:\n%s", stackFrames.c_str());
                         printf("Stack Frames:\n%s\n", stackFrames.c_str());
                     }
                     if (!threadAnalysis.empty()) {
-                        DebugLogger::log("Thread Analysis:\n%s", threadAnalysis.c_str());
+                        LOVE_LOG_ERROR(LUA, "Thread Analysis:\n%s", threadAnalysis.c_str());
                         printf("Thread Analysis:\n%s\n", threadAnalysis.c_str());
                     }
                     if (!traceback.empty()) {
-                        DebugLogger::log("Full Traceback: %s", traceback.c_str());
+                        LOVE_LOG_ERROR(LUA, "Full Traceback: %s", traceback.c_str());
                         printf("Full Traceback: %s\n", traceback.c_str());
                     }
                     
 #ifdef __WIIU__
-                    // Log to simple debug file with enhanced information
-                    FILE* crashLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-                    if (crashLog) {
-                        fprintf(crashLog, "=== ENHANCED LUA CRASH REPORT ===\n");
-                        fprintf(crashLog, "Error Type: %s (code: %d)\n", errorTypeStr, resumeResult);
-                        fprintf(crashLog, "Error Message: %s\n", errorText.c_str());
-                        fprintf(crashLog, "Current Function: %s\n", currentFunction.c_str());
-                        fprintf(crashLog, "Stack Info: %s\n", fullStackDump.c_str());
-                        
-                        // Special diagnosis for boolean call error
-                        if (strstr(errorText.c_str(), "attempt to call a boolean value")) {
-                            fprintf(crashLog, "=== BOOLEAN CALL ERROR DIAGNOSIS ===\n");
-                            fprintf(crashLog, "This error occurs when:\n");
-                            fprintf(crashLog, "1. A boolean value is called as function: someBoolean()\n");
-                            fprintf(crashLog, "2. Wrong stack item resumed (boolean instead of thread)\n");
-                            fprintf(crashLog, "3. Function overwritten with boolean value\n");
-                            fprintf(crashLog, "4. Module loading issue (function -> boolean)\n");
-                            fprintf(crashLog, "5. Incorrect stack manipulation in C code\n");
-                            fprintf(crashLog, "=== END DIAGNOSIS ===\n");
-                        }
-                        
-                        // Log detailed stack contents
-                        fprintf(crashLog, "=== STACK CONTENTS ===\n");
-                        for (int i = 1; i <= stackTop; i++) {
-                            int type = lua_type(L, i);
-                            const char* typeName = lua_typename(L, type);
-                            fprintf(crashLog, "Stack[%d]: %s", i, typeName);
-                            
-                            if (type == LUA_TSTRING) {
-                                const char* str = lua_tostring(L, i);
-                                if (str) fprintf(crashLog, " = \"%s\"", str);
-                            } else if (type == LUA_TNUMBER) {
-                                double num = lua_tonumber(L, i);
-                                fprintf(crashLog, " = %g", num);
-                            } else if (type == LUA_TBOOLEAN) {
-                                int b = lua_toboolean(L, i);
-                                fprintf(crashLog, " = %s", b ? "true" : "false");
-                            }
-                            fprintf(crashLog, "\n");
-                        }
-                        
-                        // Log detailed stack frames
-                        if (!stackFrames.empty()) {
-                            fprintf(crashLog, "=== STACK FRAMES ===\n");
-                            fprintf(crashLog, "%s", stackFrames.c_str());
-                        }
-                        
-                        // Log thread analysis
-                        if (!threadAnalysis.empty()) {
-                            fprintf(crashLog, "=== THREAD ANALYSIS ===\n");
-                            fprintf(crashLog, "%s", threadAnalysis.c_str());
-                        }
-                        
-                        if (!traceback.empty()) {
-                            fprintf(crashLog, "=== FULL TRACEBACK ===\n");
-                            fprintf(crashLog, "%s\n", traceback.c_str());
-                        }
-                        
-                        // Additional debug information
-                        fprintf(crashLog, "=== ENVIRONMENT INFO ===\n");
-                        fprintf(crashLog, "Lua Version: %s\n", LUA_VERSION);
-                        fprintf(crashLog, "Lua Stack Top: %d items\n", stackTop);
-                        fprintf(crashLog, "Memory Usage: %d KB\n", lua_gc(L, LUA_GCCOUNT, 0));
-                        
-                        fprintf(crashLog, "=== END ENHANCED CRASH REPORT ===\n\n");
-                        fflush(crashLog);
-                        fclose(crashLog);
+                    // Log detailed stack contents
+                    for (int i = 1; i <= stackTop; i++)
+                    {
+                        const int type = lua_type(L, i);
+
+                        if (type == LUA_TSTRING)
+                            LOVE_LOG_ERROR(LUA, "Stack[%d]: string \"%s\"", i, lua_tostring(L, i));
+                        else if (type == LUA_TNUMBER)
+                            LOVE_LOG_ERROR(LUA, "Stack[%d]: number %g", i, lua_tonumber(L, i));
+                        else
+                            LOVE_LOG_ERROR(LUA, "Stack[%d]: %s", i, lua_typename(L, type));
                     }
+
+                    LOVE_LOG_ERROR(LUA, "Lua Version: %s, Memory Usage: %d KB", LUA_VERSION,
+                                   lua_gc(L, LUA_GCCOUNT, 0));
                     
                     // Show enhanced crash screen and wait for B button
                     bool waiting = true;
@@ -1122,34 +678,32 @@ namespace love
                 
                 // IMPORTANT: After a Lua error, let the error handler take complete control
                 // Set shutdown flag to stop the C++ main loop from interfering
-                DebugLogger::log("Lua error detected - stopping C++ main loop to let love.errhand take over");
-                DebugLogger::log("Lua error result: %d", resumeResult);
-                DebugLogger::log("Current Lua stack size: %d", lua_gettop(L));
+                LOVE_LOG_ERROR(LUA, "Lua error detected - stopping C++ main loop to let love.errhand take over");
+                LOVE_LOG_ERROR(LUA, "Lua error result: %d", resumeResult);
+                LOVE_LOG_ERROR(LUA, "Current Lua stack size: %d", lua_gettop(L));
                 
                 // The error handler (love.errhand) will now handle the error display and user interaction
                 // We need to stop the C++ main loop to prevent interference with error handler rendering
                 s_Shutdown = true;
                 
                 // Log the transition
-                DebugLogger::log("C++ main loop stopped - love.errhand should now have control");
+                LOVE_LOG_ERROR(LUA, "C++ main loop stopped - love.errhand should now have control");
             }
         }
 
-        DebugLogger::log("mainLoop() returning %s", running ? "true" : "false");
         return running;
     }
 
     void onExit()
     {
-        DebugLogger::log("onExit() called - shutting down services");
+        LOVE_LOG_INFO(CORE, "onExit() called - shutting down services");
         
         for (auto it = services.rbegin(); it != services.rend(); ++it)
         {
-            DebugLogger::log("Shutting down service: %s", it->name);
+            LOVE_LOG_INFO(CORE, "Shutting down service: %s", it->name);
             it->exit();
         }
         
-        DebugLogger::log("All services shut down");
-        DebugLogger::close();
+        LOVE_LOG_INFO(CORE, "All services shut down");
     }
 } // namespace love
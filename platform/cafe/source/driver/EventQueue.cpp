@@ -4,7 +4,7 @@
 #include "modules/keyboard/Keyboard.hpp"
 
 #include "utility/guid.hpp"
-#include "DebugLogger.hpp"
+#include "common/Logger.hpp"
 
 #include <nn/swkbd.h>
 
@@ -50,25 +50,17 @@ namespace love
 
     void EventQueue::pollInternal()
     {
-        DebugLogger::log("EventQueue::pollInternal() called");
-        
         if (!JOYSTICK_MODULE())
         {
-            DebugLogger::log("EventQueue: No joystick module available");
+            LOVE_LOG_SAMPLED(WARN, EVENT, 1, 600, "No joystick module available");
             return;
         }
 
         int joystickCount = JOYSTICK_MODULE()->getJoystickCount();
-        DebugLogger::log("EventQueue: Joystick count = %d", joystickCount);
-        
+
         if (joystickCount == 0)
         {
-            static bool warned = false;
-            if (!warned)
-            {
-                DebugLogger::log("EventQueue: No joysticks available for polling");
-                warned = true;
-            }
+            LOVE_LOG_SAMPLED(WARN, EVENT, 1, 600, "No joysticks available for polling");
             return;
         }
 
@@ -78,12 +70,10 @@ namespace love
 
             if (joystick == nullptr)
             {
-                DebugLogger::log("EventQueue: Joystick %d is null", index);
+                LOVE_LOG_WARN(EVENT, "Joystick %d is null", index);
                 continue;
             }
 
-            DebugLogger::log("EventQueue: Polling joystick %d (type=%d)", index, joystick->getGamepadType());
-
             if (joystick->getGamepadType() == GAMEPAD_TYPE_NINTENDO_WII_U_GAMEPAD)
                 this->gamepad = (vpad::Joystick*)joystick;
 
@@ -96,13 +86,13 @@ namespace love
 
                 if (joystick->isDown(inputs))
                 {
-                    DebugLogger::log("EventQueue: Button %d pressed on joystick %d", input, which);
+                    LOVE_LOG_TRACE(INPUT, "Button %d pressed on joystick %d", input, which);
                     this->sendGamepadButtonEvent(SUBTYPE_GAMEPADDOWN, which, input);
                 }
 
                 if (joystick->isUp(inputs))
                 {
-                    DebugLogger::log("EventQueue: Button %d released on joystick %d", input, which);
+                    LOVE_LOG_TRACE(INPUT, "Button %d released on joystick %d", input, which);
                     this->sendGamepadButtonEvent(SUBTYPE_GAMEPADUP, which, input);
                 }
             }
@@ -112,7 +102,7 @@ namespace love
                 if (joystick->isAxisChanged(JoystickBase::GamepadAxis(input)))
                 {
                     float value = joystick->getAxis(JoystickBase::GamepadAxis(input));
-                    DebugLogger::log("EventQueue: Axis %d changed to %f on joystick %d", input, value, which);
+                    LOVE_LOG_TRACE(INPUT, "Axis %d changed to %f on joystick %d", input, value, which);
                     this->sendGamepadAxisEvent(which, input, value);
                 }
             }
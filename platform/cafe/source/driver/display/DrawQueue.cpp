@@ -0,0 +1,250 @@
+#include "driver/display/DrawQueue.hpp"
+#include "driver/display/GX2.hpp"
+
+#include "modules/graphics/Shader.hpp"
+
+#include <gx2/draw.h>
+#include <gx2r/draw.h>
+
+namespace love
+{
+    /* strips and fans can't be concatenated without restart indices */
+    static bool isMergeable(GX2PrimitiveMode mode)
+    {
+        switch (mode)
+        {
+            case GX2_PRIMITIVE_MODE_TRIANGLES:
+            case GX2_PRIMITIVE_MODE_POINTS:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    static GX2RBuffer* getVertexBuffer(const BufferBindings* buffers, int slot = 0)
+    {
+        if (buffers == nullptr || (buffers->useBits & (1u << slot)) == 0 || buffers->info[slot].buffer == nullptr)
+            return nullptr;
+
+        return (GX2RBuffer*)buffers->info[slot].buffer->getHandle();
+    }
+
+    DrawQueue::DrawQueue() :
+        draws {},
+        boundVertexBuffer(nullptr),
+        boundInstanceBuffer(nullptr),
+        boundShader(nullptr),
+        boundTexture(nullptr),
+        boundUniform(nullptr),
+        boundUniformGeneration(0),
+        boundUserUniforms(nullptr),
+        stats {}
+    {
+        this->draws.reserve(64);
+    }
+
+    bool DrawQueue::merge(const Draw& draw)
+    {
+        if (this->draws.empty())
+            return false;
+
+        auto& previous = this->draws.back();
+
+        if (previous.indexed != draw.indexed || previous.mode != draw.mode || !isMergeable(draw.mode))
+            return false;
+
+        if (previous.instanceCount != 1 || draw.instanceCount != 1)
+            return false;
+
+        if (previous.shader.get() != draw.shader.get() || previous.texture.get() != draw.texture.get())
+            return false;
+
+        if (previous.uniform != draw.uniform || previous.userUniforms != draw.userUniforms)
+            return false;
+
+        if (previous.vertexBuffer != draw.vertexBuffer || previous.instanceBuffer != draw.instanceBuffer)
+            return false;
+
+        if (previous.indexBuffer != draw.indexBuffer || previous.indexType != draw.indexType)
+            return false;
+
+        if (draw.quadIndices)
+        {
+            /*
+            ** The quad indices repeat every 6 indices and 4 vertices, so draws whose
+            ** vertices follow on from each other are one longer draw from the first.
+            */
+            const uint32_t end = previous.first + previous.count;
+
+            if (previous.baseVertex + end / 6 * 4 != draw.baseVertex + draw.first / 6 * 4)
+                return false;
+
+            if (end + draw.count > (uint32_t)QUAD_INDEX_BUFFER_QUADS * 6)
+                return false;
+        }
+        else if (previous.baseVertex != draw.baseVertex || previous.first + previous.count != draw.first)
+            return false;
+
+        previous.count += draw.count;
+        this->stats.merged++;
+
+        return true;
+    }
+
+    bool DrawQueue::record(Draw& draw)
+    {
+        this->stats.recorded++;
+
+        if (this->merge(draw))
+            return true;
+
+        this->draws.push_back(std::move(draw));
+        return false;
+    }
+
+    bool DrawQueue::push(const DrawIndexedCommand& command, ShaderBase* shader, Uniform* uniform,
+                         const uint8_t* userUniforms)
+    {
+        Draw draw {};
+        draw.indexed        = true;
+        draw.mode           = GX2::getPrimitiveType(command.primitiveType);
+        draw.vertexBuffer   = getVertexBuffer(command.buffers);
+        draw.instanceBuffer = getVertexBuffer(command.buffers, 1);
+        draw.indexBuffer    = (GX2RBuffer*)command.indexBuffer->getHandle();
+        draw.indexType      = GX2::getIndexType(command.indexType);
+        draw.first          = (uint32_t)command.indexBufferOffset;
+        draw.count          = (uint32_t)command.indexCount;
+        draw.baseVertex     = (uint32_t)command.baseVertex;
+        draw.instanceCount  = (uint32_t)command.instanceCount;
+        draw.quadIndices    = command.quadIndices;
+        draw.uniform        = uniform;
+        draw.userUniforms   = userUniforms;
+        draw.texture.set(command.texture);
+        draw.shader.set(shader);
+
+        return this->record(draw);
+    }
+
+    bool DrawQueue::push(const DrawCommand& command, ShaderBase* shader, Uniform* uniform,
+                         const uint8_t* userUniforms)
+    {
+        uint32_t first = (uint32_t)command.vertexStart;
+
+        if (command.buffers != nullptr && (command.buffers->useBits & 1) != 0)
+            first += (uint32_t)command.buffers->info[0].offset;
+
+        Draw draw {};
+        draw.indexed        = false;
+        draw.mode           = GX2::getPrimitiveType(command.primitiveType);
+        draw.vertexBuffer   = getVertexBuffer(command.buffers);
+        draw.instanceBuffer = getVertexBuffer(command.buffers, 1);
+        draw.indexBuffer    = nullptr;
+        draw.indexType      = GX2_INDEX_TYPE_U16;
+        draw.first          = first;
+        draw.count          = (uint32_t)command.vertexCount;
+        draw.baseVertex     = 0;
+        draw.instanceCount  = (uint32_t)command.instanceCount;
+        draw.quadIndices    = false;
+        draw.uniform        = uniform;
+        draw.userUniforms   = userUniforms;
+        draw.texture.set(command.texture);
+        draw.shader.set(shader);
+
+        return this->record(draw);
+    }
+
+    void DrawQueue::invalidate()
+    {
+        this->boundVertexBuffer      = nullptr;
+        this->boundInstanceBuffer    = nullptr;
+        this->boundShader            = nullptr;
+        this->boundTexture           = nullptr;
+        this->boundUniform           = nullptr;
+        this->boundUniformGeneration = 0;
+        this->boundUserUniforms      = nullptr;
+    }
+
+    void DrawQueue::submit(Uniform* uniform, uint32_t uniformGeneration)
+    {
+        /* the stream buffers rebind themselves on unmap, so don't trust what we last set */
+        this->boundVertexBuffer = nullptr;
+
+        for (auto& draw : this->draws)
+        {
+            auto* shader = (Shader*)draw.shader.get();
+
+            if (shader != nullptr)
+            {
+                const bool shaderChanged = shader != this->boundShader;
+
+                if (shaderChanged)
+                {
+                    shader->bind();
+                    this->boundShader  = shader;
+                    this->boundTexture = nullptr;
+                }
+                else
+                    this->stats.shaderBindsSkipped++;
+
+                /* the frame uniform is rewritten in place, per-draw blocks never are */
+                auto* drawUniform = (draw.uniform != nullptr) ? draw.uniform : uniform;
+
+                bool uniformChanged = drawUniform != this->boundUniform;
+                if (draw.uniform == nullptr && uniformGeneration != this->boundUniformGeneration)
+                    uniformChanged = true;
+
+                if (shaderChanged || uniformChanged)
+                {
+                    shader->updateBuiltinUniforms(drawUniform);
+                    this->boundUniform           = drawUniform;
+                    this->boundUniformGeneration = uniformGeneration;
+                }
+                else
+                    this->stats.uniformBindsSkipped++;
+
+                if (shaderChanged || draw.userUniforms != this->boundUserUniforms)
+                {
+                    shader->bindUniforms(draw.userUniforms);
+                    this->boundUserUniforms = draw.userUniforms;
+                }
+            }
+
+            if (draw.texture.get() != nullptr && shader != nullptr)
+            {
+                if (draw.texture.get() != this->boundTexture)
+                {
+                    gx2.bindTextureToUnit(shader, draw.texture.get(), 0);
+                    this->boundTexture = draw.texture.get();
+                }
+                else
+                    this->stats.textureBindsSkipped++;
+            }
+
+            if (draw.vertexBuffer != nullptr && draw.vertexBuffer != this->boundVertexBuffer)
+            {
+                GX2RSetAttributeBuffer(draw.vertexBuffer, 0, draw.vertexBuffer->elemSize, 0);
+                this->boundVertexBuffer = draw.vertexBuffer;
+            }
+
+            /* per-instance attributes read from buffer 1, see Shader::loadVolatile */
+            if (draw.instanceBuffer != nullptr && draw.instanceBuffer != this->boundInstanceBuffer)
+            {
+                GX2RSetAttributeBuffer(draw.instanceBuffer, 1, draw.instanceBuffer->elemSize, 0);
+                this->boundInstanceBuffer = draw.instanceBuffer;
+            }
+
+            if (draw.indexed)
+            {
+                GX2RDrawIndexed(draw.mode, draw.indexBuffer, draw.indexType, draw.count, draw.first,
+                                draw.baseVertex, draw.instanceCount);
+            }
+            else
+                GX2DrawEx(draw.mode, draw.count, draw.first, draw.instanceCount);
+
+            this->stats.submitted++;
+        }
+
+        /* drop the references taken when recording */
+        this->draws.clear();
+    }
+} // namespace love
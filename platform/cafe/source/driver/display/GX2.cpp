@@ -1,3 +1,5 @@
+#include "common/Logger.hpp"
+
 #include "driver/display/GX2.hpp"
 #include "driver/display/Uniform.hpp"
 
@@ -5,14 +7,11 @@
 #include "modules/graphics/Shader.hpp"
 #include "modules/keyboard/Keyboard.hpp"
 
-#ifdef __WIIU__
-#include "WiiUGraphicsOptimizer.hpp"
-#endif
-
 #include <gx2/clear.h>
 #include <gx2/context.h>
 #include <gx2/display.h>
 #include <gx2/event.h>
+#include <gx2/mem.h>
 #include <gx2/state.h>
 #include <gx2/swap.h>
 
@@ -28,6 +27,17 @@ namespace love
     GX2::GX2() :
         targets {},
         context {},
+        uniform(nullptr),
+        uniformGeneration(1),
+        transformUniforms {},
+        transformUniformCount(0),
+        transformUniformFrame(0),
+        queue {},
+        validState(0),
+        stateStats {},
+        boundTextures {},
+        boundSamplers {},
+        samplers {},
         inForeground(false),
         consecutivePresentCalls(0),
         commandBuffer(nullptr),
@@ -49,6 +59,14 @@ namespace love
 
         delete this->uniform;
 
+        for (auto& pool : this->transformUniforms)
+        {
+            for (auto* block : pool)
+                free(block);
+
+            pool.clear();
+        }
+
         free(this->state);
         this->state = nullptr;
 
@@ -59,6 +77,7 @@ namespace love
     int GX2::onForegroundAcquired()
     {
         this->inForeground = true;
+        this->invalidateState();
 
         auto foregroundHeap = MEMGetBaseHeapHandle(MEM_BASE_HEAP_FG);
         auto memOneHeap     = MEMGetBaseHeapHandle(MEM_BASE_HEAP_MEM1);
@@ -133,6 +152,9 @@ namespace love
         GX2SetupContextStateEx(this->state, false);
         GX2SetContextState(this->state);
 
+        this->invalidateState();
+        this->validState |= (1u << STATE_CONTEXT);
+
         this->createFramebuffers();
 
         GX2SetDepthOnlyControl(false, false, GX2_COMPARE_FUNC_ALWAYS);
@@ -160,6 +182,8 @@ namespace love
         this->uniform             = (Uniform*)memalign(GX2_UNIFORM_BLOCK_ALIGNMENT, sizeof(Uniform));
         this->uniform->modelView  = glm::mat4(1.0f);
         this->uniform->projection = glm::mat4(1.0f);
+        GX2Invalidate(GX2_INVALIDATE_MODE_CPU | GX2_INVALIDATE_MODE_UNIFORM_BLOCK, this->uniform,
+                      UNIFORM_SIZE);
 
         this->bindFramebuffer(&this->targets[0].get());
 
@@ -195,55 +219,68 @@ namespace love
             target.destroy();
     }
 
+    void GX2::invalidateState()
+    {
+        this->validState = 0;
+
+        this->boundTextures.fill(nullptr);
+        this->boundSamplers.fill(nullptr);
+    }
+
+    /*
+    ** GX2 records every register write into the bound context state, so the
+    ** hardware keeps matching the shadow across GX2SetContextState. Only
+    ** things that bypass it (clears, scan buffer copies, losing the
+    ** foreground) invalidate the shadow.
+    */
+    template<typename T>
+    bool GX2::shadowState(ShadowedState state, T& shadow, const T& value)
+    {
+        const uint32_t bit = (1u << state);
+
+        if ((this->validState & bit) != 0 && shadow == value)
+        {
+            this->stateStats.skipped++;
+            return false;
+        }
+
+        shadow = value;
+        this->validState |= bit;
+        this->stateStats.emitted++;
+
+        return true;
+    }
+
     void GX2::ensureInFrame()
     {
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "GX2::ensureInFrame() called, inFrame = %s\n", this->inFrame ? "true" : "false");
-            fflush(logFile);
-            fclose(logFile);
+        /* called for every draw, the context only needs restoring after it was clobbered */
+        if ((this->validState & (1u << STATE_CONTEXT)) == 0)
+        {
+            GX2SetContextState(this->state);
+
+            this->validState |= (1u << STATE_CONTEXT);
+            this->stateStats.emitted++;
         }
-#endif
-        
-        GX2SetContextState(this->state);
 
         if (!this->inFrame)
         {
 #ifdef __WIIU__
-            FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile2) {
-                fprintf(logFile2, "GX2::ensureInFrame() - starting new frame\n");
-                fflush(logFile2);
-                fclose(logFile2);
-            }
+            LOVE_LOG_TRACE(GRAPHICS, "GX2::ensureInFrame() - starting new frame");
             // Reset consecutive present calls counter at start of new frame
             this->consecutivePresentCalls = 0;
-            
-            // Reset draw call optimization counters for new frame
-            #ifdef __WIIU__
-            WiiUGraphicsOptimizer::startFrame();
-            #endif
 #endif
             this->inFrame = true;
         }
-        
-#ifdef __WIIU__
-        FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile3) {
-            fprintf(logFile3, "GX2::ensureInFrame() completed, inFrame = true\n");
-            fflush(logFile3);
-            fclose(logFile3);
-        }
-#endif
     }
 
     void GX2::copyCurrentScanBuffer()
     {
         Graphics::flushBatchedDrawsGlobal();
+        this->submitDraws();
         Graphics::advanceStreamBuffersGlobal();
 
         this->targets[love::currentScreen].copyScanBuffer();
+        this->validState &= ~(1u << STATE_CONTEXT);
 
         GX2Flush();
         GX2WaitForFlip();
@@ -251,49 +288,24 @@ namespace love
 
     void GX2::clear(const Color& color)
     {
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "GX2::clear() called with color: R=%.2f G=%.2f B=%.2f A=%.2f, inFrame = %s\n", 
-                   color.r, color.g, color.b, color.a, this->inFrame ? "true" : "false");
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
+        LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 10, 60, "GX2::clear() color: R=%.2f G=%.2f B=%.2f A=%.2f, inFrame = %s", color.r, color.g, color.b, color.a, this->inFrame ? "true" : "false");
         
         if (!this->inFrame)
         {
-#ifdef __WIIU__
-            FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile2) {
-                fprintf(logFile2, "GX2::clear() - not in frame, calling ensureInFrame\n");
-                fflush(logFile2);
-                fclose(logFile2);
-            }
-#endif
+            LOVE_LOG_TRACE(GRAPHICS, "GX2::clear() - not in frame, calling ensureInFrame");
             this->ensureInFrame();
         }
 
-#ifdef __WIIU__
-        FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile3) {
-            fprintf(logFile3, "GX2::clear() - clearing framebuffer\n");
-            fflush(logFile3);
-            fclose(logFile3);
-        }
-#endif
-        
+        this->submitDraws();
+
         GX2ClearColor(this->getFramebuffer(), color.r, color.g, color.b, color.a);
         GX2SetContextState(this->state);
-        
-#ifdef __WIIU__
-        FILE* logFile4 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile4) {
-            fprintf(logFile4, "GX2::clear() completed\n");
-            fflush(logFile4);
-            fclose(logFile4);
-        }
-#endif
+        this->stateStats.emitted++;
+
+        /* GX2ClearColor clobbers the shader and texture bindings */
+        this->queue.invalidate();
+        this->boundTextures.fill(nullptr);
+        this->boundSamplers.fill(nullptr);
     }
 
     void GX2::clearDepthStencil(int depth, uint8_t mask, double stencil)
@@ -314,6 +326,7 @@ namespace love
 
         if (bindingModified)
         {
+            this->submitDraws();
             GX2SetColorBuffer(target, GX2_RENDER_TARGET_0);
             this->setMode(target->surface.width, target->surface.height);
         }
@@ -324,77 +337,175 @@ namespace love
         this->setViewport({ 0, 0, width, height });
         this->setScissor({ 0, 0, width, height });
 
+        this->submitDraws();
+
         auto* newUniform = this->targets[love::currentScreen].getUniform();
-        std::memcpy(this->uniform, newUniform, sizeof(Uniform));
+
+        /* switching back to the same target keeps the bound block */
+        if (std::memcmp(this->uniform, newUniform, sizeof(Uniform)) == 0)
+            return;
+
+        writeUniform(this->uniform, *newUniform);
+        this->uniformGeneration++;
     }
 
-    void GX2::setSamplerState(TextureBase* texture, const SamplerState& state)
+    static bool initSampler(GX2Sampler* sampler, const SamplerState& state)
     {
-        auto* sampler = (GX2Sampler*)texture->getSamplerHandle();
         GX2InitSampler(sampler, GX2_TEX_CLAMP_MODE_WRAP, GX2_TEX_XY_FILTER_MODE_LINEAR);
 
         GX2TexXYFilterMode minFilter;
 
         if (!GX2::getConstant(state.minFilter, minFilter))
-            return;
+            return false;
 
         GX2TexXYFilterMode magFilter;
 
         if (!GX2::getConstant(state.magFilter, magFilter))
-            return;
+            return false;
 
         GX2InitSamplerXYFilter(sampler, magFilter, minFilter, GX2_TEX_ANISO_RATIO_NONE);
 
         GX2TexClampMode wrapU;
 
         if (!GX2::getConstant(state.wrapU, wrapU))
-            return;
+            return false;
 
         GX2TexClampMode wrapV;
 
         if (!GX2::getConstant(state.wrapV, wrapV))
-            return;
+            return false;
 
         GX2TexClampMode wrapW;
 
         if (!GX2::getConstant(state.wrapW, wrapW))
-            return;
+            return false;
 
         GX2InitSamplerClamping(sampler, wrapU, wrapV, wrapW);
         GX2InitSamplerLOD(sampler, state.minLod, state.maxLod, state.lodBias);
+
+        return true;
     }
 
-    void GX2::prepareDraw(GraphicsBase* graphics)
+    GX2Sampler* GX2::getSampler(const SamplerState& state)
     {
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "GX2::prepareDraw() called\n");
-            fflush(logFile);
-            fclose(logFile);
+        /* toKey() only keeps the low bits of the LOD range */
+        const SamplerKey key { state.toKey(), (uint16_t)((state.minLod << 8) | state.maxLod) };
+
+        if (auto it = this->samplers.find(key); it != this->samplers.end())
+            return it->second.get();
+
+        auto sampler = std::make_unique<GX2Sampler>();
+
+        if (!initSampler(sampler.get(), state))
+            return nullptr;
+
+        return this->samplers.emplace(key, std::move(sampler)).first->second.get();
+    }
+
+    GX2Sampler* GX2::setSamplerState(TextureBase* texture, const SamplerState& state)
+    {
+        auto* sampler = this->getSampler(state);
+
+        if (sampler == nullptr)
+            return (GX2Sampler*)texture->getSamplerHandle();
+
+        auto* previous = (GX2Sampler*)texture->getSamplerHandle();
+
+        /* queued draws of this texture must keep the old sampler, and may already have it bound */
+        if (previous != nullptr && previous != sampler)
+        {
+            this->submitDraws();
+            this->queue.invalidate();
         }
-#endif
-        
-        // Ensure we're in frame before any drawing operations
+
+        return sampler;
+    }
+
+    /*
+    ** Uniform blocks are flushed from the CPU cache once, when written, and
+    ** then only re-bound. Nothing writes to a block after that, except for
+    ** setMode, which also bumps uniformGeneration.
+    */
+    void GX2::writeUniform(Uniform* destination, const Uniform& source)
+    {
+        std::memcpy(destination, &source, sizeof(Uniform));
+        GX2Invalidate(GX2_INVALIDATE_MODE_CPU | GX2_INVALIDATE_MODE_UNIFORM_BLOCK, destination, UNIFORM_SIZE);
+    }
+
+    void GX2::prepareDraw(GraphicsBase*)
+    {
         this->ensureInFrame();
-        
-        if (Shader::current != nullptr)
+    }
+
+    Uniform* GX2::getTransformUniform(const Matrix4& transform)
+    {
+        auto& pool = this->transformUniforms[this->transformUniformFrame];
+
+        Uniform block {};
+        block.projection = this->uniform->projection;
+
+        /* same byte order as Framebuffer::create */
+        const uint32_t* source = (const uint32_t*)transform.getElements();
+        uint32_t* destination  = (uint32_t*)glm::value_ptr(block.modelView);
+
+        for (size_t index = 0; index < sizeof(glm::mat4) / sizeof(uint32_t); index++)
+            destination[index] = __builtin_bswap32(source[index]);
+
+        /* consecutive draws of the same drawable share one block */
+        if (this->transformUniformCount > 0)
         {
-            auto* shader = (Shader*)ShaderBase::current;
-            shader->updateBuiltinUniforms(graphics, this->uniform);
-        }
-        
-#ifdef __WIIU__
-        FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile2) {
-            fprintf(logFile2, "GX2::prepareDraw() completed\n");
-            fflush(logFile2);
-            fclose(logFile2);
+            auto* previous = pool[this->transformUniformCount - 1];
+
+            if (std::memcmp(previous, &block, sizeof(Uniform)) == 0)
+                return previous;
         }
-#endif
+
+        if (this->transformUniformCount == pool.size())
+            pool.push_back((Uniform*)memalign(GX2_UNIFORM_BLOCK_ALIGNMENT, sizeof(Uniform)));
+
+        auto* result = pool[this->transformUniformCount++];
+        writeUniform(result, block);
+
+        return result;
+    }
+
+    /* snapshot of the current shader's send() data for the draw being recorded */
+    static const uint8_t* getUserUniforms()
+    {
+        auto* shader = (Shader*)ShaderBase::current;
+        return shader != nullptr ? shader->getUniformUpload() : nullptr;
+    }
+
+    bool GX2::queueDraw(const DrawIndexedCommand& command)
+    {
+        Uniform* uniform = nullptr;
+
+        if (command.transform != nullptr)
+            uniform = this->getTransformUniform(*command.transform);
+
+        return this->queue.push(command, ShaderBase::current, uniform, getUserUniforms());
     }
 
-    void GX2::bindTextureToUnit(TextureBase* texture, int unit)
+    bool GX2::queueDraw(const DrawCommand& command)
+    {
+        Uniform* uniform = nullptr;
+
+        if (command.transform != nullptr)
+            uniform = this->getTransformUniform(*command.transform);
+
+        return this->queue.push(command, ShaderBase::current, uniform, getUserUniforms());
+    }
+
+    void GX2::submitDraws()
+    {
+        if (this->queue.isEmpty())
+            return;
+
+        this->ensureInFrame();
+        this->queue.submit(this->uniform, this->uniformGeneration);
+    }
+
+    void GX2::bindTextureToUnit(ShaderBase* shader, TextureBase* texture, int unit)
     {
         if (texture == nullptr)
             return;
@@ -409,19 +520,42 @@ namespace love
         if (sampler == nullptr)
             return;
 
-        this->bindTextureToUnit(handle, sampler, unit);
+        this->bindTextureToUnit(shader, handle, sampler, unit);
     }
 
-    void GX2::bindTextureToUnit(GX2Texture* texture, GX2Sampler* sampler, int unit)
+    void GX2::bindTextureToUnit(ShaderBase* shader, GX2Texture* texture, GX2Sampler* sampler, int unit)
     {
-        auto* shader = (Shader*)ShaderBase::current;
-        auto* info   = shader->getUniformInfo("texture0");
+        if (shader == nullptr)
+            return;
+
+        auto* info = shader->getBuiltinUniformInfo(ShaderBase::BUILTIN_TEXTURE_MAIN);
 
         if (!info)
             return;
 
-        GX2SetPixelTexture(texture, unit);
-        GX2SetPixelSampler(sampler, info->location);
+        const size_t location = info->location;
+
+        if (unit >= 0 && (size_t)unit < MAX_TEXTURE_UNITS && this->boundTextures[unit] == texture)
+            this->stateStats.skipped++;
+        else
+        {
+            GX2SetPixelTexture(texture, unit);
+            this->stateStats.emitted++;
+
+            if (unit >= 0 && (size_t)unit < MAX_TEXTURE_UNITS)
+                this->boundTextures[unit] = texture;
+        }
+
+        if (location < MAX_TEXTURE_UNITS && this->boundSamplers[location] == sampler)
+            this->stateStats.skipped++;
+        else
+        {
+            GX2SetPixelSampler(sampler, location);
+            this->stateStats.emitted++;
+
+            if (location < MAX_TEXTURE_UNITS)
+                this->boundSamplers[location] = sampler;
+        }
     }
 
     void GX2::present()
@@ -432,26 +566,15 @@ namespace love
         
         this->consecutivePresentCalls++;
         
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "GX2::present() called #%d, inFrame = %s\n", this->consecutivePresentCalls, this->inFrame ? "true" : "false");
-            fflush(logFile);
-            fclose(logFile);
-        }
+        LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 10, 60, "GX2::present() #%d, inFrame = %s", this->consecutivePresentCalls, this->inFrame ? "true" : "false");
         
         // DISABLED: Fallback detection to prevent black screen
         // If we've had too many consecutive present calls without a reset, trigger fallback
         // if (this->consecutivePresentCalls > 30 && !fallbackTriggered) {
         //     fallbackTriggered = true;
         //     
-        //     FILE* fallbackLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-        //     if (fallbackLog) {
-        //         fprintf(fallbackLog, "=== ENDLESS LOOP DETECTED: TRIGGERING FALLBACK DIAGNOSTIC SCREEN ===\n");
-        //         fprintf(fallbackLog, "Consecutive present calls: %d\n", this->consecutivePresentCalls);
-        //         fprintf(fallbackLog, "This indicates lua_resume() is hanging in an endless loop\n");
-        //         fflush(fallbackLog);
-        //         fclose(fallbackLog);
-        //     }
+        //     LOVE_LOG_ERROR(GRAPHICS, "Endless loop detected after %d consecutive present calls",
+        //                    this->consecutivePresentCalls);
         //     
         //     // Force entry into diagnostic fallback mode
         //     this->showFallbackDiagnosticScreen();
@@ -461,26 +584,22 @@ namespace love
         
         if (!this->inFrame)
         {
-#ifdef __WIIU__
-            FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile2) {
-                fprintf(logFile2, "GX2::present() - not in frame, calling ensureInFrame\n");
-                fflush(logFile2);
-                fclose(logFile2);
-            }
-#endif
+            LOVE_LOG_TRACE(GRAPHICS, "GX2::present() - not in frame, calling ensureInFrame");
             this->ensureInFrame();
         }
-        
-#ifdef __WIIU__
-        FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile3) {
-            fprintf(logFile3, "GX2::present() - presenting to both screens\n");
-            fflush(logFile3);
-            fclose(logFile3);
-        }
-#endif
-        
+
+        this->submitDraws();
+
+        const auto& stats = this->queue.getStats();
+        LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 10, 60,
+                         "GX2::present() draws: %d recorded, %d merged, %d submitted; "
+                         "skipped binds: %d shader, %d texture, %d uniform; state: %d emitted, %d skipped",
+                         stats.recorded, stats.merged, stats.submitted, stats.shaderBindsSkipped,
+                         stats.textureBindsSkipped, stats.uniformBindsSkipped, this->stateStats.emitted,
+                         this->stateStats.skipped);
+        this->queue.resetStats();
+        this->stateStats = {};
+
         // Present to GamePad
         GX2CopyColorBufferToScanBuffer(&this->targets[0].get(), GX2_SCAN_TARGET_DRC);
         
@@ -491,17 +610,14 @@ namespace love
         GX2SwapScanBuffers();
         GX2Flush();
         GX2WaitForVsync();
+
+        /* the scan buffer copies run with their own state */
+        this->validState &= ~(1u << STATE_CONTEXT);
+
+        this->transformUniformFrame = (this->transformUniformFrame + 1) % BUFFER_FRAMES;
+        this->transformUniformCount = 0;
         
         this->inFrame = false;
-        
-#ifdef __WIIU__
-        FILE* logFile4 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile4) {
-            fprintf(logFile4, "GX2::present() completed, inFrame = false\n");
-            fflush(logFile4);
-            fclose(logFile4);
-        }
-#endif
     }
 
     void GX2::setViewport(const Rect& rect)
@@ -510,8 +626,12 @@ namespace love
         if (rect == Rect::EMPTY)
             view = this->targets[love::currentScreen].getViewport();
 
+        /* queued draws only need issuing if the state really changes */
+        if (!this->shadowState(STATE_VIEWPORT, this->context.viewport, view))
+            return;
+
+        this->submitDraws();
         GX2SetViewport(view.x, view.y, view.w, view.h, Framebuffer::Z_NEAR, Framebuffer::Z_FAR);
-        this->context.viewport = view;
     }
 
     void GX2::setScissor(const Rect& rect)
@@ -520,18 +640,40 @@ namespace love
         if (rect == Rect::EMPTY)
             scissor = this->targets[love::currentScreen].getScissor();
 
+        if (!this->shadowState(STATE_SCISSOR, this->context.scissor, scissor))
+            return;
+
+        this->submitDraws();
         GX2SetScissor(scissor.x, scissor.y, scissor.w, scissor.h);
-        this->context.scissor = scissor;
+    }
+
+    void GX2::setCullControl(GX2FrontFace winding, bool cullBack, bool cullFront)
+    {
+        auto pack = [](GX2FrontFace face, bool back, bool front) {
+            return (uint32_t)face | ((uint32_t)back << 8) | ((uint32_t)front << 9);
+        };
+
+        uint32_t current = pack(this->context.winding, this->context.cullBack, this->context.cullFront);
+
+        if (!this->shadowState(STATE_CULL, current, pack(winding, cullBack, cullFront)))
+            return;
+
+        this->submitDraws();
+        GX2SetCullOnlyControl(winding, cullBack, cullFront);
+
+        this->context.winding   = winding;
+        this->context.cullBack  = cullBack;
+        this->context.cullFront = cullFront;
     }
 
     void GX2::setCullMode(CullMode mode)
     {
         const auto enabled = mode != CullMode::CULL_NONE;
 
-        this->context.cullBack  = (enabled && mode == CullMode::CULL_BACK);
-        this->context.cullFront = (enabled && mode == CullMode::CULL_FRONT);
+        const bool cullBack  = (enabled && mode == CullMode::CULL_BACK);
+        const bool cullFront = (enabled && mode == CullMode::CULL_FRONT);
 
-        GX2SetCullOnlyControl(this->context.winding, this->context.cullBack, this->context.cullFront);
+        this->setCullControl(this->context.winding, cullBack, cullFront);
     }
 
     void GX2::setVertexWinding(Winding winding)
@@ -541,12 +683,16 @@ namespace love
         if (!GX2::getConstant(winding, windingMode))
             return;
 
-        GX2SetCullOnlyControl(windingMode, this->context.cullBack, this->context.cullFront);
-        this->context.winding = windingMode;
+        this->setCullControl(windingMode, this->context.cullBack, this->context.cullFront);
     }
 
     void GX2::setColorMask(ColorChannelMask mask)
     {
+        if (!this->shadowState(STATE_COLOR_MASK, this->context.colorMask, mask))
+            return;
+
+        this->submitDraws();
+
         const auto red   = (GX2_CHANNEL_MASK_R * mask.r);
         const auto green = (GX2_CHANNEL_MASK_G * mask.g);
         const auto blue  = (GX2_CHANNEL_MASK_B * mask.b);
@@ -584,6 +730,10 @@ namespace love
         if (!GX2::getConstant(state.dstFactorA, destAlpha))
             return;
 
+        if (!this->shadowState(STATE_BLEND, this->context.blendState, state))
+            return;
+
+        this->submitDraws();
         GX2SetBlendControl(GX2_RENDER_TARGET_0, sourceColor, destColor, operationRGB, true, sourceAlpha,
                            destAlpha, operationA);
     }
@@ -594,13 +744,7 @@ namespace love
         // Force immediate display of diagnostic message using OSScreen
         // This bypasses the normal graphics pipeline which may be stuck
         
-        FILE* diagnosticLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (diagnosticLog) {
-            fprintf(diagnosticLog, "=== SHOWING FALLBACK DIAGNOSTIC SCREEN ===\n");
-            fprintf(diagnosticLog, "Attempting to display diagnostic message using OSScreen\n");
-            fflush(diagnosticLog);
-            fclose(diagnosticLog);
-        }
+        LOVE_LOG_WARN(GRAPHICS, "Showing fallback diagnostic screen");
         
         // Try to initialize screen
         OSScreenInit();
@@ -676,12 +820,7 @@ namespace love
             OSScreenFlipBuffersEx(SCREEN_TV);
             OSScreenFlipBuffersEx(SCREEN_DRC);
             
-            FILE* successLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (successLog) {
-                fprintf(successLog, "Fallback diagnostic screen displayed successfully\n");
-                fflush(successLog);
-                fclose(successLog);
-            }
+            LOVE_LOG_INFO(GRAPHICS, "Fallback diagnostic screen displayed");
             
             // Keep the diagnostic screen visible and enter a simple loop
             // that doesn't hang like the graphics loop
@@ -694,12 +833,7 @@ namespace love
                 OSScreenFlipBuffersEx(SCREEN_DRC);
             }
         } else {
-            FILE* errorLog = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (errorLog) {
-                fprintf(errorLog, "FAILED to allocate OSScreen buffers for diagnostic display\n");
-                fflush(errorLog);
-                fclose(errorLog);
-            }
+            LOVE_LOG_ERROR(GRAPHICS, "Failed to allocate OSScreen buffers for diagnostic display");
         }
 #endif
     }
@@ -1,3 +1,4 @@
+#include "common/Logger.hpp"
 #include "driver/display/GX2.hpp"
 
 #include "modules/graphics/Graphics.hpp"
@@ -21,21 +22,12 @@
 #include <gx2/state.h>
 #include <gx2r/draw.h>
 
-#ifdef __WIIU__
-#include "WiiUGraphicsOptimizer.hpp"
-#endif
-
 namespace love
 {
     Graphics::Graphics() : GraphicsBase("love.graphics.gx2")
     {
 #ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "Graphics constructor called\n");
-            fflush(logFile);
-            fclose(logFile);
-        }
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics constructor called");
 
 #ifdef USE_PPC_DEBUGGER
         // Initialize PPC debugger first for maximum debugging coverage
@@ -54,12 +46,7 @@ namespace love
         if (CafeGLSLCompiler::Initialize())
         {
 #ifdef __WIIU__
-            FILE* cafeLogFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (cafeLogFile) {
-                fprintf(cafeLogFile, "CafeGLSL: Shader compiler initialized successfully\n");
-                fflush(cafeLogFile);
-                fclose(cafeLogFile);
-            }
+            LOVE_LOG_INFO(SHADER, "CafeGLSL shader compiler initialized");
 #ifdef USE_PPC_DEBUGGER
             PPCDebugger::DebugPoint("CAFEGLSL_INIT_SUCCESS", "CafeGLSL loaded successfully");
 #endif
@@ -68,31 +55,34 @@ namespace love
         else
         {
 #ifdef __WIIU__
-            FILE* cafeLogFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (cafeLogFile) {
-                fprintf(cafeLogFile, "CafeGLSL: Warning - Shader compiler not available, using fallback rendering\n");
-                fflush(cafeLogFile);
-                fclose(cafeLogFile);
-            }
+            LOVE_LOG_WARN(SHADER, "CafeGLSL shader compiler not available, using fallback rendering");
 #ifdef USE_PPC_DEBUGGER
             PPCDebugger::CriticalError("CafeGLSL failed to initialize - this may cause rendering issues", true);
 #endif
 #endif
         }
 #endif
-        
+
+        /* read the default shader stages in the background while the window comes up */
+        std::vector<std::string> defaultStages {};
+
+        for (int index = 0; index < Shader::STANDARD_MAX_ENUM; index++)
+        {
+            const auto type = (Shader::StandardShader)index;
+
+            defaultStages.push_back(Shader::getDefaultStagePath(type, SHADERSTAGE_VERTEX));
+            defaultStages.push_back(Shader::getDefaultStagePath(type, SHADERSTAGE_PIXEL));
+        }
+
+        this->precompileShaders(defaultStages);
+
         auto* window = Module::getInstance<Window>(M_WINDOW);
 
 #ifdef __WIIU__
 #ifdef USE_PPC_DEBUGGER
         PPCDebugger::DebugPoint("WINDOW_INSTANCE_GET", "Retrieved window instance");
 #endif
-        FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile2) {
-            fprintf(logFile2, "Graphics: got window instance %p\n", (void*)window);
-            fflush(logFile2);
-            fclose(logFile2);
-        }
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics: got window instance %p", (void*)window);
 #endif
 
         if (window != nullptr)
@@ -101,12 +91,7 @@ namespace love
 #ifdef USE_PPC_DEBUGGER
             PPCDebugger::DebugPoint("WINDOW_SET_GRAPHICS", "Setting graphics on window");
 #endif
-            FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile3) {
-                fprintf(logFile3, "Graphics: setting graphics on window\n");
-                fflush(logFile3);
-                fclose(logFile3);
-            }
+            LOVE_LOG_TRACE(GRAPHICS, "Graphics: setting graphics on window");
 #endif
             window->setGraphics(this);
 
@@ -116,36 +101,17 @@ namespace love
 #ifdef USE_PPC_DEBUGGER
                 PPCDebugger::DebugPoint("WINDOW_IS_OPEN", "Window is open, proceeding with initialization");
 #endif
-                FILE* logFile4 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile4) {
-                    fprintf(logFile4, "Graphics: window is open, setting window parameters\n");
-                    fflush(logFile4);
-                    fclose(logFile4);
-                }
+                LOVE_LOG_TRACE(GRAPHICS, "Graphics: window is open, setting window parameters");
 #endif
                 int width, height;
                 Window::WindowSettings settings {};
 
                 window->getWindow(width, height, settings);
                 window->setWindow(width, height, &settings);
-#ifdef __WIIU__
-                FILE* logFile5 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile5) {
-                    fprintf(logFile5, "Graphics: window parameters set (%dx%d)\n", width, height);
-                    fflush(logFile5);
-                    fclose(logFile5);
-                }
-#endif
+                LOVE_LOG_TRACE(GRAPHICS, "Graphics: window parameters set (%dx%d)", width, height);
             }
         }
-#ifdef __WIIU__
-        FILE* logFile6 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile6) {
-            fprintf(logFile6, "Graphics constructor completed\n");
-            fflush(logFile6);
-            fclose(logFile6);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics constructor completed");
     }
 
     Graphics::~Graphics()
@@ -153,14 +119,7 @@ namespace love
 #ifdef USE_CAFEGLSL
         // Cleanup CafeGLSL shader compiler
         CafeGLSLCompiler::Shutdown();
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "CafeGLSL: Shader compiler shutdown completed\n");
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "CafeGLSL: Shader compiler shutdown completed");
 #endif
     }
 
@@ -177,9 +136,9 @@ namespace love
         this->capabilities.features[FEATURE_SHADER_DERIVATIVES]           = false;
         this->capabilities.features[FEATURE_GLSL3]                        = false;
         this->capabilities.features[FEATURE_GLSL4]                        = false;
-        this->capabilities.features[FEATURE_INSTANCING]                   = false;
+        this->capabilities.features[FEATURE_INSTANCING]                   = true;
         this->capabilities.features[FEATURE_TEXEL_BUFFER]                 = false;
-        this->capabilities.features[FEATURE_INDEX_BUFFER_32BIT]           = false;
+        this->capabilities.features[FEATURE_INDEX_BUFFER_32BIT]           = true;
         this->capabilities.features[FEATURE_COPY_BUFFER_TO_TEXTURE]       = false; //< might be possible
         this->capabilities.features[FEATURE_COPY_TEXTURE_TO_BUFFER]       = false; //< might be possible
         this->capabilities.features[FEATURE_COPY_RENDER_TARGET_TO_BUFFER] = false; //< might be possible
@@ -217,19 +176,7 @@ namespace love
 
     void Graphics::clear(OptionalColor color, OptionalInt stencil, OptionalDouble depth)
     {
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            if (color.hasValue) {
-                fprintf(logFile, "Graphics::clear() with color: R=%.2f G=%.2f B=%.2f A=%.2f\n", 
-                       color.value.r, color.value.g, color.value.b, color.value.a);
-            } else {
-                fprintf(logFile, "Graphics::clear() with background color\n");
-            }
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
+        LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 10, 60, "clear() color=%s", color.hasValue ? "set" : "background");
         
         // Ensure we're in a frame before clearing
         gx2.ensureInFrame();
@@ -257,16 +204,8 @@ namespace love
             }
         }
 
-        if (color.hasValue || stencil.hasValue || depth.hasValue) {
-#ifdef __WIIU__
-            // Only flush if we're not in emergency mode and have drawn enough to matter
-            if (!WiiUGraphicsOptimizer::isInEmergencyMode()) {
-                this->flushBatchedDraws();
-            }
-#else
+        if (color.hasValue || stencil.hasValue || depth.hasValue)
             this->flushBatchedDraws();
-#endif
-        }
 
         if (color.hasValue)
         {
@@ -275,15 +214,6 @@ namespace love
         }
 
         gx2.bindFramebuffer(&gx2.getInternalBackbuffer());
-        
-#ifdef __WIIU__
-        FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile2) {
-            fprintf(logFile2, "Graphics::clear() completed\n");
-            fflush(logFile2);
-            fclose(logFile2);
-        }
-#endif
     }
 
     GX2ColorBuffer Graphics::getInternalBackbuffer() const
@@ -336,15 +266,6 @@ namespace love
 
     void Graphics::present(void* screenshotCallbackData)
     {
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "Graphics::present() called - about to flush batched draws\n");
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
-        
         if (!this->isActive())
             return;
 
@@ -358,57 +279,24 @@ namespace love
         // Enhanced rendering path with CafeGLSL shaders
         if (CafeGLSLCompiler::IsAvailable())
         {
-#ifdef __WIIU__
-            static int cafeGLSLFrameCount = 0;
-            cafeGLSLFrameCount++;
-            if (cafeGLSLFrameCount <= 5 || cafeGLSLFrameCount % 120 == 0) {
-                FILE* cafeLogFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (cafeLogFile) {
-                    fprintf(cafeLogFile, "present() using CafeGLSL enhanced rendering (frame %d)\n", cafeGLSLFrameCount);
-                    fflush(cafeLogFile);
-                    fclose(cafeLogFile);
-                }
-            }
-#endif
+            LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 5, 120, "present() using CafeGLSL rendering");
             // TODO: Add enhanced UI shader rendering here
         }
 #endif
 
-#ifdef __WIIU__
-        static int presentFlushCount = 0;
-        presentFlushCount++;
-        if (presentFlushCount <= 10 || presentFlushCount % 60 == 0) {
-            FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile2) {
-                fprintf(logFile2, "present() flushed batched draws (#%d)\n", presentFlushCount);
-                fflush(logFile2);
-                fclose(logFile2);
-            }
-        }
-#endif
-
-#ifdef __WIIU__
-        FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile3) {
-            fprintf(logFile3, "Graphics::present() - about to call gx2.present()\n");
-            fflush(logFile3);
-            fclose(logFile3);
-        }
-#endif
+        LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 10, 60, "present() %d draw call(s), %d batched, %d merged",
+                         this->drawCalls, this->drawCallsBatched, this->drawCallsMerged);
 
         gx2.present();
 
-#ifdef __WIIU__
-        FILE* logFile4 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile4) {
-            fprintf(logFile4, "Graphics::present() completed\n");
-            fflush(logFile4);
-            fclose(logFile4);
-        }
-#endif
-
         this->drawCalls        = 0;
         this->drawCallsBatched = 0;
+        this->drawCallsMerged  = 0;
+        this->drawCallsIndex32 = 0;
+
+        this->drawCallsReordered        = 0;
+        this->batchesMergedByReordering = 0;
+        this->drawCallsCulled           = 0;
         Shader::shaderSwitches = 0;
     }
 
@@ -541,77 +429,33 @@ namespace love
 
     ShaderStageBase* Graphics::newShaderStageInternal(ShaderStageType stage, const std::string& filepath)
     {
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "Graphics::newShaderStageInternal() called - stage: %d (%s), filepath: %s\n", 
-                    stage, (stage == 0 ? "VERTEX" : "PIXEL"), filepath.c_str());
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics::newShaderStageInternal() called - stage: %d (%s), filepath: %s", stage, (stage == 0 ? "VERTEX" : "PIXEL"), filepath.c_str());
         return new ShaderStage(stage, filepath);
     }
 
     ShaderBase* Graphics::newShaderInternal(StrongRef<ShaderStageBase> stages[SHADERSTAGE_MAX_ENUM],
                                             const ShaderBase::CompileOptions& options)
     {
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "Graphics::newShaderInternal() called - about to create new Shader\n");
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics::newShaderInternal() called - about to create new Shader");
         Shader* shader = new Shader(stages, options);
-#ifdef __WIIU__
-        FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile2) {
-            fprintf(logFile2, "Graphics::newShaderInternal() - Shader created successfully: %p\n", shader);
-            fflush(logFile2);
-            fclose(logFile2);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics::newShaderInternal() - Shader created successfully: %p", shader);
         return shader;
     }
 
     bool Graphics::setMode(int width, int height, int pixelWidth, int pixelHeight, bool backBufferStencil,
                            bool backBufferDepth, int msaa)
     {
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "Graphics::setMode() called with %dx%d (pixel: %dx%d)\n", 
-                    width, height, pixelWidth, pixelHeight);
-            fprintf(logFile, "Graphics::setMode() - current transform matrix dump:\n");
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics::setMode() called with %dx%d (pixel: %dx%d)", width, height, pixelWidth, pixelHeight);
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics::setMode() - current transform matrix dump:");
         
         gx2.initialize();
 
-#ifdef __WIIU__
-        FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile2) {
-            fprintf(logFile2, "Graphics: gx2.initialize() completed\n");
-            fflush(logFile2);
-            fclose(logFile2);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics: gx2.initialize() completed");
 
         this->created = true;
         this->initCapabilities();
 
-#ifdef __WIIU__
-        FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile3) {
-            fprintf(logFile3, "Graphics: initCapabilities() completed\n");
-            fflush(logFile3);
-            fclose(logFile3);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics: initCapabilities() completed");
 
         // gx2.setupContext();
 
@@ -619,92 +463,39 @@ namespace love
         {
             if (this->batchedDrawState.vertexBuffer == nullptr)
             {
-#ifdef __WIIU__
-                FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile) {
-                    fprintf(logFile, "Graphics: About to create index buffer with size %d\n", INIT_INDEX_BUFFER_SIZE);
-                    fflush(logFile);
-                    fclose(logFile);
-                }
-#endif
+                LOVE_LOG_TRACE(GRAPHICS, "Graphics: About to create index buffer with size %d", INIT_INDEX_BUFFER_SIZE);
                 this->batchedDrawState.indexBuffer  = newIndexBuffer(INIT_INDEX_BUFFER_SIZE);
-#ifdef __WIIU__
-                FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile2) {
-                    fprintf(logFile2, "Graphics: Index buffer created successfully\n");
-                    fflush(logFile2);
-                    fclose(logFile2);
-                }
-#endif
+                LOVE_LOG_TRACE(GRAPHICS, "Graphics: Index buffer created successfully");
                 
-#ifdef __WIIU__
-                FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile3) {
-                    fprintf(logFile3, "Graphics: About to create vertex buffer with size %d\n", INIT_VERTEX_BUFFER_SIZE);
-                    fflush(logFile3);
-                    fclose(logFile3);
-                }
-#endif
+                LOVE_LOG_TRACE(GRAPHICS, "Graphics: About to create vertex buffer with size %d", INIT_VERTEX_BUFFER_SIZE);
                 this->batchedDrawState.vertexBuffer = newVertexBuffer(INIT_VERTEX_BUFFER_SIZE);
-#ifdef __WIIU__
-                FILE* logFile4 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile4) {
-                    fprintf(logFile4, "Graphics: Vertex buffer created successfully\n");
-                    fflush(logFile4);
-                    fclose(logFile4);
-                }
-#endif
+                LOVE_LOG_TRACE(GRAPHICS, "Graphics: Vertex buffer created successfully");
             }
+
+            if (this->batchedDrawState.quadIndexBuffer == nullptr)
+                this->batchedDrawState.quadIndexBuffer = newQuadIndexBuffer();
         }
         catch (love::Exception&)
         {
             throw;
         }
 
-#ifdef __WIIU__
-        FILE* logFile5 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile5) {
-            fprintf(logFile5, "Graphics: Buffers created, about to load volatile objects\n");
-            fflush(logFile5);
-            fclose(logFile5);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics: Buffers created, about to load volatile objects");
 
         if (!Volatile::loadAll())
             std::printf("Failed to load all volatile objects.\n");
 
-#ifdef __WIIU__
-        FILE* logFile6 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile6) {
-            fprintf(logFile6, "Graphics: Volatile objects loaded, about to restore state\n");
-            fflush(logFile6);
-            fclose(logFile6);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics: Volatile objects loaded, about to restore state");
 
         this->restoreState(this->states.back());
 
-#ifdef __WIIU__
-        FILE* logFile7 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile7) {
-            fprintf(logFile7, "Graphics: State restored, about to create standard shaders\n");
-            fflush(logFile7);
-            fclose(logFile7);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics: State restored, about to create standard shaders");
 
         for (int index = 0; index < ShaderBase::STANDARD_MAX_ENUM; index++)
         {
             auto type = (Shader::StandardShader)index;
 
-#ifdef __WIIU__
-            FILE* logFile8 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile8) {
-                fprintf(logFile8, "Graphics: Creating standard shader %d\n", index);
-                fflush(logFile8);
-                fclose(logFile8);
-            }
-#endif
+            LOVE_LOG_TRACE(GRAPHICS, "Graphics: Creating standard shader %d", index);
 
             if (!Shader::standardShaders[index])
             {
@@ -714,66 +505,30 @@ namespace love
                 stages.push_back(Shader::getDefaultStagePath(type, SHADERSTAGE_VERTEX));
                 stages.push_back(Shader::getDefaultStagePath(type, SHADERSTAGE_PIXEL));
 
-#ifdef __WIIU__
-                FILE* logFile9 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile9) {
-                    fprintf(logFile9, "Graphics: About to create shader %d with stages\n", index);
-                    fflush(logFile9);
-                    fclose(logFile9);
-                }
-#endif
+                LOVE_LOG_TRACE(GRAPHICS, "Graphics: About to create shader %d with stages", index);
 
                 try
                 {
                     Shader::standardShaders[type] = this->newShader(stages, options);
-#ifdef __WIIU__
-                    FILE* logFile10 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                    if (logFile10) {
-                        fprintf(logFile10, "Graphics: Shader %d created successfully\n", index);
-                        fflush(logFile10);
-                        fclose(logFile10);
-                    }
-#endif
+                    LOVE_LOG_TRACE(GRAPHICS, "Graphics: Shader %d created successfully", index);
                 }
                 catch (const std::exception& e)
                 {
-#ifdef __WIIU__
-                    FILE* logFile11 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                    if (logFile11) {
-                        fprintf(logFile11, "Graphics: Exception creating shader %d: %s\n", index, e.what());
-                        fflush(logFile11);
-                        fclose(logFile11);
-                    }
-#endif
+                    LOVE_LOG_ERROR(GRAPHICS, "Failed to create standard shader %d: %s", index, e.what());
                     throw;
                 }
             }
         }
 
-#ifdef __WIIU__
-        FILE* logFile12 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile12) {
-            fprintf(logFile12, "Graphics: All standard shaders created, about to attach default shader\n");
-            fflush(logFile12);
-            fclose(logFile12);
-        }
-#endif
+        /* anything the standard shaders didn't take would otherwise stay in memory */
+        this->shaderPreloader->clear();
+
+        LOVE_LOG_TRACE(GRAPHICS, "Graphics: All standard shaders created, about to attach default shader");
 
         if (!Shader::current)
             Shader::standardShaders[Shader::STANDARD_DEFAULT]->attach();
 
-#ifdef __WIIU__
-        FILE* logFile13 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile13) {
-            fprintf(logFile13, "Graphics: Default shader attached, setMode() completed successfully\n");
-            fflush(logFile13);
-            fclose(logFile13);
-        }
-        
-        // Show that graphics system is ready
-        // Note: We cannot call drawLove2DLoading here as it might conflict with GX2
-        // Instead we'll log that graphics is ready for the main loop
-#endif
+        LOVE_LOG_INFO(GRAPHICS, "setMode() completed, default shader attached");
 
         return true;
     }
@@ -794,57 +549,35 @@ namespace love
 
     void Graphics::draw(const DrawIndexedCommand& command)
     {
-#ifdef __WIIU__
-        // Skip excessive draw calls to prevent performance issues
-        if (WiiUGraphicsOptimizer::shouldSkipDrawCall()) {
-            return;
-        }
-        
-        // Only call prepareDraw if really needed
-        static int frameNumber = 0;
-        if (!WiiUGraphicsOptimizer::shouldSkipPrepareDraw(frameNumber)) {
-            gx2.prepareDraw(this);
-        }
-#else
         gx2.prepareDraw(this);
-#endif
-        
-        gx2.bindTextureToUnit(command.texture, 0);
         // gx2.setCullMode(command.cullMode);
 
-        const auto mode              = GX2::getPrimitiveType(command.primitiveType);
-        auto* buffer                 = (GX2RBuffer*)command.indexBuffer->getHandle();
-        const auto indexType         = GX2::getIndexType(command.indexType);
-        const uint32_t count         = (uint32_t)command.indexCount;
-        const uint32_t offset        = (uint32_t)command.indexBufferOffset;
-        const uint32_t instanceCount = (uint32_t)command.instanceCount;
-
-        GX2RDrawIndexed(mode, buffer, indexType, count, offset, 0, instanceCount);
-        ++this->drawCalls;
+        if (gx2.queueDraw(command))
+            ++this->drawCallsMerged;
+        else
+            ++this->drawCalls;
     }
 
     void Graphics::draw(const DrawCommand& command)
     {
-#ifdef __WIIU__
-        // Skip excessive draw calls to prevent performance issues
-        if (WiiUGraphicsOptimizer::shouldSkipDrawCall()) {
-            return;
-        }
-        
-        // Only call prepareDraw if really needed
-        static int frameNumber = 0;
-        if (!WiiUGraphicsOptimizer::shouldSkipPrepareDraw(frameNumber)) {
-            gx2.prepareDraw(this);
-        }
-#else
         gx2.prepareDraw(this);
-#endif
 
-        const auto mode        = GX2::getPrimitiveType(command.primitiveType);
-        const auto vertexCount = command.vertexCount;
-        const auto vertexStart = command.vertexStart;
+        if (gx2.queueDraw(command))
+            ++this->drawCallsMerged;
+        else
+            ++this->drawCalls;
+    }
+
+    void Graphics::submitDeferredDraws()
+    {
+        gx2.submitDraws();
+    }
+
+    void Graphics::getBackendStats(Stats& stats) const
+    {
+        const auto& state = gx2.getStateStats();
 
-        GX2DrawEx(mode, vertexCount, vertexStart, 1);
-        ++this->drawCalls;
+        stats.stateChanges        = state.emitted;
+        stats.stateChangesSkipped = state.skipped;
     }
 } // namespace love
@@ -1,7 +1,10 @@
 #include "common/Exception.hpp"
+#include "common/Logger.hpp"
 #include "common/config.hpp"
 #include "common/screen.hpp"
 
+#include "driver/graphics/DataBuffer.tcc"
+
 #include "modules/graphics/Shader.hpp"
 #include "modules/graphics/ShaderStage.hpp"
 
@@ -9,6 +12,7 @@
 #include <gx2/mem.h>
 #include <whb/gfx.h>
 
+#include <cstdint>
 #include <malloc.h>
 
 #define SHADERS_DIR "/vol/content/shaders/"
@@ -20,25 +24,17 @@
 namespace love
 {
     Shader::Shader(StrongRef<ShaderStageBase> _stages[SHADERSTAGE_MAX_ENUM], const CompileOptions& options) :
-        ShaderBase(_stages, options)
+        ShaderBase(_stages, options),
+        program {},
+        stagedBlocks {},
+        uniformUploads {},
+        uniformUploadCount(0),
+        uniformUploadFrame(0),
+        uniformUpload(nullptr)
     {
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "Shader::Shader() constructor called\n");
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
+        LOVE_LOG_DEBUG(SHADER, "Shader::Shader() constructor called");
         this->loadVolatile();
-#ifdef __WIIU__
-        FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile2) {
-            fprintf(logFile2, "Shader::Shader() loadVolatile() completed\n");
-            fflush(logFile2);
-            fclose(logFile2);
-        }
-#endif
+        LOVE_LOG_DEBUG(SHADER, "Shader::Shader() loadVolatile() completed");
     }
 
     Shader::~Shader()
@@ -62,6 +58,113 @@ namespace love
         }
     }
 
+    /* GX2 names matrices FLOATCxR: C columns of R components */
+    static bool getUniformLayout(GX2ShaderVarType type, ShaderBase::UniformType& uniformType, int& components,
+                                 int& columns)
+    {
+        // clang-format off
+        switch (type)
+        {
+            case GX2_SHADER_VAR_TYPE_FLOAT:    uniformType = ShaderBase::UNIFORM_FLOAT;  components = 1; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_FLOAT2:   uniformType = ShaderBase::UNIFORM_FLOAT;  components = 2; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_FLOAT3:   uniformType = ShaderBase::UNIFORM_FLOAT;  components = 3; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_FLOAT4:   uniformType = ShaderBase::UNIFORM_FLOAT;  components = 4; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_INT:      uniformType = ShaderBase::UNIFORM_INT;    components = 1; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_INT2:     uniformType = ShaderBase::UNIFORM_INT;    components = 2; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_INT3:     uniformType = ShaderBase::UNIFORM_INT;    components = 3; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_INT4:     uniformType = ShaderBase::UNIFORM_INT;    components = 4; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_UINT:     uniformType = ShaderBase::UNIFORM_UINT;   components = 1; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_UINT2:    uniformType = ShaderBase::UNIFORM_UINT;   components = 2; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_UINT3:    uniformType = ShaderBase::UNIFORM_UINT;   components = 3; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_UINT4:    uniformType = ShaderBase::UNIFORM_UINT;   components = 4; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_BOOL:     uniformType = ShaderBase::UNIFORM_BOOL;   components = 1; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_BOOL2:    uniformType = ShaderBase::UNIFORM_BOOL;   components = 2; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_BOOL3:    uniformType = ShaderBase::UNIFORM_BOOL;   components = 3; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_BOOL4:    uniformType = ShaderBase::UNIFORM_BOOL;   components = 4; columns = 1; return true;
+            case GX2_SHADER_VAR_TYPE_FLOAT2X2: uniformType = ShaderBase::UNIFORM_MATRIX; components = 2; columns = 2; return true;
+            case GX2_SHADER_VAR_TYPE_FLOAT2X3: uniformType = ShaderBase::UNIFORM_MATRIX; components = 3; columns = 2; return true;
+            case GX2_SHADER_VAR_TYPE_FLOAT2X4: uniformType = ShaderBase::UNIFORM_MATRIX; components = 4; columns = 2; return true;
+            case GX2_SHADER_VAR_TYPE_FLOAT3X2: uniformType = ShaderBase::UNIFORM_MATRIX; components = 2; columns = 3; return true;
+            case GX2_SHADER_VAR_TYPE_FLOAT3X3: uniformType = ShaderBase::UNIFORM_MATRIX; components = 3; columns = 3; return true;
+            case GX2_SHADER_VAR_TYPE_FLOAT3X4: uniformType = ShaderBase::UNIFORM_MATRIX; components = 4; columns = 3; return true;
+            case GX2_SHADER_VAR_TYPE_FLOAT4X2: uniformType = ShaderBase::UNIFORM_MATRIX; components = 2; columns = 4; return true;
+            case GX2_SHADER_VAR_TYPE_FLOAT4X3: uniformType = ShaderBase::UNIFORM_MATRIX; components = 3; columns = 4; return true;
+            case GX2_SHADER_VAR_TYPE_FLOAT4X4: uniformType = ShaderBase::UNIFORM_MATRIX; components = 4; columns = 4; return true;
+            default:
+                return false;
+        }
+        // clang-format on
+    }
+
+    /*
+    ** Gives every user uniform block (anything but the builtin Transformation
+    ** block) a region in the staging block and points its variables there.
+    ** Array elements and matrix columns each take a full vec4 slot.
+    */
+    template<typename T>
+    void Shader::mapUniformBlocks(const T* shader, ShaderStageType stage)
+    {
+        static constexpr size_t NOT_STAGED = SIZE_MAX;
+
+        std::vector<size_t> blockOffsets(shader->uniformBlockCount, NOT_STAGED);
+
+        for (uint32_t index = 0; index < shader->uniformBlockCount; index++)
+        {
+            const auto& block = shader->uniformBlocks[index];
+            BuiltinUniform builtin;
+
+            if (block.name == nullptr || getConstant(block.name, builtin))
+                continue;
+
+            const size_t align  = GX2_UNIFORM_BLOCK_ALIGNMENT;
+            const size_t offset = (this->uniformStaging.size() + align - 1) & ~(align - 1);
+
+            this->uniformStaging.resize(offset + ((block.size + 3) & ~3u));
+            this->stagedBlocks.push_back({ stage, block.offset, offset, block.size });
+
+            blockOffsets[index] = offset;
+        }
+
+        for (uint32_t index = 0; index < shader->uniformVarCount; index++)
+        {
+            const auto& variable = shader->uniformVars[index];
+
+            if (variable.name == nullptr || variable.block < 0 ||
+                (uint32_t)variable.block >= shader->uniformBlockCount ||
+                blockOffsets[variable.block] == NOT_STAGED)
+                continue;
+
+            UniformType type;
+            int components = 0, columns = 0;
+
+            if (!getUniformLayout(variable.type, type, components, columns))
+                continue;
+
+            auto& info = this->reflection.uniforms[variable.name];
+
+            if (info == nullptr)
+            {
+                info = new UniformInfo {
+                    .type         = type,
+                    .stageMask    = 0,
+                    .active       = true,
+                    .location     = variable.offset,
+                    .count        = (int)variable.count,
+                    .name         = variable.name,
+                    .components   = components,
+                    .columns      = columns,
+                    .stride       = columns * 4 * sizeof(uint32_t),
+                    .columnStride = 4 * sizeof(uint32_t),
+                };
+            }
+            else if (info->components != components || info->columns != columns)
+                continue;
+
+            info->stageMask |= 1u << stage;
+            info->offset[stage] = blockOffsets[variable.block] + variable.offset * sizeof(uint32_t);
+        }
+    }
+
     void Shader::mapActiveUniforms()
     {
         const auto uniformBlockCount = this->program.vertexShader->uniformBlockCount;
@@ -97,6 +200,9 @@ namespace love
                                   .name      = sampler.name,
                               });
         }
+
+        this->mapUniformBlocks(this->program.vertexShader, SHADERSTAGE_VERTEX);
+        this->mapUniformBlocks(this->program.pixelShader, SHADERSTAGE_PIXEL);
     }
 
     bool Shader::setShaderStages(WHBGfxShaderGroup* group, std::array<StrongRef<ShaderStageBase>, 2> stages)
@@ -115,48 +221,30 @@ namespace love
         return true;
     }
 
+    /* optional inputs fed from the instance mesh in buffer 1, one element per instance */
+    void Shader::initInstanceAttribute(const char* name, uint32_t offset, GX2AttribFormat format)
+    {
+        if (!WHBGfxInitShaderAttribute(&this->program, name, 1, offset, format))
+            return;
+
+        auto& attribute      = this->program.attributes[this->program.numAttributes - 1];
+        attribute.type       = GX2_ATTRIB_INDEX_PER_INSTANCE;
+        attribute.aluDivisor = 1;
+    }
+
     bool Shader::loadVolatile()
     {
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "Shader::loadVolatile() starting\n");
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
+        LOVE_LOG_DEBUG(SHADER, "Shader::loadVolatile() starting");
         
         for (const auto& stage : this->stages)
         {
             if (stage.get() != nullptr)
             {
-#ifdef __WIIU__
-                FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile2) {
-                    fprintf(logFile2, "Shader::loadVolatile() - loading stage %p\n", stage.get());
-                    fflush(logFile2);
-                    fclose(logFile2);
-                }
-#endif
+                LOVE_LOG_DEBUG(SHADER, "Shader::loadVolatile() - loading stage %p", stage.get());
                 bool stageLoadResult = ((ShaderStage*)stage.get())->loadVolatile();
-#ifdef __WIIU__
-                FILE* logFile2b = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile2b) {
-                    fprintf(logFile2b, "Shader::loadVolatile() - stage %p loadVolatile() returned: %s\n", 
-                            stage.get(), stageLoadResult ? "SUCCESS" : "FAILURE");
-                    fflush(logFile2b);
-                    fclose(logFile2b);
-                }
-#endif
+                LOVE_LOG_DEBUG(SHADER, "Shader::loadVolatile() - stage %p loadVolatile() returned: %s", stage.get(), stageLoadResult ? "SUCCESS" : "FAILURE");
                 if (!stageLoadResult) {
-#ifdef __WIIU__
-                    FILE* logFile2c = fopen("fs:/vol/external01/simple_debug.log", "a");
-                    if (logFile2c) {
-                        fprintf(logFile2c, "Shader::loadVolatile() - STAGE LOAD FAILED! Aborting shader load.\n");
-                        fflush(logFile2c);
-                        fclose(logFile2c);
-                    }
-#endif
+                    LOVE_LOG_DEBUG(SHADER, "Shader::loadVolatile() - STAGE LOAD FAILED! Aborting shader load.");
                     return false;
                 }
             }
@@ -164,82 +252,38 @@ namespace love
 
         if (!this->setShaderStages(&this->program, this->stages))
         {
-#ifdef __WIIU__
-            FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile3) {
-                fprintf(logFile3, "Shader::loadVolatile() - setShaderStages() failed\n");
-                fflush(logFile3);
-                fclose(logFile3);
-            }
-#endif
+            LOVE_LOG_DEBUG(SHADER, "Shader::loadVolatile() - setShaderStages() failed");
             return false;  // Changed from true to false - this should be an error!
         }
 
-#ifdef __WIIU__
-        FILE* logFile3b = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile3b) {
-            fprintf(logFile3b, "Shader::loadVolatile() - setShaderStages() succeeded, calling mapActiveUniforms()\n");
-            fflush(logFile3b);
-            fclose(logFile3b);
-        }
-#endif
+        LOVE_LOG_DEBUG(SHADER, "Shader::loadVolatile() - setShaderStages() succeeded, calling mapActiveUniforms()");
 
         this->mapActiveUniforms();
+        this->mapBuiltinUniforms();
 
-#ifdef __WIIU__
-        FILE* logFile3c = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile3c) {
-            fprintf(logFile3c, "Shader::loadVolatile() - mapActiveUniforms() completed, initializing shader attributes\n");
-            fflush(logFile3c);
-            fclose(logFile3c);
-        }
-#endif
+        LOVE_LOG_DEBUG(SHADER, "Shader::loadVolatile() - mapActiveUniforms() completed, initializing shader attributes");
 
         // clang-format off
         WHBGfxInitShaderAttribute(&this->program, "inPos",      0, POSITION_OFFSET, GX2_ATTRIB_FORMAT_FLOAT_32_32);
         WHBGfxInitShaderAttribute(&this->program, "inTexCoord", 0, TEXCOORD_OFFSET, GX2_ATTRIB_FORMAT_FLOAT_32_32);
-        WHBGfxInitShaderAttribute(&this->program, "inColor",    0, COLOR_OFFSET,    GX2_ATTRIB_FORMAT_FLOAT_32_32_32_32);
+        WHBGfxInitShaderAttribute(&this->program, "inColor",    0, COLOR_OFFSET,    GX2_ATTRIB_FORMAT_UNORM_8_8_8_8);
         // clang-format on
 
-#ifdef __WIIU__
-        FILE* logFile3d = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile3d) {
-            fprintf(logFile3d, "Shader::loadVolatile() - shader attributes initialized, calling WHBGfxInitFetchShader()\n");
-            fflush(logFile3d);
-            fclose(logFile3d);
-        }
-#endif
+        this->initInstanceAttribute("inInstancePos",      POSITION_OFFSET, GX2_ATTRIB_FORMAT_FLOAT_32_32);
+        this->initInstanceAttribute("inInstanceTexCoord", TEXCOORD_OFFSET, GX2_ATTRIB_FORMAT_FLOAT_32_32);
+        this->initInstanceAttribute("inInstanceColor",    COLOR_OFFSET,    GX2_ATTRIB_FORMAT_UNORM_8_8_8_8);
+
+        LOVE_LOG_DEBUG(SHADER, "Shader::loadVolatile() - shader attributes initialized, calling WHBGfxInitFetchShader()");
 
         if (!WHBGfxInitFetchShader(&this->program))
         {
-#ifdef __WIIU__
-            FILE* logFile4 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile4) {
-                fprintf(logFile4, "Shader::loadVolatile() - WHBGfxInitFetchShader() failed\n");
-                fflush(logFile4);
-                fclose(logFile4);
-            }
-#endif
+            LOVE_LOG_DEBUG(SHADER, "Shader::loadVolatile() - WHBGfxInitFetchShader() failed");
             return false;
         }
 
-#ifdef __WIIU__
-        FILE* logFile4b = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile4b) {
-            fprintf(logFile4b, "Shader::loadVolatile() - WHBGfxInitFetchShader() succeeded\n");
-            fflush(logFile4b);
-            fclose(logFile4b);
-        }
-#endif
-
-#ifdef __WIIU__
-        FILE* logFile5 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile5) {
-            fprintf(logFile5, "Shader::loadVolatile() completed successfully\n");
-            fflush(logFile5);
-            fclose(logFile5);
-        }
-#endif
+        LOVE_LOG_DEBUG(SHADER, "Shader::loadVolatile() - WHBGfxInitFetchShader() succeeded");
+
+        LOVE_LOG_DEBUG(SHADER, "Shader::loadVolatile() completed successfully");
 
         return true;
     }
@@ -250,6 +294,29 @@ namespace love
 
         for (auto& it : this->reflection.uniforms)
             delete it.second;
+
+        this->reflection.uniforms.clear();
+        this->mapBuiltinUniforms();
+
+        this->stagedBlocks.clear();
+        this->uniformStaging.clear();
+        this->uniformsDirty = false;
+
+        this->freeUniformUploads();
+    }
+
+    void Shader::freeUniformUploads()
+    {
+        for (auto& pool : this->uniformUploads)
+        {
+            for (auto* upload : pool)
+                free(upload);
+
+            pool.clear();
+        }
+
+        this->uniformUploadCount = 0;
+        this->uniformUpload      = nullptr;
     }
 
     std::string Shader::getWarnings() const
@@ -270,21 +337,77 @@ namespace love
         return warnings;
     }
 
-    void Shader::updateBuiltinUniforms(GraphicsBase* graphics, Uniform* uniform)
+    void Shader::updateBuiltinUniforms(Uniform* uniform)
     {
-        if (current != this)
+        auto* uniformBlock = this->builtinUniformInfo[BUILTIN_UNIFORMS_PER_DRAW];
+
+        if (!uniformBlock)
             return;
 
-        auto& transform = graphics->getTransform();
-        // uniform->update(transform);
+        /* the block was flushed from the CPU cache when it was written, see GX2::writeUniform */
+        GX2SetVertexUniformBlock(uniformBlock->location, UNIFORM_SIZE, uniform);
+    }
 
-        auto* uniformBlock = this->getUniformInfo("Transformation");
+    const uint8_t* Shader::getUniformUpload()
+    {
+        if (this->stagedBlocks.empty())
+            return nullptr;
 
-        if (!uniformBlock)
+        if (this->uniformUploadFrame != DataBufferFrame::current)
+        {
+            this->uniformUploadFrame = DataBufferFrame::current;
+            this->uniformUploadCount = 0;
+            this->uniformUpload      = nullptr;
+        }
+
+        if (this->uniformUpload != nullptr && !this->uniformsDirty)
+            return this->uniformUpload;
+
+        /* blocks are recycled BUFFER_FRAMES frames later, like GX2's transform uniforms */
+        auto& pool        = this->uniformUploads[this->uniformUploadFrame % BUFFER_FRAMES];
+        const size_t size = this->uniformStaging.size();
+
+        if (this->uniformUploadCount == pool.size())
+        {
+            auto* block = (uint8_t*)memalign(GX2_UNIFORM_BLOCK_ALIGNMENT, size);
+
+            if (block == nullptr)
+                throw love::Exception(E_OUT_OF_MEMORY);
+
+            pool.push_back(block);
+        }
+
+        auto* upload = pool[this->uniformUploadCount++];
+
+        /* the GPU reads uniform blocks little-endian, see GX2::getTransformUniform */
+        const auto* source    = (const uint32_t*)this->uniformStaging.data();
+        uint32_t* destination = (uint32_t*)upload;
+
+        for (size_t index = 0; index < size / sizeof(uint32_t); index++)
+            destination[index] = __builtin_bswap32(source[index]);
+
+        GX2Invalidate(GX2_INVALIDATE_MODE_CPU | GX2_INVALIDATE_MODE_UNIFORM_BLOCK, upload, size);
+
+        this->uniformUpload = upload;
+        this->uniformsDirty = false;
+
+        return upload;
+    }
+
+    void Shader::bindUniforms(const uint8_t* upload)
+    {
+        if (upload == nullptr)
             return;
 
-        GX2Invalidate(INVALIDATE_UNIFORM_BLOCK, uniform, UNIFORM_SIZE);
-        GX2SetVertexUniformBlock(uniformBlock->location, UNIFORM_SIZE, uniform);
+        for (const auto& block : this->stagedBlocks)
+        {
+            auto* data = (void*)(upload + block.offset);
+
+            if (block.stage == SHADERSTAGE_VERTEX)
+                GX2SetVertexUniformBlock(block.location, block.size, data);
+            else
+                GX2SetPixelUniformBlock(block.location, block.size, data);
+        }
     }
 
     ptrdiff_t Shader::getHandle() const
@@ -296,60 +419,21 @@ namespace love
     {
         if (current != this)
         {
-#ifdef __WIIU__
-            static int attachCount = 0;
-            attachCount++;
-            
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "Shader::attach() #%d: Switching to shader %p (was %p)\n", 
-                        attachCount, this, current);
-                        
-                // Log which standard shader this is
-                const char* shaderTypeName = "unknown";
-                for (int i = 0; i < STANDARD_MAX_ENUM; i++) {
-                    if (this == standardShaders[i]) {
-                        switch(i) {
-                            case STANDARD_DEFAULT: shaderTypeName = "STANDARD_DEFAULT"; break;
-                            case STANDARD_TEXTURE: shaderTypeName = "STANDARD_TEXTURE"; break;
-                            case STANDARD_VIDEO: shaderTypeName = "STANDARD_VIDEO"; break;
-                        }
-                        break;
-                    }
-                }
-                fprintf(logFile, "  Shader type: %s\n", shaderTypeName);
-                fprintf(logFile, "  Vertex shader: %p, Pixel shader: %p\n", 
-                        this->program.vertexShader, this->program.pixelShader);
-                
-                fflush(logFile);
-                fclose(logFile);
-            }
-#endif
+            LOVE_LOG_TRACE(SHADER, "attach() switching to shader %p (was %p)", (void*)this, (void*)current);
 
             Graphics::flushBatchedDrawsGlobal();
 
-            GX2SetShaderMode(GX2_SHADER_MODE_UNIFORM_BLOCK);
-
-            GX2SetFetchShader(&this->program.fetchShader);
-            GX2SetVertexShader(this->program.vertexShader);
-            GX2SetPixelShader(this->program.pixelShader);
-
             current = this;
             shaderSwitches++;
         }
-#ifdef __WIIU__
-        else {
-            static int skipCount = 0;
-            skipCount++;
-            if (skipCount <= 5 || skipCount % 100 == 0) {
-                FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile) {
-                    fprintf(logFile, "Shader::attach() skipped: already current (skip #%d)\n", skipCount);
-                    fflush(logFile);
-                    fclose(logFile);
-                }
-            }
-        }
-#endif
+    }
+
+    void Shader::bind()
+    {
+        GX2SetShaderMode(GX2_SHADER_MODE_UNIFORM_BLOCK);
+
+        GX2SetFetchShader(&this->program.fetchShader);
+        GX2SetVertexShader(this->program.vertexShader);
+        GX2SetPixelShader(this->program.pixelShader);
     }
 } // namespace love
@@ -1,5 +1,7 @@
 #include "common/Exception.hpp"
+#include "common/Logger.hpp"
 
+#include "modules/graphics/Graphics.hpp"
 #include "modules/graphics/ShaderStage.hpp"
 
 #include <memory>
@@ -19,172 +21,84 @@ namespace love
 
     bool ShaderStage::loadVolatile()
     {
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "ShaderStage::loadVolatile() starting - file: %s\n", this->filepath.c_str());
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
+        LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() starting - file: %s", this->filepath.c_str());
+
+        auto* graphics = Module::getInstance<Graphics>(Module::M_GRAPHICS);
 
-        std::FILE* file = std::fopen(this->filepath.c_str(), "rb");
+        /* the bytes are kept for volatile reloads; a preloaded copy skips the file entirely */
+        if (this->code.empty() && graphics != nullptr &&
+            graphics->takePreloadedShaderStage(this->filepath, this->code))
+            LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() - using preloaded %s", this->filepath.c_str());
 
-        if (!file)
+        if (this->code.empty())
         {
-#ifdef __WIIU__
-            FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile2) {
-                fprintf(logFile2, "ShaderStage::loadVolatile() - Failed to open file: %s\n", this->filepath.c_str());
-                fflush(logFile2);
-                fclose(logFile2);
+            std::FILE* file = std::fopen(this->filepath.c_str(), "rb");
+
+            if (!file)
+            {
+                LOVE_LOG_ERROR(SHADER, "ShaderStage::loadVolatile() - Failed to open file: %s", this->filepath.c_str());
+                this->warnings.append(std::format("Failed to open file {:s}", this->filepath.c_str()));
+                return false;
             }
-#endif
-            this->warnings.append(std::format("Failed to open file {:s}", this->filepath.c_str()));
-            return false;
-        }
 
-#ifdef __WIIU__
-        FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile3) {
-            fprintf(logFile3, "ShaderStage::loadVolatile() - file opened successfully\n");
-            fflush(logFile3);
-            fclose(logFile3);
-        }
-#endif
-
-        std::fseek(file, 0, SEEK_END);
-        long size = std::ftell(file);
-        std::rewind(file);
-
-#ifdef __WIIU__
-        FILE* logFile4 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile4) {
-            fprintf(logFile4, "ShaderStage::loadVolatile() - file size: %ld bytes\n", size);
-            fflush(logFile4);
-            fclose(logFile4);
-        }
-#endif
+            LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() - file opened successfully");
 
-        if (size <= 0)
-        {
-#ifdef __WIIU__
-            FILE* logFile5 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile5) {
-                fprintf(logFile5, "ShaderStage::loadVolatile() - Invalid file size: %ld\n", size);
-                fflush(logFile5);
-                fclose(logFile5);
+            std::fseek(file, 0, SEEK_END);
+            long size = std::ftell(file);
+            std::rewind(file);
+
+            LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() - file size: %ld bytes", size);
+
+            if (size <= 0)
+            {
+                LOVE_LOG_ERROR(SHADER, "ShaderStage::loadVolatile() - Invalid file size: %ld", size);
+                this->warnings.append("Invalid file size.");
+                std::fclose(file);
+                return false;
             }
-#endif
-            this->warnings.append("Invalid file size.");
-            std::fclose(file);
-            return false;
-        }
 
-#ifdef __WIIU__
-        FILE* logFile6 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile6) {
-            fprintf(logFile6, "ShaderStage::loadVolatile() - about to resize code vector to %ld bytes\n", size);
-            fflush(logFile6);
-            fclose(logFile6);
-        }
-#endif
+            LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() - about to resize code vector to %ld bytes", size);
 
-        try
-        {
-            this->code.resize(size);
-#ifdef __WIIU__
-            FILE* logFile7 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile7) {
-                fprintf(logFile7, "ShaderStage::loadVolatile() - code vector resized successfully\n");
-                fflush(logFile7);
-                fclose(logFile7);
+            try
+            {
+                this->code.resize(size);
+                LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() - code vector resized successfully");
             }
-#endif
-        }
-        catch (std::bad_alloc&)
-        {
-#ifdef __WIIU__
-            FILE* logFile8 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile8) {
-                fprintf(logFile8, "ShaderStage::loadVolatile() - OUT OF MEMORY during resize!\n");
-                fflush(logFile8);
-                fclose(logFile8);
+            catch (std::bad_alloc&)
+            {
+                LOVE_LOG_ERROR(SHADER, "ShaderStage::loadVolatile() - OUT OF MEMORY during resize!");
+                std::fclose(file);
+                this->warnings.append(E_OUT_OF_MEMORY);
+                return false;
             }
-#endif
-            std::fclose(file);
-            this->warnings.append(E_OUT_OF_MEMORY);
-            return false;
-        }
 
-        size_t read = std::fread(this->code.data(), size, 1, file);
+            size_t read = std::fread(this->code.data(), size, 1, file);
 
-#ifdef __WIIU__
-        FILE* logFile9 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile9) {
-            fprintf(logFile9, "ShaderStage::loadVolatile() - fread completed, read %zu items (expected 1)\n", read);
-            fflush(logFile9);
-            fclose(logFile9);
-        }
-#endif
+            LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() - fread completed, read %zu items (expected 1)", read);
 
-        if (read < 1)
-        {
-#ifdef __WIIU__
-            FILE* logFile10 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile10) {
-                fprintf(logFile10, "ShaderStage::loadVolatile() - FREAD FAILED! read=%zu, expected=1\n", read);
-                fflush(logFile10);
-                fclose(logFile10);
+            if (read < 1)
+            {
+                LOVE_LOG_ERROR(SHADER, "ShaderStage::loadVolatile() - FREAD FAILED! read=%zu, expected=1", read);
+                this->warnings.append(std::format("Failed to read file '{}'.", this->filepath.c_str()));
+                std::fclose(file);
+                return false;
             }
-#endif
-            this->warnings.append(std::format("Failed to read file '{}'.", this->filepath.c_str()));
+
             std::fclose(file);
-            return false;
         }
 
-        std::fclose(file);
-
-#ifdef __WIIU__
-        FILE* logFile11 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile11) {
-            fprintf(logFile11, "ShaderStage::loadVolatile() - file closed, about to check shader stage type\n");
-            fflush(logFile11);
-            fclose(logFile11);
-        }
-#endif
+        LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() - file closed, about to check shader stage type");
 
         if (this->getStageType() == SHADERSTAGE_VERTEX)
         {
-#ifdef __WIIU__
-            FILE* logFile12 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile12) {
-                fprintf(logFile12, "ShaderStage::loadVolatile() - Loading VERTEX shader, about to call WHBGfxLoadGFDVertexShader\n");
-                fflush(logFile12);
-                fclose(logFile12);
-            }
-#endif
+            LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() - Loading VERTEX shader, about to call WHBGfxLoadGFDVertexShader");
             this->vertex = WHBGfxLoadGFDVertexShader(0, this->code.data());
 
-#ifdef __WIIU__
-            FILE* logFile13 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile13) {
-                fprintf(logFile13, "ShaderStage::loadVolatile() - WHBGfxLoadGFDVertexShader returned: %p\n", this->vertex);
-                fflush(logFile13);
-                fclose(logFile13);
-            }
-#endif
+            LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() - WHBGfxLoadGFDVertexShader returned: %p", this->vertex);
 
             if (!this->vertex)
             {
-#ifdef __WIIU__
-                FILE* logFile14 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile14) {
-                    fprintf(logFile14, "ShaderStage::loadVolatile() - VERTEX SHADER LOAD FAILED!\n");
-                    fflush(logFile14);
-                    fclose(logFile14);
-                }
-#endif
+                LOVE_LOG_ERROR(SHADER, "ShaderStage::loadVolatile() - VERTEX SHADER LOAD FAILED!");
                 this->warnings.append("Failed to load Vertex Shader.");
                 return false;
             }
@@ -192,48 +106,20 @@ namespace love
 
         if (this->getStageType() == SHADERSTAGE_PIXEL)
         {
-#ifdef __WIIU__
-            FILE* logFile15 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile15) {
-                fprintf(logFile15, "ShaderStage::loadVolatile() - Loading PIXEL shader, about to call WHBGfxLoadGFDPixelShader\n");
-                fflush(logFile15);
-                fclose(logFile15);
-            }
-#endif
+            LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() - Loading PIXEL shader, about to call WHBGfxLoadGFDPixelShader");
             this->pixel = WHBGfxLoadGFDPixelShader(0, this->code.data());
 
-#ifdef __WIIU__
-            FILE* logFile16 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile16) {
-                fprintf(logFile16, "ShaderStage::loadVolatile() - WHBGfxLoadGFDPixelShader returned: %p\n", this->pixel);
-                fflush(logFile16);
-                fclose(logFile16);
-            }
-#endif
+            LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() - WHBGfxLoadGFDPixelShader returned: %p", this->pixel);
 
             if (!this->pixel)
             {
-#ifdef __WIIU__
-                FILE* logFile17 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile17) {
-                    fprintf(logFile17, "ShaderStage::loadVolatile() - PIXEL SHADER LOAD FAILED!\n");
-                    fflush(logFile17);
-                    fclose(logFile17);
-                }
-#endif
+                LOVE_LOG_ERROR(SHADER, "ShaderStage::loadVolatile() - PIXEL SHADER LOAD FAILED!");
                 this->warnings.append("Failed to load Pixel Shader.");
                 return false;
             }
         }
 
-#ifdef __WIIU__
-        FILE* logFile18 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile18) {
-            fprintf(logFile18, "ShaderStage::loadVolatile() - COMPLETED SUCCESSFULLY\n");
-            fflush(logFile18);
-            fclose(logFile18);
-        }
-#endif
+        LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() - COMPLETED SUCCESSFULLY");
 
         return true;
     }
@@ -10,6 +10,15 @@
 
 namespace love
 {
+    /* LA8 is stored as R8_G8 and sampled as (L, L, L, A) */
+    static uint32_t getComponentMap(PixelFormat format)
+    {
+        if (format == PIXELFORMAT_LA8_UNORM)
+            return GX2_COMP_MAP(GX2_SQ_SEL_R, GX2_SQ_SEL_R, GX2_SQ_SEL_R, GX2_SQ_SEL_G);
+
+        return GX2_COMP_MAP(GX2_SQ_SEL_R, GX2_SQ_SEL_G, GX2_SQ_SEL_B, GX2_SQ_SEL_A);
+    }
+
     static void createTextureObject(GX2Texture*& texture, PixelFormat format, int width, int height)
     {
         texture = new GX2Texture();
@@ -38,7 +47,7 @@ namespace love
         texture->viewNumMips      = 0;
         texture->viewFirstSlice   = 0;
         texture->viewNumSlices    = 1;
-        texture->compMap          = GX2_COMP_MAP(GX2_SQ_SEL_R, GX2_SQ_SEL_G, GX2_SQ_SEL_B, GX2_SQ_SEL_A);
+        texture->compMap          = getComponentMap(format);
 
         GX2CalcSurfaceSizeAndAlignment(&texture->surface);
         GX2InitTextureRegs(texture);
@@ -55,7 +64,7 @@ namespace love
     Texture::Texture(GraphicsBase* graphics, const Settings& settings, const Slices* data) :
         TextureBase(graphics, settings, data),
         slices(settings.type),
-        sampler {}
+        sampler(nullptr)
     {
         if (data != nullptr)
             slices = *data;
@@ -221,7 +230,7 @@ namespace love
     void Texture::setSamplerState(const SamplerState& state)
     {
         this->samplerState = this->validateSamplerState(state);
-        gx2.setSamplerState(this, this->samplerState);
+        this->sampler      = gx2.setSamplerState(this, this->samplerState);
     }
 
     void Texture::uploadByteData(const void* data, size_t size, int level, int slice, const Rect& rect)
@@ -241,9 +250,11 @@ namespace love
             std::memcpy(destination + destRow, source + srcRow, rect.w * pixelSize);
         }
 
-        const auto imageSize = this->texture->surface.imageSize;
+        /* only the rows that were written need to leave the CPU cache */
+        const auto start = (size_t)rect.y * pitch * pixelSize;
+        const auto end   = (size_t)(rect.y + rect.h) * pitch * pixelSize;
 
-        GX2Invalidate(GX2_INVALIDATE_MODE_CPU_TEXTURE, this->texture->surface.image, imageSize);
+        GX2Invalidate(GX2_INVALIDATE_MODE_CPU_TEXTURE, destination + start, end - start);
         GX2Flush();
     }
 
@@ -262,6 +273,6 @@ namespace love
 
     ptrdiff_t Texture::getSamplerHandle() const
     {
-        return (ptrdiff_t)std::addressof(this->sampler);
+        return (ptrdiff_t)this->sampler;
     }
 } // namespace love
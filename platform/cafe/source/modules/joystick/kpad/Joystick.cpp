@@ -1,7 +1,7 @@
 #include "common/screen.hpp"
 
 #include "modules/joystick/kpad/Joystick.hpp"
-#include "DebugLogger.hpp"
+#include "common/Logger.hpp"
 
 namespace love
 {
@@ -35,7 +35,7 @@ namespace love
                         // Debug output to track input state
                         if (this->status.trigger != 0 || this->status.release != 0)
                         {
-                            DebugLogger::log("KPAD Wiimote Input - Trigger: 0x%08X, Release: 0x%08X, Hold: 0x%08X", 
+                            LOVE_LOG_TRACE(INPUT, "KPAD Wiimote Input - Trigger: 0x%08X, Release: 0x%08X, Hold: 0x%08X", 
                                    this->status.trigger, this->status.release, this->status.hold);
                         }
                         break;
@@ -48,7 +48,7 @@ namespace love
                         // Debug output to track input state
                         if (this->status.classic.trigger != 0 || this->status.classic.release != 0)
                         {
-                            DebugLogger::log("KPAD Classic Input - Trigger: 0x%08X, Release: 0x%08X, Hold: 0x%08X", 
+                            LOVE_LOG_TRACE(INPUT, "KPAD Classic Input - Trigger: 0x%08X, Release: 0x%08X, Hold: 0x%08X", 
                                    this->status.classic.trigger, this->status.classic.release, this->status.classic.hold);
                         }
                         break;
@@ -61,7 +61,7 @@ namespace love
                         // Debug output to track input state
                         if (this->status.pro.trigger != 0 || this->status.pro.release != 0)
                         {
-                            DebugLogger::log("KPAD Pro Input - Trigger: 0x%08X, Release: 0x%08X, Hold: 0x%08X", 
+                            LOVE_LOG_TRACE(INPUT, "KPAD Pro Input - Trigger: 0x%08X, Release: 0x%08X, Hold: 0x%08X", 
                                    this->status.pro.trigger, this->status.pro.release, this->status.pro.hold);
                         }
                         break;
@@ -72,7 +72,7 @@ namespace love
             }
             else
             {
-                DebugLogger::log("KPAD Read Error: %d", this->error);
+                LOVE_LOG_TRACE(INPUT, "KPAD Read Error: %d", this->error);
             }
         }
 
@@ -1,7 +1,7 @@
 #include <cstring>
 
 #include "modules/joystick/vpad/Joystick.hpp"
-#include "DebugLogger.hpp"
+#include "common/Logger.hpp"
 
 namespace love
 {
@@ -33,13 +33,13 @@ namespace love
                 // Debug output to track input state
                 if (status.trigger != 0 || status.release != 0)
                 {
-                    DebugLogger::log("VPAD Input - Trigger: 0x%08X, Release: 0x%08X, Hold: 0x%08X", 
+                    LOVE_LOG_TRACE(INPUT, "VPAD Input - Trigger: 0x%08X, Release: 0x%08X, Hold: 0x%08X", 
                            status.trigger, status.release, status.hold);
                 }
             }
             else
             {
-                DebugLogger::log("VPAD Read Error: %d", this->error);
+                LOVE_LOG_TRACE(INPUT, "VPAD Read Error: %d", this->error);
             }
         }
 
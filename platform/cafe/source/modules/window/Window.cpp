@@ -1,5 +1,5 @@
 #include "modules/window/Window.hpp"
-#include "DebugLogger.hpp"
+#include "common/Logger.hpp"
 #include "driver/EventQueue.hpp"
 
 #include <coreinit/energysaver.h>
@@ -8,7 +8,7 @@ namespace love
 {
     Window::Window() : WindowBase("love.window.gx2")
     {
-        DebugLogger::log("Window constructor called");
+        LOVE_LOG_DEBUG(WINDOW, "Window constructor called");
         
         // Set default window size for Wii U to match graphics system
         this->windowWidth = 800;   // Match what graphics system expects
@@ -18,13 +18,13 @@ namespace love
         this->open = true;  // Set to true immediately for Wii U
         
         this->setDisplaySleepEnabled(false);
-        DebugLogger::log("Window constructor completed - default window %dx%d, open=%s", 
+        LOVE_LOG_DEBUG(WINDOW, "Window constructor completed - default window %dx%d, open=%s", 
                         this->windowWidth, this->windowHeight, this->open ? "true" : "false");
         
         // Send initial resize event to Lua to ensure love.resize is called during startup
-        DebugLogger::log("Sending initial resize event from constructor: %dx%d", this->windowWidth, this->windowHeight);
+        LOVE_LOG_DEBUG(WINDOW, "Sending initial resize event from constructor: %dx%d", this->windowWidth, this->windowHeight);
         EventQueue::getInstance().sendResize(this->windowWidth, this->windowHeight);
-        DebugLogger::log("Initial resize event sent from constructor");
+        LOVE_LOG_DEBUG(WINDOW, "Initial resize event sent from constructor");
     }
 
     Window::~Window()
@@ -53,7 +53,7 @@ namespace love
 
     bool Window::setWindow(int width, int height, WindowSettings* settings)
     {
-        DebugLogger::log("Window::setWindow() called with %dx%d (SIMPLIFIED)", width, height);
+        LOVE_LOG_DEBUG(WINDOW, "Window::setWindow() called with %dx%d (SIMPLIFIED)", width, height);
         
         // Simplified approach for Wii U - just set dimensions and state
         this->windowWidth = width;
@@ -62,38 +62,38 @@ namespace love
         this->pixelHeight = height;
         this->open = true;
         
-        DebugLogger::log("Window dimensions set to %dx%d", width, height);
+        LOVE_LOG_DEBUG(WINDOW, "Window dimensions set to %dx%d", width, height);
         
         // Update settings if provided
         if (settings) {
             this->updateSettings(*settings, false);
-            DebugLogger::log("Window settings updated");
+            LOVE_LOG_DEBUG(WINDOW, "Window settings updated");
         }
         
         // Get graphics module and set mode
         if (!this->graphics.get())
         {
-            DebugLogger::log("Getting graphics module instance...");
+            LOVE_LOG_DEBUG(WINDOW, "Getting graphics module instance...");
             this->graphics.set(Module::getInstance<GraphicsBase>(Module::M_GRAPHICS));
         }
 
         if (this->graphics.get())
         {
-            DebugLogger::log("Setting graphics mode to %dx%d", width, height);
+            LOVE_LOG_DEBUG(WINDOW, "Setting graphics mode to %dx%d", width, height);
             this->graphics->setMode(width, height, width, height, false, false, 0);
-            DebugLogger::log("Graphics mode set successfully");
+            LOVE_LOG_DEBUG(WINDOW, "Graphics mode set successfully");
             
             // Send resize event to Lua to trigger love.resize callback
-            DebugLogger::log("Sending resize event to Lua: %dx%d", width, height);
+            LOVE_LOG_DEBUG(WINDOW, "Sending resize event to Lua: %dx%d", width, height);
             EventQueue::getInstance().sendResize(width, height);
-            DebugLogger::log("Resize event sent successfully");
+            LOVE_LOG_DEBUG(WINDOW, "Resize event sent successfully");
         }
         else
         {
-            DebugLogger::log("WARNING: No graphics module available");
+            LOVE_LOG_WARN(WINDOW, "No graphics module available");
         }
 
-        DebugLogger::log("Window::setWindow() completed successfully (SIMPLIFIED)");
+        LOVE_LOG_DEBUG(WINDOW, "Window::setWindow() completed successfully (SIMPLIFIED)");
         return true;
     }
 
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "driver/EventQueue.tcc"
+
+namespace love
+{
+    /*
+    ** There is no input on the host, so the queue only carries what the
+    ** runtime itself sends (quit, resize, focus, text input).
+    */
+    class EventQueue : public EventQueueBase<EventQueue>
+    {
+      public:
+        EventQueue();
+
+        ~EventQueue();
+
+        void pollInternal() override;
+    };
+} // namespace love
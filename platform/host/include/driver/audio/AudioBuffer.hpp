@@ -0,0 +1,86 @@
+#pragma once
+
+#include "common/Exception.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+namespace love
+{
+    /*
+    ** Host stand-in for a pair of AX voices: holds the deinterleaved PCM
+    ** data and the playback cursor the null mixer advances.
+    */
+    class AudioBuffer
+    {
+      public:
+        AudioBuffer();
+
+        AudioBuffer(const AudioBuffer&) = delete;
+
+        AudioBuffer(AudioBuffer&& other);
+
+        ~AudioBuffer()
+        {}
+
+        void initialize(int channels);
+
+        bool isInitialized() const
+        {
+            return this->ready;
+        }
+
+        bool prepare();
+
+        size_t getSampleCount() const
+        {
+            return this->nsamples;
+        }
+
+        bool isPlaying() const;
+
+        bool isFinished() const;
+
+        void setVolume(float volume);
+
+        size_t getSampleOffset() const;
+
+        /* returns the amount of samples left over once the end was reached */
+        size_t advance(size_t samples);
+
+        void setLooping(bool looping);
+
+        bool isLooping() const;
+
+        int getChannelCount() const
+        {
+            return this->channels;
+        }
+
+        void setChannelCount(int channels)
+        {
+            this->channels = channels;
+        }
+
+        void setPlaying(bool playing)
+        {
+            this->playing = playing;
+        }
+
+      public:
+        std::array<int16_t*, 2> data_pcm16;
+        size_t nsamples;
+        uint32_t offset;
+
+      private:
+        int channels;
+        float volume;
+
+        bool ready;
+        bool looping;
+        std::atomic<bool> playing;
+        std::atomic<bool> queued;
+        std::atomic<size_t> position;
+    };
+} // namespace love
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "driver/DigitalSound.tcc"
+#include "driver/audio/AudioBuffer.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <queue>
+
+namespace love
+{
+    /*
+    ** Null mixer. Channels consume their queued buffers in real time but no
+    ** samples are ever output, so Source state (tell, isPlaying, queue
+    ** refills) behaves like it does on hardware.
+    */
+    class DigitalSound : public DigitalSoundBase<DigitalSound>
+    {
+      public:
+        virtual void initialize() override;
+
+        virtual void deInitialize() override;
+
+        void updateImpl();
+
+        void setMasterVolume(float volume);
+
+        float getMasterVolume() const;
+
+        AudioBuffer createBuffer(int size, int channels);
+
+        void freeBuffer(const AudioBuffer& buffer);
+
+        bool isBufferDone(const AudioBuffer& buffer) const;
+
+        void prepare(AudioBuffer& buffer, void* data, size_t size, int samples);
+
+        size_t getSampleCount(const AudioBuffer& buffer) const;
+
+        void setLooping(AudioBuffer& buffer, bool looping);
+
+        bool channelReset(size_t id, int channels, int bitDepth, int sampleRate);
+
+        void channelSetVolume(size_t id, float volume);
+
+        float channelGetVolume(size_t id) const;
+
+        size_t channelGetSampleOffset(size_t id);
+
+        bool channelAddBuffer(size_t id, AudioBuffer* buffer);
+
+        void channelPause(size_t id, bool paused);
+
+        bool isChannelPaused(size_t id) const;
+
+        bool isChannelPlaying(size_t id) const;
+
+        void channelStop(size_t id);
+
+        static int32_t getFormat(int channels, int bitDepth);
+
+      private:
+        struct Channel
+        {
+            std::queue<AudioBuffer*> buffers;
+            float sampleRate = 48000.0f;
+            float volume     = 1.0f;
+            double pending   = 0.0;
+            bool paused      = false;
+        };
+
+        void stopChannel(Channel& channel);
+
+        std::array<Channel, 24> channels;
+        mutable std::mutex mutex;
+
+        std::chrono::steady_clock::time_point last;
+        float masterVolume = 1.0f;
+    };
+} // namespace love
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "common/Exception.hpp"
+#include "common/Logger.hpp"
+#include "driver/graphics/DataBuffer.tcc"
+
+#include <vector>
+
+namespace love
+{
+    /*
+    ** CPU-only data buffer. Backings are renamed under the same rules as on
+    ** hardware, so getBackingCount() reflects what the console would allocate.
+    */
+    template<typename T>
+    class DataBuffer final : public DataBufferBase<T>
+    {
+      public:
+        DataBuffer(BufferUsage mode, BufferDataUsage dataUsage, size_t size) :
+            DataBufferBase<T>(mode, dataUsage, size),
+            backings {}
+        {
+            this->createBacking();
+            this->usedFrames.push_back(0);
+        }
+
+        DataBuffer(DataBuffer&&) = delete;
+
+        DataBuffer& operator=(const DataBuffer&) = delete;
+
+        ptrdiff_t getHandle() const override
+        {
+            return (ptrdiff_t)this->backings[this->active].data();
+        }
+
+      protected:
+        T* lock(size_t backing) override
+        {
+            return this->backings[backing].data();
+        }
+
+        void unlock(size_t, size_t, size_t) override
+        {}
+
+        size_t createBacking() override
+        {
+            try
+            {
+                this->backings.emplace_back(this->bufferSize);
+            }
+            catch (std::bad_alloc&)
+            {
+                throw love::Exception("Failed to create DataBuffer");
+            }
+
+            return this->backings.size() - 1;
+        }
+
+      private:
+        std::vector<std::vector<T>> backings;
+    };
+} // namespace love
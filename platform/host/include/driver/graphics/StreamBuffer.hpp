@@ -0,0 +1,60 @@
+#pragma once
+
+#include "common/Logger.hpp"
+#include "driver/graphics/StreamBuffer.tcc"
+#include "modules/graphics/Volatile.hpp"
+
+#include <vector>
+
+namespace love
+{
+    /*
+    ** CPU-only stream buffer. Mirrors the GX2R buffer's layout and mapping
+    ** rules so the batching code sees the same offsets as on hardware.
+    */
+    template<typename T>
+    class StreamBuffer final : public StreamBufferBase<T>
+    {
+      public:
+        StreamBuffer(BufferUsage mode, size_t size) : StreamBufferBase<T>(mode, size), data {}
+        {
+            LOVE_LOG_DEBUG(GRAPHICS, "Creating StreamBuffer: %zu x %zu bytes", size, sizeof(T));
+
+            try
+            {
+                this->data.resize(size);
+            }
+            catch (std::bad_alloc&)
+            {
+                throw love::Exception("Failed to create StreamBuffer");
+            }
+        }
+
+        StreamBuffer(StreamBuffer&&) = delete;
+
+        StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+        MapInfo<T> map(size_t)
+        {
+            MapInfo<T> info {};
+
+            info.data = &this->data[this->index];
+            info.size = this->bufferSize - this->frameGPUReadOffset;
+
+            return info;
+        }
+
+        size_t unmap(size_t)
+        {
+            return this->index;
+        }
+
+        ptrdiff_t getHandle() const override
+        {
+            return (ptrdiff_t)this->data.data();
+        }
+
+      private:
+        std::vector<T> data;
+    };
+} // namespace love
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "modules/graphics/Graphics.tcc"
+
+namespace love
+{
+    /*
+    ** Headless renderer. Every state change and draw goes through the same
+    ** GraphicsBase paths as on hardware, but draws are only recorded
+    ** (counted) instead of being submitted to a GPU.
+    */
+    class Graphics : public GraphicsBase
+    {
+      public:
+        struct Totals
+        {
+            int64_t frames;
+            int64_t draws;
+            int64_t indexedDraws;
+            int64_t vertices;
+            int64_t indices;
+        };
+
+        Graphics();
+
+        virtual ~Graphics();
+
+        void initCapabilities() override;
+
+        void clear(OptionalColor color, OptionalInt stencil, OptionalDouble depth) override;
+
+        void clear(const std::vector<OptionalColor>& colors, OptionalInt stencil,
+                   OptionalDouble depth) override;
+
+        void present(void* screenshotCallbackData) override;
+
+        void setScissor(const Rect& scissor) override;
+
+        void setScissor() override;
+
+        void setFrontFaceWinding(Winding winding) override;
+
+        void setColorMask(ColorChannelMask mask) override;
+
+        void setBlendState(const BlendState& state) override;
+
+        void setPointSize(float size) override;
+
+        FontBase* newFont(Rasterizer* data) override;
+
+        FontBase* newDefaultFont(int size, const Rasterizer::Settings& settings) override;
+
+        bool setMode(int width, int height, int pixelWidth, int pixelHeight, bool backBufferStencil,
+                     bool backBufferDepth, int msaa) override;
+
+        void setRenderTargetsInternal(const RenderTargets& targets, int pixelWidth, int pixelHeight,
+                                      bool hasSRGBTexture) override;
+
+        bool isPixelFormatSupported(PixelFormat format, uint32_t usage) override;
+
+        ShaderStageBase* newShaderStageInternal(ShaderStageType stage, const std::string& filepath) override;
+
+        ShaderBase* newShaderInternal(StrongRef<ShaderStageBase> stages[SHADERSTAGE_MAX_ENUM],
+                                      const ShaderBase::CompileOptions& options) override;
+
+        void draw(const DrawIndexedCommand& command) override;
+
+        void draw(const DrawCommand& command) override;
+
+        using GraphicsBase::draw;
+
+        void unsetMode() override;
+
+        void setViewport(int x, int y, int width, int height);
+
+        void copyCurrentScanBuffer()
+        {}
+
+        const Totals& getTotals() const
+        {
+            return this->totals;
+        }
+
+        TextureBase* newTexture(const TextureBase::Settings& settings,
+                                const TextureBase::Slices* data = nullptr) override;
+
+      private:
+        Totals totals;
+        Rect viewport;
+    };
+} // namespace love
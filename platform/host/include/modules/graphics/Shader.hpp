@@ -0,0 +1,28 @@
+#pragma once
+
+#include "modules/graphics/Graphics.hpp"
+#include "modules/graphics/Shader.tcc"
+#include "modules/graphics/Volatile.hpp"
+
+namespace love
+{
+    class Shader final : public ShaderBase, public Volatile
+    {
+      public:
+        Shader(StrongRef<ShaderStageBase> stages[SHADERSTAGE_MAX_ENUM], const CompileOptions& options);
+
+        virtual ~Shader();
+
+        static const char* getDefaultStagePath(StandardShader shader, ShaderStageType stage);
+
+        bool loadVolatile() override;
+
+        void unloadVolatile() override;
+
+        void attach() override;
+
+        std::string getWarnings() const;
+
+        ptrdiff_t getHandle() const override;
+    };
+} // namespace love
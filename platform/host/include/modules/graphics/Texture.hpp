@@ -0,0 +1,45 @@
+#pragma once
+
+#include "modules/graphics/Texture.tcc"
+#include "modules/graphics/Volatile.hpp"
+
+#include <vector>
+
+namespace love
+{
+    class Texture final : public TextureBase, public Volatile
+    {
+      public:
+        Texture(GraphicsBase* graphics, const Settings& settings, const Slices* data);
+
+        virtual ~Texture();
+
+        bool loadVolatile() override;
+
+        void unloadVolatile() override;
+
+        ptrdiff_t getHandle() const override;
+
+        ptrdiff_t getRenderTargetHandle() const override;
+
+        ptrdiff_t getSamplerHandle() const override;
+
+        void setSamplerState(const SamplerState& state) override;
+
+        void uploadByteData(const void* data, size_t size, int slice, int mipmap, const Rect& rect) override;
+
+        void generateMipmapsInternal() override;
+
+        void setHandleData(ptrdiff_t) override
+        {}
+
+      private:
+        void createTexture();
+
+        Slices slices;
+
+        /* level 0 of the first slice, tightly packed */
+        std::vector<uint8_t> pixels;
+        bool loaded = false;
+    };
+} // namespace love
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "modules/keyboard/Keyboard.tcc"
+
+namespace love
+{
+    /*
+    ** No software keyboard on the host: text input is accepted immediately
+    ** with the hint text, so scripts that wait for textinput keep running.
+    */
+    class Keyboard : public KeyboardBase
+    {
+      public:
+        Keyboard();
+
+        void hide()
+        {
+            this->showing = false;
+        }
+
+        void setTextInput(const KeyboardOptions& options);
+
+        using KeyboardBase::getConstant;
+    };
+} // namespace love
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "modules/system/System.tcc"
+
+namespace love
+{
+    class System : public SystemBase
+    {
+      public:
+        System();
+
+        virtual ~System();
+
+        int getProcessorCount() const;
+
+        PowerState getPowerInfo(int& seconds, int& percent) const;
+
+        std::vector<std::string> getPreferredLocales() const;
+
+        NetworkState getNetworkInfo(uint8_t& signal) const;
+
+        FriendInfo getFriendInfo() const;
+
+        ProductInfo getProductInfo() const;
+
+        using SystemBase::getConstant;
+    };
+} // namespace love
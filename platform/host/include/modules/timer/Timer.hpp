@@ -0,0 +1,35 @@
+#pragma once
+
+#include "modules/timer/Timer.tcc"
+
+#include <chrono>
+
+namespace love
+{
+    class Timer : public TimerBase
+    {
+      public:
+        Timer();
+
+        double step();
+
+        void sleep(double seconds) const;
+
+        static double getTime();
+
+        /*
+        ** Fixed simulation step in seconds, read from LOVE_HOST_TIMESTEP.
+        ** When non-zero, step() reports this delta regardless of how long the
+        ** frame took and sleep() returns immediately, so headless runs are
+        ** deterministic and go as fast as the CPU allows.
+        */
+        static double getTimestep()
+        {
+            return Timer::timestep;
+        }
+
+      private:
+        static std::chrono::steady_clock::time_point reference;
+        static double timestep;
+    };
+} // namespace love
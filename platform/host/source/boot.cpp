@@ -0,0 +1,68 @@
+#include "boot.hpp"
+#include "common/Console.hpp"
+#include "common/Logger.hpp"
+
+#include "driver/EventQueue.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+
+namespace love
+{
+    uint32_t Console::mainCoreId = 0;
+    bool Console::mainCoreIdSet  = false;
+
+    /* LOVE_HOST_FRAMES: quit after this many frames, 0 runs until love.event.quit */
+    static long frameLimit = 0;
+    static long frameCount = 0;
+
+    std::string getApplicationPath(const std::string& argv0)
+    {
+        std::error_code error;
+        const auto path = std::filesystem::read_symlink("/proc/self/exe", error);
+
+        if (!error)
+            return path.string();
+
+        if (argv0.empty() || argv0 == "embedded boot.lua")
+            return std::filesystem::current_path().string();
+
+        return std::filesystem::absolute(argv0, error).string();
+    }
+
+    int preInit()
+    {
+        if (const char* frames = std::getenv("LOVE_HOST_FRAMES"))
+            frameLimit = std::strtol(frames, nullptr, 10);
+
+        Console::setMainCoreId(0);
+
+        LOVE_LOG_INFO(CORE, "Host platform initialized (frame limit: %ld)", frameLimit);
+
+        return 0;
+    }
+
+    bool mainLoop(lua_State* L, int argc, int* nres)
+    {
+        if (luax_resume(L, argc, nres) != LUA_YIELD)
+        {
+            if (lua_type(L, -1) == LUA_TSTRING)
+                LOVE_LOG_ERROR(LUA, "%s", lua_tostring(L, -1));
+
+            return false;
+        }
+
+        if (frameLimit > 0 && ++frameCount == frameLimit)
+        {
+            LOVE_LOG_INFO(CORE, "Frame limit of %ld reached, quitting", frameLimit);
+            EventQueue::getInstance().sendQuit();
+        }
+
+        return true;
+    }
+
+    void onExit()
+    {
+        LOVE_LOG_INFO(CORE, "Host platform shutting down after %ld frames", frameCount);
+    }
+} // namespace love
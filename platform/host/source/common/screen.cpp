@@ -0,0 +1,16 @@
+#include "common/screen.hpp"
+
+namespace love
+{
+    // clang-format off
+    inline constinit ScreenInfo HOST_SCREENS[0x01] =
+    {
+        { 0, 0, "tv", 1280, 720 }
+    };
+    // clang-format on
+
+    std::span<ScreenInfo> getScreenInfo()
+    {
+        return HOST_SCREENS;
+    }
+} // namespace love
@@ -0,0 +1,13 @@
+#include "driver/EventQueue.hpp"
+
+namespace love
+{
+    EventQueue::EventQueue()
+    {}
+
+    EventQueue::~EventQueue()
+    {}
+
+    void EventQueue::pollInternal()
+    {}
+} // namespace love
@@ -0,0 +1,106 @@
+#include "driver/audio/AudioBuffer.hpp"
+
+namespace love
+{
+    AudioBuffer::AudioBuffer() :
+        data_pcm16 { nullptr, nullptr },
+        nsamples(0),
+        offset(0),
+        channels(0),
+        volume(1.0f),
+        ready(false),
+        looping(false),
+        playing(false),
+        queued(false),
+        position(0)
+    {}
+
+    AudioBuffer::AudioBuffer(AudioBuffer&& other) :
+        data_pcm16(other.data_pcm16),
+        nsamples(other.nsamples),
+        offset(other.offset),
+        channels(other.channels),
+        volume(other.volume),
+        ready(other.ready),
+        looping(other.looping),
+        playing(other.playing.load()),
+        queued(other.queued.load()),
+        position(other.position.load())
+    {
+        other.ready   = false;
+        other.playing = false;
+        other.queued  = false;
+    }
+
+    void AudioBuffer::initialize(int channels)
+    {
+        this->channels = channels;
+        this->ready    = true;
+    }
+
+    bool AudioBuffer::prepare()
+    {
+        if (!this->ready)
+            return false;
+
+        this->position = 0;
+        this->offset   = 0;
+        this->queued   = true;
+        this->playing  = false;
+
+        return true;
+    }
+
+    bool AudioBuffer::isPlaying() const
+    {
+        return this->ready && this->playing;
+    }
+
+    bool AudioBuffer::isFinished() const
+    {
+        return !this->queued;
+    }
+
+    void AudioBuffer::setVolume(float volume)
+    {
+        this->volume = std::clamp(volume, 0.0f, 1.0f);
+    }
+
+    size_t AudioBuffer::getSampleOffset() const
+    {
+        return this->position;
+    }
+
+    size_t AudioBuffer::advance(size_t samples)
+    {
+        const size_t target = this->position + samples;
+
+        if (target < this->nsamples)
+        {
+            this->position = target;
+            return 0;
+        }
+
+        if (this->looping && this->nsamples > 0)
+        {
+            this->position = target % this->nsamples;
+            return 0;
+        }
+
+        this->position = this->nsamples;
+        this->playing  = false;
+        this->queued   = false;
+
+        return target - this->nsamples;
+    }
+
+    void AudioBuffer::setLooping(bool looping)
+    {
+        this->looping = looping;
+    }
+
+    bool AudioBuffer::isLooping() const
+    {
+        return this->looping;
+    }
+} // namespace love
@@ -0,0 +1,259 @@
+#include "common/Exception.hpp"
+#include "common/Logger.hpp"
+#include "common/config.hpp"
+#include "common/int.hpp"
+
+#include "driver/audio/DigitalSound.hpp"
+
+#include <cstring>
+#include <thread>
+
+namespace love
+{
+    void DigitalSound::initialize()
+    {
+        std::unique_lock lock(this->mutex);
+
+        this->last        = std::chrono::steady_clock::now();
+        this->initialized = true;
+
+        LOVE_LOG_INFO(AUDIO, "Null audio output initialized (%zu channels)", this->channels.size());
+    }
+
+    void DigitalSound::deInitialize()
+    {
+        std::unique_lock lock(this->mutex);
+
+        for (auto& channel : this->channels)
+            this->stopChannel(channel);
+
+        this->initialized = false;
+    }
+
+    void DigitalSound::updateImpl()
+    {
+        {
+            std::unique_lock lock(this->mutex);
+
+            const auto now     = std::chrono::steady_clock::now();
+            const auto elapsed = std::chrono::duration<double>(now - this->last).count();
+            this->last         = now;
+
+            for (auto& channel : this->channels)
+            {
+                if (channel.paused || channel.buffers.empty())
+                    continue;
+
+                channel.pending += elapsed * channel.sampleRate;
+
+                size_t samples = (size_t)channel.pending;
+                channel.pending -= samples;
+
+                while (samples > 0 && !channel.buffers.empty())
+                {
+                    auto* buffer = channel.buffers.front();
+                    buffer->setPlaying(true);
+
+                    samples = buffer->advance(samples);
+
+                    if (buffer->isFinished())
+                        channel.buffers.pop();
+                }
+            }
+        }
+
+        /* same cadence as the AX pool thread on hardware */
+        std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    }
+
+    void DigitalSound::setMasterVolume(float volume)
+    {
+        this->masterVolume = volume;
+    }
+
+    float DigitalSound::getMasterVolume() const
+    {
+        return this->masterVolume;
+    }
+
+    AudioBuffer DigitalSound::createBuffer(int size, int channels)
+    {
+        AudioBuffer buffer {};
+
+        for (int channel = 0; channel < channels; channel++)
+        {
+            buffer.data_pcm16[channel] = (int16_t*)malloc(size);
+
+            if (buffer.data_pcm16[channel] == nullptr)
+                throw love::Exception(E_OUT_OF_MEMORY);
+        }
+
+        buffer.setChannelCount(channels);
+
+        return buffer;
+    }
+
+    void DigitalSound::freeBuffer(const AudioBuffer& buffer)
+    {
+        if (buffer.data_pcm16[0])
+            free(buffer.data_pcm16[0]);
+
+        if (buffer.data_pcm16[1])
+            free(buffer.data_pcm16[1]);
+    }
+
+    bool DigitalSound::isBufferDone(const AudioBuffer& buffer) const
+    {
+        return buffer.isFinished();
+    }
+
+    void DigitalSound::prepare(AudioBuffer& buffer, void* data, size_t size, int samples)
+    {
+        if (data == nullptr)
+            return;
+
+        buffer.nsamples = samples;
+
+        switch (buffer.getChannelCount())
+        {
+            case 1:
+                std::memcpy(buffer.data_pcm16[0], data, size);
+                break;
+            case 2:
+            {
+                for (size_t index = 0; index < size / sizeof(int16_t); index += 2)
+                {
+                    buffer.data_pcm16[0][index / 2] = ((int16_t*)data)[index];
+                    buffer.data_pcm16[1][index / 2] = ((int16_t*)data)[index + 1];
+                }
+
+                break;
+            }
+            default:
+                throw love::Exception("Unsupported channel count");
+        }
+    }
+
+    size_t DigitalSound::getSampleCount(const AudioBuffer& buffer) const
+    {
+        return buffer.getSampleCount();
+    }
+
+    void DigitalSound::setLooping(AudioBuffer& buffer, bool looping)
+    {
+        buffer.setLooping(looping);
+    }
+
+    void DigitalSound::stopChannel(Channel& channel)
+    {
+        while (!channel.buffers.empty())
+        {
+            auto* buffer = channel.buffers.front();
+            buffer->advance(buffer->getSampleCount());
+            buffer->setPlaying(false);
+
+            channel.buffers.pop();
+        }
+
+        channel.pending = 0.0;
+        channel.paused  = false;
+    }
+
+    bool DigitalSound::channelReset(size_t id, int channels, int bitDepth, int sampleRate)
+    {
+        if (id >= this->channels.size())
+            return false;
+
+        if (DigitalSound::getFormat(channels, bitDepth) < 0)
+            return false;
+
+        std::unique_lock lock(this->mutex);
+
+        this->stopChannel(this->channels[id]);
+        this->channels[id].sampleRate = (float)sampleRate;
+
+        return true;
+    }
+
+    void DigitalSound::channelSetVolume(size_t id, float volume)
+    {
+        std::unique_lock lock(this->mutex);
+        this->channels[id].volume = volume;
+    }
+
+    float DigitalSound::channelGetVolume(size_t id) const
+    {
+        std::unique_lock lock(this->mutex);
+        return this->channels[id].volume;
+    }
+
+    size_t DigitalSound::channelGetSampleOffset(size_t id)
+    {
+        std::unique_lock lock(this->mutex);
+
+        if (this->channels[id].buffers.empty())
+            return 0;
+
+        return this->channels[id].buffers.front()->getSampleOffset();
+    }
+
+    bool DigitalSound::channelAddBuffer(size_t id, AudioBuffer* buffer)
+    {
+        if (!buffer)
+            return false;
+
+        std::unique_lock lock(this->mutex);
+
+        if (!buffer->isInitialized())
+            buffer->initialize(buffer->getChannelCount());
+
+        if (!buffer->prepare())
+            return false;
+
+        buffer->setVolume(this->channels[id].volume);
+        this->channels[id].buffers.push(buffer);
+
+        return true;
+    }
+
+    void DigitalSound::channelStop(size_t id)
+    {
+        std::unique_lock lock(this->mutex);
+        this->stopChannel(this->channels[id]);
+    }
+
+    void DigitalSound::channelPause(size_t id, bool paused)
+    {
+        std::unique_lock lock(this->mutex);
+
+        if (this->channels[id].buffers.empty())
+            return;
+
+        this->channels[id].paused = paused;
+    }
+
+    bool DigitalSound::isChannelPaused(size_t id) const
+    {
+        std::unique_lock lock(this->mutex);
+        return this->channels[id].paused;
+    }
+
+    bool DigitalSound::isChannelPlaying(size_t id) const
+    {
+        std::unique_lock lock(this->mutex);
+
+        const auto& channel = this->channels[id];
+        return !channel.paused && !channel.buffers.empty();
+    }
+
+    int32_t DigitalSound::getFormat(int channels, int bitDepth)
+    {
+        if (bitDepth != 8 && bitDepth != 16)
+            return -1;
+
+        if (channels < 1 || channels > 2)
+            return -2;
+
+        return bitDepth;
+    }
+} // namespace love
@@ -0,0 +1,299 @@
+#include "common/Logger.hpp"
+
+#include "modules/graphics/Graphics.hpp"
+#include "modules/window/Window.hpp"
+
+#include "modules/graphics/Shader.hpp"
+#include "modules/graphics/ShaderStage.hpp"
+#include "modules/graphics/Texture.hpp"
+#include "modules/graphics/freetype/Font.hpp"
+
+namespace love
+{
+    Graphics::Graphics() : GraphicsBase("love.graphics.null"), totals {}, viewport {}
+    {
+        auto* window = Module::getInstance<Window>(M_WINDOW);
+
+        if (window != nullptr)
+        {
+            window->setGraphics(this);
+
+            if (window->isOpen())
+            {
+                int width, height;
+                Window::WindowSettings settings {};
+
+                window->getWindow(width, height, settings);
+                window->setWindow(width, height, &settings);
+            }
+        }
+    }
+
+    Graphics::~Graphics()
+    {
+        LOVE_LOG_INFO(GRAPHICS, "%lld frame(s): %lld draw(s), %lld indexed, %lld vertices, %lld indices",
+                      (long long)this->totals.frames, (long long)this->totals.draws,
+                      (long long)this->totals.indexedDraws, (long long)this->totals.vertices,
+                      (long long)this->totals.indices);
+    }
+
+    void Graphics::initCapabilities()
+    {
+        // clang-format off
+        this->capabilities.features[FEATURE_MULTI_RENDER_TARGET_FORMATS]  = false;
+        this->capabilities.features[FEATURE_CLAMP_ZERO]                   = true;
+        this->capabilities.features[FEATURE_CLAMP_ONE]                    = true;
+        this->capabilities.features[FEATURE_BLEND_MINMAX]                 = true;
+        this->capabilities.features[FEATURE_LIGHTEN]                      = true;
+        this->capabilities.features[FEATURE_FULL_NPOT]                    = true;
+        this->capabilities.features[FEATURE_PIXEL_SHADER_HIGHP]           = false;
+        this->capabilities.features[FEATURE_SHADER_DERIVATIVES]           = false;
+        this->capabilities.features[FEATURE_GLSL3]                        = false;
+        this->capabilities.features[FEATURE_GLSL4]                        = false;
+        this->capabilities.features[FEATURE_INSTANCING]                   = true;
+        this->capabilities.features[FEATURE_TEXEL_BUFFER]                 = false;
+        this->capabilities.features[FEATURE_INDEX_BUFFER_32BIT]           = false;
+        this->capabilities.features[FEATURE_COPY_BUFFER_TO_TEXTURE]       = false;
+        this->capabilities.features[FEATURE_COPY_TEXTURE_TO_BUFFER]       = false;
+        this->capabilities.features[FEATURE_COPY_RENDER_TARGET_TO_BUFFER] = false;
+        this->capabilities.features[FEATURE_MIPMAP_RANGE]                 = false;
+        this->capabilities.features[FEATURE_INDIRECT_DRAW]                = false;
+        static_assert(FEATURE_MAX_ENUM == 19,  "Graphics::initCapabilities must be updated when adding a new graphics feature!");
+
+        this->capabilities.limits[LIMIT_POINT_SIZE]                 = 8.0f;
+        this->capabilities.limits[LIMIT_TEXTURE_SIZE]               = 4096;
+        this->capabilities.limits[LIMIT_TEXTURE_LAYERS]             = 1;
+        this->capabilities.limits[LIMIT_VOLUME_TEXTURE_SIZE]        = 4096;
+        this->capabilities.limits[LIMIT_CUBE_TEXTURE_SIZE]          = 4096;
+        this->capabilities.limits[LIMIT_TEXEL_BUFFER_SIZE]          = 0;
+        this->capabilities.limits[LIMIT_SHADER_STORAGE_BUFFER_SIZE] = 0;
+        this->capabilities.limits[LIMIT_THREADGROUPS_X]             = 0;
+        this->capabilities.limits[LIMIT_THREADGROUPS_Y]             = 0;
+        this->capabilities.limits[LIMIT_THREADGROUPS_Z]             = 0;
+        this->capabilities.limits[LIMIT_RENDER_TARGETS]             = 1;
+        this->capabilities.limits[LIMIT_TEXTURE_MSAA]               = 0;
+        this->capabilities.limits[LIMIT_ANISOTROPY]                 = 0;
+        static_assert(LIMIT_MAX_ENUM == 13, "Graphics::initCapabilities must be updated when adding a new system limit!");
+        // clang-format on
+
+        this->capabilities.textureTypes[TEXTURE_2D]       = true;
+        this->capabilities.textureTypes[TEXTURE_VOLUME]   = false;
+        this->capabilities.textureTypes[TEXTURE_CUBE]     = true;
+        this->capabilities.textureTypes[TEXTURE_2D_ARRAY] = false;
+    }
+
+    void Graphics::clear(OptionalColor color, OptionalInt stencil, OptionalDouble depth)
+    {
+        if (color.hasValue || stencil.hasValue || depth.hasValue)
+            this->flushBatchedDraws();
+    }
+
+    void Graphics::clear(const std::vector<OptionalColor>& colors, OptionalInt stencil, OptionalDouble depth)
+    {
+        if (colors.size() == 0 && !stencil.hasValue && !depth.hasValue)
+            return;
+
+        this->flushBatchedDraws();
+    }
+
+    void Graphics::present(void*)
+    {
+        if (!this->isActive())
+            return;
+
+        if (this->isRenderTargetActive())
+            throw love::Exception("present cannot be called while a render target is active.");
+
+        this->flushBatchedDraws();
+
+        LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 10, 60, "present() %d draw call(s), %d batched", this->drawCalls,
+                         this->drawCallsBatched);
+
+        this->advanceStreamBuffers();
+        this->totals.frames++;
+
+        this->drawCalls        = 0;
+        this->drawCallsBatched = 0;
+        this->drawCallsMerged  = 0;
+        this->drawCallsIndex32 = 0;
+
+        this->drawCallsReordered        = 0;
+        this->batchesMergedByReordering = 0;
+        this->drawCallsCulled           = 0;
+        Shader::shaderSwitches = 0;
+    }
+
+    void Graphics::setScissor(const Rect& scissor)
+    {
+        this->flushBatchedDraws();
+
+        auto& state = this->states.back();
+
+        state.scissor     = true;
+        state.scissorRect = scissor;
+    }
+
+    void Graphics::setPointSize(float size)
+    {
+        if (size != this->states.back().pointSize)
+            this->flushBatchedDraws();
+
+        this->states.back().pointSize = size;
+    }
+
+    void Graphics::setScissor()
+    {
+        if (this->states.back().scissor)
+            this->flushBatchedDraws();
+
+        this->states.back().scissor = false;
+    }
+
+    void Graphics::setFrontFaceWinding(Winding winding)
+    {
+        auto& state = this->states.back();
+
+        if (state.winding != winding)
+            this->flushBatchedDraws();
+
+        state.winding = winding;
+    }
+
+    void Graphics::setColorMask(ColorChannelMask mask)
+    {
+        this->flushBatchedDraws();
+        this->states.back().colorMask = mask;
+    }
+
+    void Graphics::setBlendState(const BlendState& state)
+    {
+        if (!(state == this->states.back().blend))
+            this->flushBatchedDraws();
+
+        if (state.operationRGB == BLENDOP_MAX || state.operationA == BLENDOP_MAX ||
+            state.operationRGB == BLENDOP_MIN || state.operationA == BLENDOP_MIN)
+        {
+            if (!capabilities.features[FEATURE_BLEND_MINMAX])
+                throw love::Exception(E_BLEND_MIN_MAX_NOT_SUPPORTED);
+        }
+
+        this->states.back().blend = state;
+    }
+
+    bool Graphics::isPixelFormatSupported(PixelFormat format, uint32_t usage)
+    {
+        format = this->getSizedFormat(format);
+        return (usage & PIXELFORMATUSAGEFLAGS_SAMPLE) != 0 && !isPixelFormatCompressed(format);
+    }
+
+    void Graphics::setRenderTargetsInternal(const RenderTargets&, int pixelWidth, int pixelHeight, bool)
+    {
+        this->setViewport(0, 0, pixelWidth, pixelHeight);
+    }
+
+    TextureBase* Graphics::newTexture(const TextureBase::Settings& settings, const TextureBase::Slices* data)
+    {
+        return new Texture(this, settings, data);
+    }
+
+    FontBase* Graphics::newFont(Rasterizer* data)
+    {
+        return new Font(data, this->states.back().defaultSamplerState);
+    }
+
+    FontBase* Graphics::newDefaultFont(int size, const Rasterizer::Settings& settings)
+    {
+        auto* module = Module::getInstance<FontModuleBase>(Module::M_FONT);
+
+        if (module == nullptr)
+            throw love::Exception("Font module has not been loaded.");
+
+        StrongRef<Rasterizer> r(module->newTrueTypeRasterizer(size, settings), Acquire::NO_RETAIN);
+        return this->newFont(r.get());
+    }
+
+    ShaderStageBase* Graphics::newShaderStageInternal(ShaderStageType stage, const std::string& filepath)
+    {
+        return new ShaderStage(stage, filepath);
+    }
+
+    ShaderBase* Graphics::newShaderInternal(StrongRef<ShaderStageBase> stages[SHADERSTAGE_MAX_ENUM],
+                                            const ShaderBase::CompileOptions& options)
+    {
+        return new Shader(stages, options);
+    }
+
+    bool Graphics::setMode(int, int, int pixelWidth, int pixelHeight, bool, bool, int)
+    {
+        this->created = true;
+        this->initCapabilities();
+
+        if (this->batchedDrawState.vertexBuffer == nullptr)
+        {
+            this->batchedDrawState.indexBuffer  = newIndexBuffer(INIT_INDEX_BUFFER_SIZE);
+            this->batchedDrawState.vertexBuffer = newVertexBuffer(INIT_VERTEX_BUFFER_SIZE);
+        }
+
+        if (this->batchedDrawState.quadIndexBuffer == nullptr)
+            this->batchedDrawState.quadIndexBuffer = newQuadIndexBuffer();
+
+        if (!Volatile::loadAll())
+            LOVE_LOG_WARN(GRAPHICS, "Failed to load all volatile objects.");
+
+        this->restoreState(this->states.back());
+        this->setViewport(0, 0, pixelWidth, pixelHeight);
+
+        for (int index = 0; index < ShaderBase::STANDARD_MAX_ENUM; index++)
+        {
+            auto type = (Shader::StandardShader)index;
+
+            if (!Shader::standardShaders[index])
+            {
+                std::vector<std::string> stages {};
+                Shader::CompileOptions options {};
+
+                stages.push_back(Shader::getDefaultStagePath(type, SHADERSTAGE_VERTEX));
+                stages.push_back(Shader::getDefaultStagePath(type, SHADERSTAGE_PIXEL));
+
+                Shader::standardShaders[type] = this->newShader(stages, options);
+            }
+        }
+
+        if (!Shader::current)
+            Shader::standardShaders[Shader::STANDARD_DEFAULT]->attach();
+
+        LOVE_LOG_INFO(GRAPHICS, "setMode() %dx%d on the null renderer", pixelWidth, pixelHeight);
+
+        return true;
+    }
+
+    void Graphics::unsetMode()
+    {
+        if (!this->isCreated())
+            return;
+
+        this->flushBatchedDraws();
+    }
+
+    void Graphics::setViewport(int x, int y, int width, int height)
+    {
+        this->viewport = { x, y, width, height };
+    }
+
+    void Graphics::draw(const DrawIndexedCommand& command)
+    {
+        this->totals.draws++;
+        this->totals.indexedDraws++;
+        this->totals.indices += command.indexCount * std::max(command.instanceCount, 1);
+
+        ++this->drawCalls;
+    }
+
+    void Graphics::draw(const DrawCommand& command)
+    {
+        this->totals.draws++;
+        this->totals.vertices += command.vertexCount * std::max(command.instanceCount, 1);
+
+        ++this->drawCalls;
+    }
+} // namespace love
@@ -0,0 +1,94 @@
+#include "common/Exception.hpp"
+#include "common/Logger.hpp"
+#include "common/config.hpp"
+
+#include "modules/graphics/Shader.hpp"
+#include "modules/graphics/ShaderStage.hpp"
+
+#include <format>
+
+namespace love
+{
+    Shader::Shader(StrongRef<ShaderStageBase> _stages[SHADERSTAGE_MAX_ENUM], const CompileOptions& options) :
+        ShaderBase(_stages, options)
+    {
+        this->loadVolatile();
+    }
+
+    Shader::~Shader()
+    {
+        this->unloadVolatile();
+    }
+
+    const char* Shader::getDefaultStagePath(StandardShader shader, ShaderStageType stage)
+    {
+        LOVE_UNUSED(stage);
+
+        switch (shader)
+        {
+            case STANDARD_DEFAULT:
+            default:
+                return "color";
+            case STANDARD_TEXTURE:
+                return "texture";
+            case STANDARD_VIDEO:
+                return "video";
+        }
+    }
+
+    bool Shader::loadVolatile()
+    {
+        for (const auto& stage : this->stages)
+        {
+            if (stage.get() != nullptr && !((ShaderStage*)stage.get())->loadVolatile())
+                return false;
+        }
+
+        this->mapBuiltinUniforms();
+
+        return true;
+    }
+
+    void Shader::unloadVolatile()
+    {
+        for (auto& it : this->reflection.uniforms)
+            delete it.second;
+
+        this->reflection.uniforms.clear();
+        this->mapBuiltinUniforms();
+    }
+
+    std::string Shader::getWarnings() const
+    {
+        std::string warnings {};
+        std::string_view stageString;
+
+        for (const auto& stage : this->stages)
+        {
+            if (stage.get() == nullptr)
+                continue;
+
+            const std::string& _warnings = stage->getWarnings();
+            if (!_warnings.empty() && ShaderStage::getConstant(stage->getStageType(), stageString))
+                warnings += std::format("{} shader:\n{}", stageString, _warnings);
+        }
+
+        return warnings;
+    }
+
+    ptrdiff_t Shader::getHandle() const
+    {
+        return 0;
+    }
+
+    void Shader::attach()
+    {
+        if (current != this)
+        {
+            Graphics::flushBatchedDrawsGlobal();
+
+            current = this;
+            shaderSwitches++;
+        }
+    }
+} // namespace love
@@ -0,0 +1,34 @@
+#include "common/Logger.hpp"
+
+#include "modules/graphics/ShaderStage.hpp"
+
+namespace love
+{
+    ShaderStage::ShaderStage(ShaderStageType stage, const std::string& filepath) :
+        ShaderStageBase(stage, filepath)
+    {
+        this->loadVolatile();
+    }
+
+    ShaderStage::~ShaderStage()
+    {
+        this->unloadVolatile();
+    }
+
+    /* there is no shader compiler on the host; stages only keep their name */
+    bool ShaderStage::loadVolatile()
+    {
+        LOVE_LOG_DEBUG(SHADER, "ShaderStage::loadVolatile() - %s", this->filepath.c_str());
+        return true;
+    }
+
+    void ShaderStage::unloadVolatile()
+    {
+        this->code.clear();
+    }
+
+    ptrdiff_t ShaderStage::getHandle() const
+    {
+        return (ptrdiff_t)this;
+    }
+} // namespace love
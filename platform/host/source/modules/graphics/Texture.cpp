@@ -0,0 +1,128 @@
+#include "modules/graphics/Texture.hpp"
+
+#include <cstring>
+
+namespace love
+{
+    Texture::Texture(GraphicsBase* graphics, const Settings& settings, const Slices* data) :
+        TextureBase(graphics, settings, data),
+        slices(settings.type)
+    {
+        if (data != nullptr)
+            slices = *data;
+
+        if (!this->loadVolatile())
+            throw love::Exception("Failed to create texture.");
+
+        slices.clear();
+    }
+
+    Texture::~Texture()
+    {
+        this->unloadVolatile();
+    }
+
+    bool Texture::loadVolatile()
+    {
+        if (this->loaded)
+            return true;
+
+        if (this->parentView.texture != this)
+        {
+            Texture* baseTexture = (Texture*)this->parentView.texture;
+            baseTexture->loadVolatile();
+        }
+
+        if (this->isReadable() || this->isRenderTarget())
+            this->createTexture();
+
+        int64_t memorySize = 0;
+
+        for (int mip = 0; mip < this->getMipmapCount(); mip++)
+        {
+            int width  = this->getPixelWidth(mip);
+            int height = this->getPixelHeight(mip);
+
+            const auto faces = (this->textureType == TEXTURE_CUBE) ? 6 : 1;
+            int slices       = this->getDepth(mip) * this->layers * faces;
+
+            memorySize += getPixelFormatSliceSize(this->format, width, height, false) * slices;
+        }
+
+        this->setGraphicsMemorySize(memorySize);
+        this->loaded = true;
+
+        return true;
+    }
+
+    void Texture::unloadVolatile()
+    {
+        this->pixels.clear();
+        this->pixels.shrink_to_fit();
+
+        this->loaded = false;
+        this->setGraphicsMemorySize(0);
+    }
+
+    void Texture::createTexture()
+    {
+        const size_t size = getPixelFormatSliceSize(this->format, this->pixelWidth, this->pixelHeight, false);
+        this->pixels.assign(size, 0);
+
+        if (!this->isRenderTarget())
+        {
+            auto* data = this->slices.get(0, 0);
+
+            if (data != nullptr)
+                this->uploadImageData(data, 0, 0, 0, 0);
+        }
+
+        this->setSamplerState(this->samplerState);
+
+        if (this->slices.getMipmapCount() <= 1 && this->getMipmapsMode() != MIPMAPS_NONE)
+            this->generateMipmaps();
+    }
+
+    void Texture::setSamplerState(const SamplerState& state)
+    {
+        this->samplerState = this->validateSamplerState(state);
+    }
+
+    void Texture::uploadByteData(const void* data, size_t, int slice, int mipmap, const Rect& rect)
+    {
+        if (slice != 0 || mipmap != 0 || this->pixels.empty())
+            return;
+
+        const size_t pixelSize = getPixelFormatBlockSize(this->format);
+        const size_t pitch     = this->pixelWidth * pixelSize;
+
+        uint8_t* destination  = this->pixels.data();
+        const uint8_t* source = (const uint8_t*)data;
+
+        for (uint32_t y = 0; y < (uint32_t)rect.h; y++)
+        {
+            const auto srcRow  = y * rect.w * pixelSize;
+            const auto destRow = (y + rect.y) * pitch + rect.x * pixelSize;
+
+            std::memcpy(destination + destRow, source + srcRow, rect.w * pixelSize);
+        }
+    }
+
+    void Texture::generateMipmapsInternal()
+    {}
+
+    ptrdiff_t Texture::getHandle() const
+    {
+        return (ptrdiff_t)this->pixels.data();
+    }
+
+    ptrdiff_t Texture::getRenderTargetHandle() const
+    {
+        return this->isRenderTarget() ? (ptrdiff_t)this->pixels.data() : 0;
+    }
+
+    ptrdiff_t Texture::getSamplerHandle() const
+    {
+        return (ptrdiff_t)std::addressof(this->samplerState);
+    }
+} // namespace love
@@ -0,0 +1,15 @@
+#include "modules/joystick/JoystickModule.hpp"
+
+namespace love::joystick
+{
+    /* no controllers are attached on the host */
+    int getJoystickCount()
+    {
+        return 0;
+    }
+
+    JoystickBase* openJoystick(int)
+    {
+        return nullptr;
+    }
+} // namespace love::joystick
@@ -0,0 +1,31 @@
+#include "modules/keyboard/Keyboard.hpp"
+
+#include "driver/EventQueue.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace love
+{
+    Keyboard::Keyboard() : KeyboardBase()
+    {}
+
+    void Keyboard::setTextInput(const KeyboardOptions& options)
+    {
+        const auto length = this->getMaxEncodingLength(options.maxLength);
+
+        try
+        {
+            this->text = std::make_unique<char[]>(length);
+        }
+        catch (std::bad_alloc&)
+        {
+            throw love::Exception(E_OUT_OF_MEMORY);
+        }
+
+        std::strncpy(this->text.get(), options.hint.data(), std::min<size_t>(length - 1, options.hint.size()));
+
+        this->showing = false;
+        EventQueue::getInstance().sendTextInput(this->text);
+    }
+} // namespace love
@@ -0,0 +1,45 @@
+#include "modules/system/System.hpp"
+
+#include <thread>
+
+namespace love
+{
+    System::System() : SystemBase()
+    {}
+
+    System::~System()
+    {}
+
+    int System::getProcessorCount() const
+    {
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    System::PowerState System::getPowerInfo(int& seconds, int& percent) const
+    {
+        seconds = -1;
+        percent = 100;
+        return PowerState::POWER_NO_BATTERY;
+    }
+
+    std::vector<std::string> System::getPreferredLocales() const
+    {
+        return { "en" };
+    }
+
+    System::NetworkState System::getNetworkInfo(uint8_t& signal) const
+    {
+        signal = 0;
+        return NetworkState::NETWORK_UNKNOWN;
+    }
+
+    System::FriendInfo System::getFriendInfo() const
+    {
+        return FriendInfo();
+    }
+
+    System::ProductInfo System::getProductInfo() const
+    {
+        return { "1.0.0", "host", "Unknown" };
+    }
+} // namespace love
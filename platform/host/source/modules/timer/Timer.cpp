@@ -0,0 +1,55 @@
+#include "modules/timer/Timer.hpp"
+
+#include <cstdlib>
+#include <thread>
+
+namespace love
+{
+    std::chrono::steady_clock::time_point Timer::reference = std::chrono::steady_clock::now();
+    double Timer::timestep                                 = 0.0;
+
+    Timer::Timer()
+    {
+        if (const char* step = std::getenv("LOVE_HOST_TIMESTEP"))
+            Timer::timestep = std::strtod(step, nullptr);
+
+        Timer::reference    = std::chrono::steady_clock::now();
+        this->prevFpsUpdate = this->currTime = Timer::getTime();
+    }
+
+    double Timer::getTime()
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - Timer::reference;
+        return std::chrono::duration<double>(elapsed).count();
+    }
+
+    void Timer::sleep(double seconds) const
+    {
+        if (Timer::timestep > 0.0)
+            return;
+
+        std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    }
+
+    double Timer::step()
+    {
+        this->frames++;
+
+        this->prevTime = this->currTime;
+        this->currTime = Timer::getTime();
+
+        this->dt = (Timer::timestep > 0.0) ? Timer::timestep : this->currTime - this->prevTime;
+
+        double timeSinceLast = (this->currTime - this->prevFpsUpdate);
+
+        if (timeSinceLast > this->fpsUpdateFrequency)
+        {
+            this->fps           = int((this->frames / timeSinceLast) + 0.5);
+            this->averageDelta  = timeSinceLast / frames;
+            this->prevFpsUpdate = this->currTime;
+            this->frames        = 0;
+        }
+
+        return this->dt;
+    }
+} // namespace love
@@ -0,0 +1,94 @@
+#include "modules/window/Window.hpp"
+#include "common/Logger.hpp"
+#include "driver/EventQueue.hpp"
+
+namespace love
+{
+    Window::Window() : WindowBase("love.window.host"), displaySleep(true)
+    {
+        this->windowWidth  = 800;
+        this->windowHeight = 600;
+        this->pixelWidth   = 800;
+        this->pixelHeight  = 600;
+        this->open         = true;
+
+        EventQueue::getInstance().sendResize(this->windowWidth, this->windowHeight);
+    }
+
+    Window::~Window()
+    {
+        this->close(false);
+        this->graphics.set(nullptr);
+    }
+
+    void Window::close()
+    {
+        this->close(true);
+    }
+
+    void Window::close(bool allowExceptions)
+    {
+        if (this->graphics.get())
+        {
+            if (allowExceptions && this->graphics->isRenderTargetActive())
+                throw love::Exception(E_WINDOW_CLOSING_RENDERTARGET_ACTIVE);
+
+            this->graphics->unsetMode();
+        }
+
+        this->open = false;
+    }
+
+    bool Window::setWindow(int width, int height, WindowSettings* settings)
+    {
+        LOVE_LOG_DEBUG(WINDOW, "Window::setWindow(%d, %d)", width, height);
+
+        this->windowWidth  = width;
+        this->windowHeight = height;
+        this->pixelWidth   = width;
+        this->pixelHeight  = height;
+        this->open         = true;
+
+        if (settings)
+            this->updateSettings(*settings, false);
+
+        if (!this->graphics.get())
+            this->graphics.set(Module::getInstance<GraphicsBase>(Module::M_GRAPHICS));
+
+        if (this->graphics.get())
+        {
+            this->graphics->setMode(width, height, width, height, false, false, 0);
+            EventQueue::getInstance().sendResize(width, height);
+        }
+
+        return true;
+    }
+
+    void Window::updateSettings(const WindowSettings& settings, bool updateGraphicsViewport)
+    {
+        WindowBase::updateSettings(settings, updateGraphicsViewport);
+
+        if (updateGraphicsViewport && this->graphics.get())
+        {
+            double scaledw, scaledh;
+            this->fromPixels(this->pixelWidth, this->pixelHeight, scaledw, scaledh);
+
+            this->graphics->backbufferChanged(0, 0, scaledw, scaledh);
+        }
+    }
+
+    bool Window::onSizeChanged(int, int)
+    {
+        return false;
+    }
+
+    void Window::setDisplaySleepEnabled(bool enable)
+    {
+        this->displaySleep = enable;
+    }
+
+    bool Window::isDisplaySleepEnabled() const
+    {
+        return this->displaySleep;
+    }
+} // namespace love
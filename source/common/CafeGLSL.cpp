@@ -2,6 +2,9 @@
 
 #ifdef USE_CAFEGLSL
 
+#include <cstdio>
+#include <cstring>
+
 #ifdef __WIIU__
 #include <coreinit/dynload.h>
 #include <coreinit/filesystem.h>
@@ -18,6 +21,7 @@ namespace love
     // Static member definitions
     bool CafeGLSLCompiler::s_initialized = false;
     bool CafeGLSLCompiler::s_available = false;
+    uint64_t CafeGLSLCompiler::s_buildId = 0;
 
 #ifdef __WIIU__
     // Dynamic loading variables
@@ -67,6 +71,7 @@ namespace love
             if (result == OS_DYNLOAD_OK)
             {
                 WHBLogPrintf("CafeGLSL: Successfully loaded compiler module from: %s", path);
+                s_buildId = ComputeBuildId(path);
                 break;
             }
             else
@@ -221,11 +226,63 @@ namespace love
 #endif
     }
 
+    void CafeGLSLCompiler::FreeVertexShader(GX2VertexShader* shader)
+    {
+#ifdef __WIIU__
+        if (shader && s_freeVertexShader)
+            s_freeVertexShader(shader);
+#endif
+    }
+
+    void CafeGLSLCompiler::FreePixelShader(GX2PixelShader* shader)
+    {
+#ifdef __WIIU__
+        if (shader && s_freePixelShader)
+            s_freePixelShader(shader);
+#endif
+    }
+
     bool CafeGLSLCompiler::IsAvailable()
     {
         return s_available;
     }
 
+    uint64_t CafeGLSLCompiler::GetBuildId()
+    {
+        return s_buildId;
+    }
+
+    uint64_t CafeGLSLCompiler::ComputeBuildId(const char* path)
+    {
+        // FNV-1a over the module's size and leading bytes; the RPL carries no version export
+        uint64_t hash = 0xCBF29CE484222325ull;
+        auto mix = [&hash](const uint8_t* bytes, size_t count) {
+            for (size_t i = 0; i < count; i++)
+            {
+                hash ^= bytes[i];
+                hash *= 0x100000001B3ull;
+            }
+        };
+
+        FILE* file = std::fopen(path, "rb");
+        if (!file)
+        {
+            mix((const uint8_t*)path, std::strlen(path));
+            return hash;
+        }
+
+        uint8_t buffer[4096];
+        size_t count = std::fread(buffer, 1, sizeof(buffer), file);
+        mix(buffer, count);
+
+        std::fseek(file, 0, SEEK_END);
+        long size = std::ftell(file);
+        mix((const uint8_t*)&size, sizeof(size));
+
+        std::fclose(file);
+        return hash;
+    }
+
     std::string CafeGLSLCompiler::GetDefaultVertexShaderSource()
     {
         return R"(
@@ -0,0 +1,443 @@
+#include "common/Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace love
+{
+    std::atomic<Logger::Level> Logger::runtimeLevel { (Logger::Level)LOVE_LOG_LEVEL };
+    std::atomic<uint32_t> Logger::categoryMask { 0xFFFFFFFF };
+
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        constexpr const char* LEVEL_NAMES[] = { "TRACE", "DEBUG", "INFO", "WARN", "ERROR" };
+
+        constexpr const char* CATEGORY_NAMES[] = {
+            "core", "lua", "graphics", "shader", "font", "audio", "input", "event", "window", "filesystem",
+        };
+
+        static_assert(sizeof(CATEGORY_NAMES) / sizeof(*CATEGORY_NAMES) == Logger::CATEGORY_MAX_ENUM);
+
+        constexpr const char* DEFAULT_PATHS[] = {
+#if defined(__WIIU__)
+            "fs:/vol/external01/simple_debug.log",
+            "/vol/external01/simple_debug.log",
+            "/vol/storage_mlc01/simple_debug.log",
+#endif
+            "simple_debug.log",
+        };
+
+        struct Slot
+        {
+            std::atomic<size_t> sequence;
+            uint32_t milliseconds;
+            uint8_t level;
+            uint8_t category;
+            bool continuation; //< carries on the text of the previous slot
+            bool continued;    //< the text carries on in the next slot
+            char message[Logger::MESSAGE_SIZE];
+        };
+
+        /*
+        ** Bounded multi-producer, single-consumer ring (Vyukov-style).
+        ** Each slot carries a sequence number that tells producers whether it
+        ** is free and tells the writer whether it has been published.
+        */
+        struct Ring
+        {
+            static constexpr size_t MASK = Logger::RING_CAPACITY - 1;
+            static_assert((Logger::RING_CAPACITY & MASK) == 0, "Ring capacity must be a power of two.");
+            static_assert(Logger::MESSAGE_PARTS <= Logger::RING_CAPACITY, "A message must fit in the ring.");
+
+            Ring()
+            {
+                for (size_t index = 0; index < Logger::RING_CAPACITY; index++)
+                    this->slots[index].sequence.store(index, std::memory_order_relaxed);
+            }
+
+            /*
+            ** Claims `count` consecutive slots starting at `position`.
+            ** The writer frees slots in order, so the last one being free means
+            ** all of them are.
+            */
+            bool acquire(size_t count, size_t& position)
+            {
+                position = this->head.load(std::memory_order_relaxed);
+
+                while (true)
+                {
+                    const size_t last      = position + count - 1;
+                    const size_t sequence  = this->at(last).sequence.load(std::memory_order_acquire);
+                    const intptr_t pending = (intptr_t)sequence - (intptr_t)last;
+
+                    if (pending == 0)
+                    {
+                        if (this->head.compare_exchange_weak(position, position + count,
+                                                             std::memory_order_relaxed))
+                            return true;
+                    }
+                    else if (pending < 0)
+                        return false;
+                    else
+                        position = this->head.load(std::memory_order_relaxed);
+                }
+            }
+
+            Slot& at(size_t position)
+            {
+                return this->slots[position & MASK];
+            }
+
+            void publish(Slot* slot)
+            {
+                const size_t position = slot->sequence.load(std::memory_order_relaxed);
+                slot->sequence.store(position + 1, std::memory_order_release);
+            }
+
+            Slot* peek()
+            {
+                Slot& slot = this->slots[this->tail & MASK];
+
+                if (slot.sequence.load(std::memory_order_acquire) != this->tail + 1)
+                    return nullptr;
+
+                return &slot;
+            }
+
+            void release(Slot* slot)
+            {
+                slot->sequence.store(this->tail + Logger::RING_CAPACITY, std::memory_order_release);
+                this->tail++;
+            }
+
+            Slot slots[Logger::RING_CAPACITY];
+            std::atomic<size_t> head { 0 };
+            size_t tail = 0;
+        };
+
+        struct RateWindow
+        {
+            std::atomic<uint32_t> second { 0 };
+            std::atomic<uint32_t> count { 0 };
+            std::atomic<uint32_t> suppressed { 0 };
+        };
+
+        struct State
+        {
+            Ring ring;
+            RateWindow windows[Logger::CATEGORY_MAX_ENUM];
+
+            const Clock::time_point epoch = Clock::now();
+
+            std::atomic<uint32_t> rateLimit { Logger::DEFAULT_RATE_LIMIT };
+            std::atomic<uint64_t> dropped { 0 };
+            std::atomic<uint64_t> suppressed { 0 };
+            std::atomic<uint64_t> written { 0 };
+            std::atomic<uint64_t> published { 0 };
+
+            std::atomic<bool> running { false };
+            std::thread writer;
+            std::mutex mutex;
+            std::condition_variable wake;
+            std::condition_variable drained;
+
+            FILE* file = nullptr;
+        };
+
+        State& getState()
+        {
+            static State state;
+            return state;
+        }
+
+        uint32_t getMilliseconds(State& state)
+        {
+            const auto elapsed = Clock::now() - state.epoch;
+            return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+        }
+
+        /* returns false if this message exceeds its category's budget for the current second */
+        bool consumeRate(State& state, Logger::Category category, uint32_t milliseconds)
+        {
+            const uint32_t limit = state.rateLimit.load(std::memory_order_relaxed);
+
+            if (limit == 0)
+                return true;
+
+            RateWindow& window = state.windows[category];
+            const uint32_t now = milliseconds / 1000;
+            uint32_t second    = window.second.load(std::memory_order_relaxed);
+
+            if (second != now && window.second.compare_exchange_strong(second, now))
+                window.count.store(0, std::memory_order_relaxed);
+
+            if (window.count.fetch_add(1, std::memory_order_relaxed) < limit)
+                return true;
+
+            window.suppressed.fetch_add(1, std::memory_order_relaxed);
+            state.suppressed.fetch_add(1, std::memory_order_relaxed);
+
+            return false;
+        }
+
+        void writeSlot(State& state, const Slot& slot)
+        {
+            if (state.file == nullptr)
+                return;
+
+            const uint32_t seconds = slot.milliseconds / 1000;
+
+            if (!slot.continuation)
+                std::fprintf(state.file, "[%5u.%03u] %-5s %-8s ", (unsigned)seconds,
+                             (unsigned)(slot.milliseconds % 1000), LEVEL_NAMES[slot.level],
+                             CATEGORY_NAMES[slot.category]);
+
+            std::fputs(slot.message, state.file);
+
+            if (!slot.continued)
+                std::fputc('\n', state.file);
+        }
+
+        void writeSuppressed(State& state)
+        {
+            if (state.file == nullptr)
+                return;
+
+            for (size_t index = 0; index < Logger::CATEGORY_MAX_ENUM; index++)
+            {
+                const uint32_t count = state.windows[index].suppressed.exchange(0, std::memory_order_relaxed);
+
+                if (count > 0)
+                    std::fprintf(state.file, "[logger] %u %s message(s) suppressed by rate limit\n", count,
+                                 CATEGORY_NAMES[index]);
+            }
+        }
+
+        void drain(State& state)
+        {
+            bool wrote = false;
+
+            while (Slot* slot = state.ring.peek())
+            {
+                writeSlot(state, *slot);
+                state.ring.release(slot);
+                state.written.fetch_add(1, std::memory_order_release);
+                wrote = true;
+            }
+
+            writeSuppressed(state);
+
+            if (wrote && state.file != nullptr)
+                std::fflush(state.file);
+        }
+
+        void run(State* state)
+        {
+            std::unique_lock lock(state->mutex);
+
+            while (state->running.load(std::memory_order_acquire))
+            {
+                state->wake.wait_for(lock, std::chrono::milliseconds(100));
+
+                lock.unlock();
+                drain(*state);
+                lock.lock();
+
+                state->drained.notify_all();
+            }
+        }
+    } // namespace
+
+    void Logger::start(const char* filepath)
+    {
+        State& state = getState();
+
+        if (state.running.load())
+            return;
+
+        if (filepath != nullptr)
+            state.file = std::fopen(filepath, "w");
+        else
+        {
+            for (const char* path : DEFAULT_PATHS)
+            {
+                if ((state.file = std::fopen(path, "w")) != nullptr)
+                    break;
+            }
+        }
+
+        if (state.file != nullptr)
+            std::fprintf(state.file, "=== LOVE Potion log ===\n");
+
+        state.running.store(true, std::memory_order_release);
+        state.writer = std::thread(run, &state);
+    }
+
+    void Logger::stop()
+    {
+        State& state = getState();
+
+        if (!state.running.exchange(false))
+            return;
+
+        state.wake.notify_all();
+
+        if (state.writer.joinable())
+            state.writer.join();
+
+        drain(state);
+
+        if (state.file != nullptr)
+        {
+            const auto dropped = state.dropped.load();
+
+            if (dropped > 0)
+                std::fprintf(state.file, "[logger] %llu message(s) dropped (ring full)\n",
+                             (unsigned long long)dropped);
+
+            std::fclose(state.file);
+            state.file = nullptr;
+        }
+    }
+
+    void Logger::flush()
+    {
+        State& state = getState();
+
+        if (!state.running.load(std::memory_order_acquire))
+            return;
+
+        const uint64_t target = state.published.load(std::memory_order_acquire);
+
+        std::unique_lock lock(state.mutex);
+        state.wake.notify_all();
+
+        state.drained.wait_for(lock, std::chrono::seconds(1), [&state, target]() {
+            return state.written.load(std::memory_order_acquire) >= target ||
+                   !state.running.load(std::memory_order_acquire);
+        });
+    }
+
+    void Logger::setLevel(Level level)
+    {
+        runtimeLevel.store(level, std::memory_order_relaxed);
+    }
+
+    Logger::Level Logger::getLevel()
+    {
+        return runtimeLevel.load(std::memory_order_relaxed);
+    }
+
+    void Logger::setCategoryEnabled(Category category, bool enabled)
+    {
+        if (enabled)
+            categoryMask.fetch_or(1u << category, std::memory_order_relaxed);
+        else
+            categoryMask.fetch_and(~(1u << category), std::memory_order_relaxed);
+    }
+
+    bool Logger::isCategoryEnabled(Category category)
+    {
+        return (categoryMask.load(std::memory_order_relaxed) & (1u << category)) != 0;
+    }
+
+    void Logger::setRateLimit(uint32_t messagesPerSecond)
+    {
+        getState().rateLimit.store(messagesPerSecond, std::memory_order_relaxed);
+    }
+
+    uint64_t Logger::getDroppedCount()
+    {
+        return getState().dropped.load(std::memory_order_relaxed);
+    }
+
+    uint64_t Logger::getSuppressedCount()
+    {
+        return getState().suppressed.load(std::memory_order_relaxed);
+    }
+
+    void Logger::write(Level level, Category category, const char* format, ...)
+    {
+        if (level >= LEVEL_OFF || category >= CATEGORY_MAX_ENUM)
+            return;
+
+        State& state                = getState();
+        const uint32_t milliseconds = getMilliseconds(state);
+
+        if (level < LEVEL_ERROR && !consumeRate(state, category, milliseconds))
+            return;
+
+        char buffer[MESSAGE_SIZE];
+        std::string text;
+
+        va_list args;
+        va_start(args, format);
+
+        va_list retry;
+        va_copy(retry, args);
+
+        int length = std::vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+
+        const char* message = buffer;
+
+        /* too long for one slot, format it again in full and split it up */
+        if (length >= (int)MESSAGE_SIZE)
+        {
+            length = std::min<int>(length, MESSAGE_PARTS * (MESSAGE_SIZE - 1));
+            text.resize(length);
+
+            std::vsnprintf(text.data(), length + 1, format, retry);
+            message = text.c_str();
+        }
+
+        va_end(retry);
+
+        if (length < 0)
+            return;
+
+        const size_t partLength = MESSAGE_SIZE - 1;
+        const size_t parts      = std::max<size_t>(1, (length + partLength - 1) / partLength);
+
+        size_t position = 0;
+
+        if (!state.ring.acquire(parts, position))
+        {
+            state.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        for (size_t part = 0; part < parts; part++)
+        {
+            Slot& slot = state.ring.at(position + part);
+
+            slot.milliseconds = milliseconds;
+            slot.level        = (uint8_t)level;
+            slot.category     = (uint8_t)category;
+            slot.continuation = part > 0;
+            slot.continued    = part + 1 < parts;
+
+            const size_t offset = part * partLength;
+            const size_t size   = std::min(partLength, (size_t)length - offset);
+
+            std::memcpy(slot.message, message + offset, size);
+            slot.message[size] = '\0';
+
+            state.ring.publish(&slot);
+        }
+
+        state.published.fetch_add(parts, std::memory_order_release);
+
+        if (level >= LEVEL_ERROR)
+            state.wake.notify_one();
+    }
+} // namespace love
@@ -24,6 +24,7 @@
 // STD
 #include <cmath>
 #include <cstring> // memcpy
+#include <type_traits>
 
 #if defined(LOVE_SIMD_SSE)
     #include <xmmintrin.h>
@@ -319,6 +320,150 @@ namespace love
                fabsf(e[10] + e[15] - 2.0f) < 0.00001f;
     }
 
+    /* advances a float pointer by a stride in bytes */
+    template<typename T>
+    static inline T* advance(T* pointer, size_t stride)
+    {
+        using Byte = std::conditional_t<std::is_const_v<T>, const char, char>;
+        return (T*)((Byte*)pointer + stride);
+    }
+
+    void Matrix4::transformXY(float* dst, size_t dstStride, const float* src, size_t srcStride,
+                              int size) const
+    {
+        int i = 0;
+
+#if defined(LOVE_SIMD_SSE)
+
+        // Two vertices per iteration: [x0 y0 x1 y1] -> [x0 x0 x1 x1] and [y0 y0 y1 y1].
+        const __m128 colx  = _mm_setr_ps(e[0], e[1], e[0], e[1]);
+        const __m128 coly  = _mm_setr_ps(e[4], e[5], e[4], e[5]);
+        const __m128 trans = _mm_setr_ps(e[12], e[13], e[12], e[13]);
+
+        for (; i + 1 < size; i += 2)
+        {
+            const float* src1 = advance(src, srcStride);
+            float* dst1       = advance(dst, dstStride);
+
+            __m128 v = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)src);
+            v        = _mm_loadh_pi(v, (const __m64*)src1);
+
+            __m128 xx = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 0, 0));
+            __m128 yy = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1));
+            __m128 r  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xx, colx), _mm_mul_ps(yy, coly)), trans);
+
+            _mm_storel_pi((__m64*)dst, r);
+            _mm_storeh_pi((__m64*)dst1, r);
+
+            src = advance(src1, srcStride);
+            dst = advance(dst1, dstStride);
+        }
+
+#endif
+
+        const float e0 = e[0], e1 = e[1], e4 = e[4], e5 = e[5], e12 = e[12], e13 = e[13];
+
+        for (; i < size; i++)
+        {
+            const float x = src[0];
+            const float y = src[1];
+
+            dst[0] = (e0 * x) + (e4 * y) + e12;
+            dst[1] = (e1 * x) + (e5 * y) + e13;
+
+            src = advance(src, srcStride);
+            dst = advance(dst, dstStride);
+        }
+    }
+
+    void Matrix4::transformXY0(float* dst, size_t dstStride, const float* src, size_t srcStride,
+                               int size) const
+    {
+        int i = 0;
+
+#if defined(LOVE_SIMD_SSE)
+
+        const __m128 colx  = _mm_loadu_ps(&e[0]);
+        const __m128 coly  = _mm_loadu_ps(&e[4]);
+        const __m128 trans = _mm_loadu_ps(&e[12]);
+
+        for (; i < size; i++)
+        {
+            __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(src[0]), colx),
+                                             _mm_mul_ps(_mm_set1_ps(src[1]), coly)),
+                                  trans);
+
+            _mm_storel_pi((__m64*)dst, r);
+            _mm_store_ss(dst + 2, _mm_movehl_ps(r, r));
+
+            src = advance(src, srcStride);
+            dst = advance(dst, dstStride);
+        }
+
+#endif
+
+        const float e0 = e[0], e1 = e[1], e2 = e[2], e4 = e[4], e5 = e[5], e6 = e[6];
+        const float e12 = e[12], e13 = e[13], e14 = e[14];
+
+        for (; i < size; i++)
+        {
+            const float x = src[0];
+            const float y = src[1];
+
+            dst[0] = (e0 * x) + (e4 * y) + e12;
+            dst[1] = (e1 * x) + (e5 * y) + e13;
+            dst[2] = (e2 * x) + (e6 * y) + e14;
+
+            src = advance(src, srcStride);
+            dst = advance(dst, dstStride);
+        }
+    }
+
+    void Matrix4::transformXYZ(float* dst, size_t dstStride, const float* src, size_t srcStride,
+                               int size) const
+    {
+        int i = 0;
+
+#if defined(LOVE_SIMD_SSE)
+
+        const __m128 colx  = _mm_loadu_ps(&e[0]);
+        const __m128 coly  = _mm_loadu_ps(&e[4]);
+        const __m128 colz  = _mm_loadu_ps(&e[8]);
+        const __m128 trans = _mm_loadu_ps(&e[12]);
+
+        for (; i < size; i++)
+        {
+            __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(src[0]), colx),
+                                             _mm_mul_ps(_mm_set1_ps(src[1]), coly)),
+                                  _mm_add_ps(_mm_mul_ps(_mm_set1_ps(src[2]), colz), trans));
+
+            _mm_storel_pi((__m64*)dst, r);
+            _mm_store_ss(dst + 2, _mm_movehl_ps(r, r));
+
+            src = advance(src, srcStride);
+            dst = advance(dst, dstStride);
+        }
+
+#endif
+
+        const float e0 = e[0], e1 = e[1], e2 = e[2], e4 = e[4], e5 = e[5], e6 = e[6];
+        const float e8 = e[8], e9 = e[9], e10 = e[10], e12 = e[12], e13 = e[13], e14 = e[14];
+
+        for (; i < size; i++)
+        {
+            const float x = src[0];
+            const float y = src[1];
+            const float z = src[2];
+
+            dst[0] = (e0 * x) + (e4 * y) + (e8 * z) + e12;
+            dst[1] = (e1 * x) + (e5 * y) + (e9 * z) + e13;
+            dst[2] = (e2 * x) + (e6 * y) + (e10 * z) + e14;
+
+            src = advance(src, srcStride);
+            dst = advance(dst, dstStride);
+        }
+    }
+
     Matrix4 Matrix4::inverse() const
     {
         Matrix4 inv;
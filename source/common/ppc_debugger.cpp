@@ -1,4 +1,6 @@
 #include "common/ppc_debugger.hpp"
+#include "common/Logger.hpp"
+
 #include <cstdio>
 #include <cstring>
 #include <whb/log.h>
@@ -13,11 +15,8 @@ namespace ppc {
 char PPCDebugger::debug_buffer[4096];
 
 void PPCDebugger::writeToFile(const char* message) {
-    FILE* f = fopen("/vol/external01/simple_debug.log", "a");
-    if (f) {
-        fprintf(f, "[PPC_DEBUG] %s\n", message);
-        fclose(f);
-    }
+    LOVE_LOG_DEBUG(CORE, "[PPC_DEBUG] %s", message);
+
     // Also to WHB console
     WHBLogPrintf("[PPC_DEBUG] %s", message);
 }
@@ -3,6 +3,8 @@
 #include "modules/font/freetype/TrueTypeRasterizer.hpp"
 #include "modules/window/Window.hpp"
 
+#include <cstdio>
+#include <cstdlib>
 #include <memory>
 
 namespace love
@@ -38,7 +40,36 @@ namespace love
         return new ByteData(data, size, false);
     }
 #else
-    #error "Unsupported platform for FreeType"
+    /* LOVE_HOST_FONT overrides the path of the standard font */
+    ByteData* FontModule::loadSystemFontByType(SystemFontType type = HOST_FONT_STANDARD)
+    {
+        const char* path = std::getenv("LOVE_HOST_FONT");
+
+        if (path == nullptr)
+            path = "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf";
+
+        std::FILE* file = std::fopen(path, "rb");
+
+        if (!file)
+            throw love::Exception("Error loading system font '{:s}'", path);
+
+        std::fseek(file, 0, SEEK_END);
+        const long size = std::ftell(file);
+        std::rewind(file);
+
+        auto* data = new ByteData(size > 0 ? size : 0, false);
+
+        if (size <= 0 || std::fread(data->getData(), size, 1, file) != 1)
+        {
+            std::fclose(file);
+            data->release();
+            throw love::Exception("Error reading system font '{:s}'", path);
+        }
+
+        std::fclose(file);
+
+        return data;
+    }
 #endif
 
     FontModule::FontModule() : FontModuleBase("love.font.freetype")
@@ -16,7 +16,9 @@ namespace love
 {
     TrueTypeRasterizer::TrueTypeRasterizer(FT_Library library, Data* data, int size, const Settings& settings,
                                            float defaultDPIScale) :
-        hinting(settings.hinting)
+        hinting(settings.hinting),
+        pointSize(size),
+        ownedLibrary(nullptr)
     {
         this->data.set(data);
         this->dpiScale = settings.dpiScale.get(defaultDPIScale);
@@ -52,6 +54,9 @@ namespace love
     TrueTypeRasterizer::~TrueTypeRasterizer()
     {
         FT_Done_Face(this->face);
+
+        if (this->ownedLibrary != nullptr)
+            FT_Done_FreeType(this->ownedLibrary);
     }
 
     int TrueTypeRasterizer::getLineHeight() const
@@ -223,6 +228,33 @@ namespace love
         return new GenericShaper(this);
     }
 
+    Rasterizer* TrueTypeRasterizer::clone() const
+    {
+        FT_Library library = nullptr;
+
+        if (FT_Init_FreeType(&library) != FT_Err_Ok)
+            return nullptr;
+
+        Settings settings {};
+        settings.hinting = this->hinting;
+        settings.dpiScale.set(this->dpiScale);
+        settings.sdf = this->sdf;
+
+        try
+        {
+            auto* copy = new TrueTypeRasterizer(library, this->data.get(), this->pointSize, settings,
+                                                this->dpiScale);
+            copy->ownedLibrary = library;
+
+            return copy;
+        }
+        catch (love::Exception&)
+        {
+            FT_Done_FreeType(library);
+            return nullptr;
+        }
+    }
+
     bool TrueTypeRasterizer::accepts(FT_Library library, Data* data)
     {
         const FT_Byte* base = (const FT_Byte*)data->getData();
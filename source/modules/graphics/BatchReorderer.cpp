@@ -0,0 +1,162 @@
+#include "modules/graphics/BatchReorderer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace love
+{
+    BatchReorderer::BatchReorderer() :
+        pending {},
+        vertices(nullptr),
+        vertexBytes(0),
+        groups {},
+        groupBounds {},
+        enabled(false)
+    {}
+
+    bool BatchReorderer::canReorder(const BatchedDrawCommand& command)
+    {
+        if (command.vertexCount <= 0)
+            return false;
+
+        switch (command.format)
+        {
+            case CommonFormat::XYf:
+            case CommonFormat::XYf_STf:
+            case CommonFormat::XYf_STPf:
+            case CommonFormat::XYf_STf_RGBAf:
+            case CommonFormat::XYf_STus_RGBAf:
+            case CommonFormat::XYf_STf_RGBAub:
+            case CommonFormat::XYf_RGBAf:
+            case CommonFormat::XYf_STPf_RGBAf:
+                break;
+            default:
+                return false;
+        }
+
+        return getFormatStride(command.format) * command.vertexCount <= MAX_VERTEX_BYTES;
+    }
+
+    bool BatchReorderer::hasRoom(const BatchedDrawCommand& command) const
+    {
+        const size_t size = getFormatStride(command.format) * command.vertexCount;
+        return (int)this->pending.size() < MAX_COMMANDS && this->vertexBytes + size <= MAX_VERTEX_BYTES;
+    }
+
+    void* BatchReorderer::push(const BatchedDrawCommand& command)
+    {
+        if (this->vertices == nullptr)
+            this->vertices = std::make_unique<uint8_t[]>(MAX_VERTEX_BYTES);
+
+        Pending draw {};
+        draw.command = command;
+        draw.offset  = this->vertexBytes;
+        draw.size    = getFormatStride(command.format) * command.vertexCount;
+        draw.texture.set(command.texture);
+
+        this->vertexBytes += draw.size;
+        this->pending.push_back(std::move(draw));
+
+        return this->vertices.get() + draw.offset;
+    }
+
+    bool BatchReorderer::isCompatible(const BatchedDrawCommand& a, const BatchedDrawCommand& b)
+    {
+        // clang-format off
+        return a.primitiveMode == b.primitiveMode
+            && a.format == b.format
+            && (a.indexMode != TRIANGLEINDEX_NONE) == (b.indexMode != TRIANGLEINDEX_NONE)
+            && a.texture == b.texture
+            && a.shaderType == b.shaderType
+            && a.isFont == b.isFont
+            && a.pushTransform == b.pushTransform;
+        // clang-format on
+    }
+
+    BatchReorderer::Bounds BatchReorderer::getBounds(const Pending& draw) const
+    {
+        const size_t stride = getFormatStride(draw.command.format);
+        const uint8_t* data = this->vertices.get() + draw.offset;
+
+        Bounds bounds { 0.0f, 0.0f, 0.0f, 0.0f };
+
+        for (int index = 0; index < draw.command.vertexCount; index++)
+        {
+            float position[2];
+            std::memcpy(position, data + index * stride, sizeof(position));
+
+            if (index == 0)
+                bounds = { position[0], position[1], position[0], position[1] };
+            else
+            {
+                bounds.minX = std::min(bounds.minX, position[0]);
+                bounds.minY = std::min(bounds.minY, position[1]);
+                bounds.maxX = std::max(bounds.maxX, position[0]);
+                bounds.maxY = std::max(bounds.maxY, position[1]);
+            }
+        }
+
+        return bounds;
+    }
+
+    void BatchReorderer::group(int& reordered, int& merged)
+    {
+        this->groups.clear();
+        this->groupBounds.clear();
+
+        /* batches the draws would have needed in submission order */
+        int batches = 0;
+
+        for (int index = 0; index < (int)this->pending.size(); index++)
+        {
+            const auto& command = this->pending[index].command;
+
+            if (index == 0 || !isCompatible(this->pending[index - 1].command, command))
+                batches++;
+
+            const Bounds bounds = this->getBounds(this->pending[index]);
+            int target          = -1;
+
+            /* walk back over later batches, stopping at the first one this draw overlaps */
+            for (int current = (int)this->groups.size() - 1; current >= 0; current--)
+            {
+                if (isCompatible(this->pending[this->groups[current].front()].command, command))
+                {
+                    target = current;
+                    break;
+                }
+
+                const auto& other = this->groupBounds[current];
+
+                // clang-format off
+                const bool overlaps = bounds.minX < other.maxX && other.minX < bounds.maxX
+                                   && bounds.minY < other.maxY && other.minY < bounds.maxY;
+                // clang-format on
+
+                if (overlaps)
+                    break;
+            }
+
+            if (target < 0)
+            {
+                this->groups.push_back({ index });
+                this->groupBounds.push_back(bounds);
+                continue;
+            }
+
+            if (target != (int)this->groups.size() - 1)
+                reordered++;
+
+            auto& other = this->groupBounds[target];
+            other.minX  = std::min(other.minX, bounds.minX);
+            other.minY  = std::min(other.minY, bounds.minY);
+            other.maxX  = std::max(other.maxX, bounds.maxX);
+            other.maxY  = std::max(other.maxY, bounds.maxY);
+
+            this->groups[target].push_back(index);
+        }
+
+        merged += batches - (int)this->groups.size();
+    }
+} // namespace love
@@ -177,6 +177,12 @@ namespace love
                     { getConstant(ATTRIB_TEXCOORD), DATAFORMAT_UNORM16_VEC2 },
                     { getConstant(ATTRIB_COLOR), DATAFORMAT_UNORM8_VEC4 },
                 };
+            case CommonFormat::XYf_STf_RGBAub:
+                return {
+                    { getConstant(ATTRIB_POS), DATAFORMAT_FLOAT_VEC2 },
+                    { getConstant(ATTRIB_TEXCOORD), DATAFORMAT_FLOAT_VEC2 },
+                    { getConstant(ATTRIB_COLOR), DATAFORMAT_UNORM8_VEC4 },
+                };
             case CommonFormat::XYf_STPf_RGBAf:
                 return {
                     { getConstant(ATTRIB_POS), DATAFORMAT_FLOAT_VEC2 },
@@ -2,21 +2,15 @@
     #include "driver/display/deko.hpp"
 #endif
 
+#include "common/Logger.hpp"
 #include "driver/graphics/DrawCommand.hpp"
 
-#ifdef __WIIU__
-#include "debug_log.h"
-#endif
-
 namespace love
 {
     StreamBuffer<Vertex>* newVertexBuffer(size_t size)
     {
-#ifdef __WIIU__
-        char debugMsg[256];
-        sprintf(debugMsg, "Creating new vertex buffer with size %zu (%zu bytes total)", size, size * sizeof(Vertex));
-        wiiu_debug_log_exception(debugMsg);
-#endif
+        LOVE_LOG_DEBUG(GRAPHICS, "Creating vertex buffer: %zu vertices (%zu bytes)", size, size * sizeof(Vertex));
+
         auto* buffer = new StreamBuffer<Vertex>(BUFFERUSAGE_VERTEX, size);
 #if defined(__SWITCH__)
         buffer->allocate(d3d.getMemoryPool(deko3d::MEMORYPOOL_DATA));
@@ -26,15 +20,37 @@ namespace love
 
     StreamBuffer<uint16_t>* newIndexBuffer(size_t size)
     {
-#ifdef __WIIU__
-        char debugMsg[256];
-        sprintf(debugMsg, "Creating new index buffer with size %zu (%zu bytes total)", size, size * sizeof(uint16_t));
-        wiiu_debug_log_exception(debugMsg);
-#endif
+        LOVE_LOG_DEBUG(GRAPHICS, "Creating index buffer: %zu indices (%zu bytes)", size, size * sizeof(uint16_t));
+
         auto* buffer = new StreamBuffer<uint16_t>(BUFFERUSAGE_INDEX, size);
 #if defined(__SWITCH__)
         buffer->allocate(d3d.getMemoryPool(deko3d::MEMORYPOOL_DATA));
 #endif
         return buffer;
     }
+
+    StreamBuffer<uint32_t>* newIndexBuffer32(size_t size)
+    {
+        LOVE_LOG_DEBUG(GRAPHICS, "Creating 32-bit index buffer: %zu indices (%zu bytes)", size,
+                       size * sizeof(uint32_t));
+
+        auto* buffer = new StreamBuffer<uint32_t>(BUFFERUSAGE_INDEX, size);
+#if defined(__SWITCH__)
+        buffer->allocate(d3d.getMemoryPool(deko3d::MEMORYPOOL_DATA));
+#endif
+        return buffer;
+    }
+
+    StreamBuffer<uint16_t>* newQuadIndexBuffer()
+    {
+        const size_t size = (size_t)getIndexCount(TRIANGLEINDEX_QUADS, QUAD_INDEX_BUFFER_VERTICES);
+
+        auto* buffer = newIndexBuffer(size);
+        auto map     = buffer->map(size);
+
+        fillIndices(TRIANGLEINDEX_QUADS, (uint16_t)0, (uint16_t)QUAD_INDEX_BUFFER_VERTICES, map.data);
+        buffer->unmap(size);
+
+        return buffer;
+    }
 } // namespace love
@@ -4,12 +4,14 @@
 #include "modules/font/GlyphData.hpp"
 
 #include "common/Console.hpp"
+#include "common/Logger.hpp"
 #include "common/Matrix.hpp"
 #include "common/math.hpp"
 
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <unordered_set>
 
 namespace love
 {
@@ -59,6 +61,9 @@ namespace love
 
     FontBase::~FontBase()
     {
+        if (this->glyphPreloader.get() != nullptr)
+            this->glyphPreloader->stop();
+
         --fontCount;
     }
 
@@ -92,6 +97,7 @@ namespace love
 
     void FontBase::unloadVolatile()
     {
+        this->clearTextLayouts();
         this->glyphs.clear();
         this->textures.clear();
     }
@@ -117,38 +123,19 @@ namespace love
 
     const FontBase::Glyph& FontBase::addGlyph(TextShaper::GlyphIndex glyphIndex)
     {
-#ifdef __WIIU__
-        static int addGlyphCount = 0;
-        addGlyphCount++;
-        
-        if (addGlyphCount <= 20 || addGlyphCount % 100 == 0) {
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "FontBase::addGlyph() called (#%d)\n", addGlyphCount);
-                fprintf(logFile, "  glyphIndex: rast=%d, idx=%d\n", glyphIndex.rasterizerIndex, glyphIndex.index);
-                fprintf(logFile, "  font=%p, textures.size()=%zu\n", this, textures.size());
-                fflush(logFile);
-                fclose(logFile);
-            }
-        }
-#endif
-
         float dpiScale = this->getDPIScale();
         StrongRef<GlyphData> gd(this->getRasterizerGlyphData(glyphIndex, dpiScale), Acquire::NO_RETAIN);
 
+        return this->addGlyph(glyphIndex, gd);
+    }
+
+    const FontBase::Glyph& FontBase::addGlyph(TextShaper::GlyphIndex glyphIndex, GlyphData* gd)
+    {
         int width  = gd->getWidth();
         int height = gd->getHeight();
 
-#ifdef __WIIU__
-        if (addGlyphCount <= 20) {
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "  glyph size: %dx%d\n", width, height);
-                fflush(logFile);
-                fclose(logFile);
-            }
-        }
-#endif
+        LOVE_LOG_TRACE(FONT, "addGlyph() rasterizer=%d, index=%d, size=%dx%d", glyphIndex.rasterizerIndex,
+                       glyphIndex.index, width, height);
 
         if (width + TEXTURE_PADDING * 2 < textureWidth && height + TEXTURE_PADDING * 2 < textureHeight)
         {
@@ -162,7 +149,7 @@ namespace love
             if (this->textureY + height + TEXTURE_PADDING > textureHeight)
             {
                 this->createTexture();
-                return this->addGlyph(glyphIndex);
+                return this->addGlyph(glyphIndex, gd);
             }
         }
 
@@ -175,20 +162,6 @@ namespace love
             TextureBase* texture = this->textures.back();
             glyph.texture        = texture;
 
-#ifdef __WIIU__
-            if (addGlyphCount <= 20) {
-                FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile) {
-                    fprintf(logFile, "  setting glyph.texture=%p from textures.back()\n", texture);
-                    if (texture) {
-                        fprintf(logFile, "  texture info: %dx%d\n", texture->getWidth(), texture->getHeight());
-                    }
-                    fflush(logFile);
-                    fclose(logFile);
-                }
-            }
-#endif
-
             Rect rect = { this->textureX, this->textureY, gd->getWidth(), gd->getHeight() };
 
             if (this->pixelFormat != gd->getFormat())
@@ -202,8 +175,11 @@ namespace love
 
                 const uint8_t* source = (const uint8_t*)gd->getData();
                 size_t destSize       = getPixelFormatSliceSize(this->pixelFormat, width, height);
-                std::vector<uint8_t> destination(destSize, 0);
-                uint8_t* destData = destination.data();
+
+                if (this->glyphStaging.size() < destSize)
+                    this->glyphStaging.resize(destSize);
+
+                uint8_t* destData = this->glyphStaging.data();
 
                 for (int pixel = 0; pixel < width * height; pixel++)
                 {
@@ -221,16 +197,21 @@ namespace love
             double tX = (double)this->textureX, tY = (double)this->textureY;
             double tW = (double)textureWidth, tH = (double)textureHeight;
 
-            Color color(1.0f, 1.0f, 1.0f, 1.0f);
+            Color32 color(255, 255, 255, 255);
             int offset = 1;
 
+            const float left   = float((tX - offset) / tW);
+            const float right  = float((tX + width + offset) / tW);
+            const float top    = float((tY - offset) / tH);
+            const float bottom = float((tY + height + offset) / tH);
+
             // clang-format off
             const GlyphVertex vertices[4] =
             {
-                { float(-offset), float(-offset),  (tX - offset) / tW,         (tY - offset) / tH,          color },
-                { float(-offset), height + offset, (tX - offset) / tW,         (tY + height + offset) / tH, color },
-                { width + offset, float(-offset),  (tX + width + offset) / tW, (tY - offset) / tH,          color },
-                { width + offset, height + offset, (tX + width + offset) / tW, (tY + height + offset) / tH, color }
+                { float(-offset),         float(-offset),          left,  top,    color },
+                { float(-offset),         float(height + offset),  left,  bottom, color },
+                { float(width + offset),  float(-offset),          right, top,    color },
+                { float(width + offset),  float(height + offset),  right, bottom, color }
             };
             // clang-format on
 
@@ -251,6 +232,60 @@ namespace love
         return this->glyphs[packed];
     }
 
+    void FontBase::preload(const std::string& text, bool background)
+    {
+        std::vector<uint32_t> codepoints {};
+        getCodepointsFromString(text, codepoints);
+
+        std::vector<TextShaper::GlyphIndex> missing {};
+        std::unordered_set<uint64_t> seen {};
+
+        for (const auto codepoint : codepoints)
+        {
+            TextShaper::GlyphIndex glyphIndex {};
+            this->shaper->getGlyphAdvance(codepoint, &glyphIndex);
+
+            const uint64_t packed = packGlyphIndex(glyphIndex);
+
+            /* repeated characters only need to be rasterized once */
+            if (this->glyphs.find(packed) == this->glyphs.end() && seen.insert(packed).second)
+                missing.push_back(glyphIndex);
+        }
+
+        if (background)
+        {
+            if (this->glyphPreloader.get() == nullptr)
+            {
+                auto* preloader = new GlyphPreloader(this->shaper->getRasterizers());
+                this->glyphPreloader.set(preloader, Acquire::NO_RETAIN);
+            }
+
+            this->glyphPreloader->enqueue(missing);
+        }
+
+        /* whatever the worker can't rasterize is done here */
+        for (const auto glyphIndex : missing)
+        {
+            if (!background || !this->glyphPreloader->canPreload(glyphIndex))
+                this->findGlyph(glyphIndex);
+        }
+    }
+
+    void FontBase::uploadPreloadedGlyphs()
+    {
+        if (this->glyphPreloader.get() == nullptr)
+            return;
+
+        std::vector<GlyphPreloader::Result> results {};
+        this->glyphPreloader->takeFinished(results);
+
+        for (const auto& result : results)
+        {
+            if (this->glyphs.find(packGlyphIndex(result.glyphIndex)) == this->glyphs.end())
+                this->addGlyph(result.glyphIndex, result.glyphData);
+        }
+    }
+
     float FontBase::getKerning(uint32_t leftglyph, uint32_t rightglyph)
     {
         return this->shaper->getKerning(leftglyph, rightglyph);
@@ -266,82 +301,123 @@ namespace love
         return this->shaper->getHeight();
     }
 
-    void FontBase::print(GraphicsBase* graphics, const std::vector<ColoredString>& text,
-                         const Matrix4& matrix, const Color& constantcolor)
+    static uint64_t hashBytes(const void* data, size_t size, uint64_t hash)
     {
-#ifdef __WIIU__
-        static int fontPrintCount = 0;
-        fontPrintCount++;
-        
-        if (fontPrintCount <= 15 || fontPrintCount % 30 == 0) {
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "FontBase::print() called (#%d)\n", fontPrintCount);
-                fprintf(logFile, "  graphics=%p, font=%p\n", graphics, this);
-                fprintf(logFile, "  text.size()=%zu\n", text.size());
-                
-                if (!text.empty()) {
-                    fprintf(logFile, "  first_text='%.100s'\n", text[0].string.c_str());
-                }
-                
-                fprintf(logFile, "  color: R=%.2f G=%.2f B=%.2f A=%.2f\n", 
-                       constantcolor.r, constantcolor.g, constantcolor.b, constantcolor.a);
-                       
-                fflush(logFile);
-                fclose(logFile);
+        const auto* bytes = (const uint8_t*)data;
+
+        for (size_t index = 0; index < size; index++)
+            hash = (hash ^ bytes[index]) * 0x100000001B3ull;
+
+        return hash;
+    }
+
+    static bool isSameColor(const Color& a, const Color& b)
+    {
+        return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+    }
+
+    static bool isSameText(const std::vector<ColoredString>& a, const std::vector<ColoredString>& b)
+    {
+        if (a.size() != b.size())
+            return false;
+
+        for (size_t index = 0; index < a.size(); index++)
+        {
+            if (a[index].string != b[index].string || !isSameColor(a[index].color, b[index].color))
+                return false;
+        }
+
+        return true;
+    }
+
+    const FontBase::TextLayout& FontBase::getTextLayout(const std::vector<ColoredString>& text,
+                                                        const Color& constantColor, float wrap,
+                                                        AlignMode align)
+    {
+        uint64_t hash = 0xCBF29CE484222325ull;
+
+        for (const auto& coloredString : text)
+        {
+            hash = hashBytes(coloredString.string.data(), coloredString.string.size(), hash);
+            hash = hashBytes(&coloredString.color, sizeof(Color), hash);
+        }
+
+        hash = hashBytes(&constantColor, sizeof(Color), hash);
+        hash = hashBytes(&wrap, sizeof(float), hash);
+        hash = hashBytes(&align, sizeof(AlignMode), hash);
+
+        auto found = this->textLayoutIndex.find(hash);
+
+        if (found != this->textLayoutIndex.end())
+        {
+            auto it = found->second;
+
+            const bool same = it->align == align && it->wrap == wrap &&
+                              isSameColor(it->constantColor, constantColor) && isSameText(it->text, text);
+
+            if (same && it->textureCacheID == this->textureCacheID)
+            {
+                this->textLayouts.splice(this->textLayouts.begin(), this->textLayouts, it);
+                return *it;
             }
+
+            this->textLayouts.erase(it);
+            this->textLayoutIndex.erase(found);
         }
-#endif
 
-        ColoredCodepoints codepoints;
+        /* generating may add glyphs and rebuild the atlas, which bumps the cache ID */
+        TextLayout layout {};
+        layout.hash          = hash;
+        layout.text          = text;
+        layout.constantColor = constantColor;
+        layout.wrap          = wrap;
+        layout.align         = align;
+
+        ColoredCodepoints codepoints {};
         getCodepointsFromString(text, codepoints);
 
-#ifdef __WIIU__
-        if (fontPrintCount <= 15) {
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "  after getCodepointsFromString: codepoints.size()=%zu\n", codepoints.codepoints.size());
-                fflush(logFile);
-                fclose(logFile);
-            }
+        if (align == ALIGN_MAX_ENUM)
+            layout.drawCommands = this->generateVertices(codepoints, Range(), constantColor, layout.vertices);
+        else
+        {
+            layout.drawCommands =
+                this->generateVerticesFormatted(codepoints, constantColor, wrap, align, layout.vertices);
         }
-#endif
-
-        std::vector<GlyphVertex> vertices {};
-        auto drawcommands = this->generateVertices(codepoints, Range(), constantcolor, vertices);
-
-#ifdef __WIIU__
-        if (fontPrintCount <= 15) {
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "  after generateVertices: vertices.size()=%zu, drawcommands.size()=%zu\n", 
-                       vertices.size(), drawcommands.size());
-                       
-                if (!drawcommands.empty()) {
-                    const auto& cmd = drawcommands[0];
-                    fprintf(logFile, "  first_drawcmd: texture=%p, startVertex=%d, vertexCount=%d\n",
-                           cmd.texture, cmd.startVertex, cmd.vertexCount);
-                }
-                
-                fflush(logFile);
-                fclose(logFile);
-            }
+
+        layout.textureCacheID = this->textureCacheID;
+
+        if (this->textLayouts.size() >= MAX_TEXT_LAYOUTS)
+        {
+            this->textLayoutIndex.erase(this->textLayouts.back().hash);
+            this->textLayouts.pop_back();
         }
-#endif
 
-        this->printv(graphics, matrix, drawcommands, vertices);
+        this->textLayouts.push_front(std::move(layout));
+        this->textLayoutIndex[hash] = this->textLayouts.begin();
+
+        return this->textLayouts.front();
     }
 
-    void FontBase::printf(GraphicsBase* graphics, const std::vector<ColoredString>& text, float wrap,
-                          AlignMode align, const Matrix4& matrix, const Color& constantcolor)
+    void FontBase::clearTextLayouts()
     {
-        ColoredCodepoints codepoints {};
-        getCodepointsFromString(text, codepoints);
+        this->textLayouts.clear();
+        this->textLayoutIndex.clear();
+    }
 
-        std::vector<GlyphVertex> vertices;
-        auto drawcommands = this->generateVerticesFormatted(codepoints, constantcolor, wrap, align, vertices);
+    void FontBase::print(GraphicsBase* graphics, const std::vector<ColoredString>& text,
+                         const Matrix4& matrix, const Color& constantcolor)
+    {
+        LOVE_LOG_SAMPLED(TRACE, FONT, 15, 30, "print() %zu string(s), font=%p", text.size(), this);
+
+        const auto& layout = this->getTextLayout(text, constantcolor, 0.0f, ALIGN_MAX_ENUM);
+        this->printv(graphics, matrix, layout.drawCommands, layout.vertices);
+    }
 
-        this->printv(graphics, matrix, drawcommands, vertices);
+    void FontBase::printf(GraphicsBase* graphics, const std::vector<ColoredString>& text, float wrap,
+                          AlignMode align, const Matrix4& matrix, const Color& constantcolor)
+    {
+        const auto& layout = this->getTextLayout(text, constantcolor, wrap, align);
+        this->printv(graphics, matrix, layout.drawCommands, layout.vertices);
     }
 
     static bool sortGlyphs(const FontBase::DrawCommand& left, const FontBase::DrawCommand& right)
@@ -361,38 +437,13 @@ namespace love
                                                                   float extra_spacing, Vector2 offset,
                                                                   TextShaper::TextInfo* info)
     {
-#ifdef __WIIU__
-        static int generateCount = 0;
-        generateCount++;
-        
-        if (generateCount <= 10 || generateCount % 60 == 0) {
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "FontBase::generateVertices() called (#%d)\n", generateCount);
-                fprintf(logFile, "  codepoints.size()=%zu\n", codepoints.codepoints.size());
-                fprintf(logFile, "  font=%p, textureCache=%u\n", this, textureCacheID);
-                fflush(logFile);
-                fclose(logFile);
-            }
-        }
-#endif
+        this->uploadPreloadedGlyphs();
 
         std::vector<TextShaper::GlyphPosition> glyphPositions {};
         std::vector<IndexedColor> colors;
         this->shaper->computeGlyphPositions(codepoints, range, offset, extra_spacing, &glyphPositions,
                                             &colors, info);
 
-#ifdef __WIIU__
-        if (generateCount <= 10) {
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "  after computeGlyphPositions: glyphPositions.size()=%zu\n", glyphPositions.size());
-                fflush(logFile);
-                fclose(logFile);
-            }
-        }
-#endif
-
         size_t vertexStartSize = vertices.size();
         vertices.reserve(vertexStartSize + glyphPositions.size() * 4);
 
@@ -412,31 +463,10 @@ namespace love
             uint32_t cacheid   = textureCacheID;
             const Glyph& glyph = findGlyph(info.glyphIndex);
 
-#ifdef __WIIU__
-            if (generateCount <= 10 && i < 5) {
-                FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile) {
-                    fprintf(logFile, "    glyph[%d]: texture=%p, cache=%u->%u\n", 
-                           i, glyph.texture, cacheid, textureCacheID);
-                    fflush(logFile);
-                    fclose(logFile);
-                }
-            }
-#endif
-
             // If findGlyph invalidates the texture cache, restart the loop.
             if (cacheid != textureCacheID)
             {
-#ifdef __WIIU__
-                if (generateCount <= 10) {
-                    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-                    if (logFile) {
-                        fprintf(logFile, "  texture cache invalidated, restarting loop\n");
-                        fflush(logFile);
-                        fclose(logFile);
-                    }
-                }
-#endif
+                LOVE_LOG_TRACE(FONT, "generateVertices() texture cache invalidated, restarting");
                 i = -1; // The next iteration will increment this to 0.
                 commands.clear();
                 vertices.resize(vertexStartSize);
@@ -488,23 +518,8 @@ namespace love
             }
         }
 
-#ifdef __WIIU__
-        if (generateCount <= 10) {
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "  generateVertices result: vertices.size()=%zu, commands.size()=%zu\n", 
-                       vertices.size(), commands.size());
-                       
-                if (!commands.empty()) {
-                    fprintf(logFile, "  first_command: texture=%p, vertexCount=%d\n",
-                           commands[0].texture, commands[0].vertexCount);
-                }
-                
-                fflush(logFile);
-                fclose(logFile);
-            }
-        }
-#endif
+        LOVE_LOG_SAMPLED(TRACE, FONT, 10, 60, "generateVertices() %zu glyph(s), %zu vertices, %zu command(s)",
+                         glyphPositions.size(), vertices.size(), commands.size());
 
         std::sort(commands.begin(), commands.end(), sortGlyphs);
 
@@ -519,6 +534,7 @@ namespace love
     {
         wrap = std::max(wrap, 0.0f);
 
+        this->uploadPreloadedGlyphs();
         uint32_t cacheid = textureCacheID;
 
         std::vector<DrawCommand> drawcommands;
@@ -625,78 +641,18 @@ namespace love
                           const std::vector<DrawCommand>& drawcommands,
                           const std::vector<GlyphVertex>& vertices)
     {
-#ifdef __WIIU__
-        static int printvCount = 0;
-        printvCount++;
-        
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "FontBase::printv() called (#%d)\n", printvCount);
-            fprintf(logFile, "  vertices.size()=%zu, drawcommands.size()=%zu\n", vertices.size(), drawcommands.size());
-            
-            if (vertices.empty() || drawcommands.empty()) {
-                fprintf(logFile, "  EARLY_RETURN: vertices or drawcommands empty\n");
-                fflush(logFile);
-                fclose(logFile);
-                return;
-            }
-            
-            fprintf(logFile, "  graphics=%p, font=%p\n", graphics, this);
-            
-            // Log matrix details
-            const float* m_data = matrix.getElements();
-            fprintf(logFile, "  matrix=[%.2f,%.2f,%.2f,%.2f]\n", m_data[0], m_data[1], m_data[2], m_data[3]);
-            
-            // Log first few vertices
-            if (vertices.size() > 0) {
-                fprintf(logFile, "  first_vertex: x=%.2f y=%.2f s=%.2f t=%.2f\n", 
-                       vertices[0].x, vertices[0].y, vertices[0].s, vertices[0].t);
-            }
-            
-            // Log first draw command
-            if (drawcommands.size() > 0) {
-                const auto& cmd = drawcommands[0];
-                fprintf(logFile, "  first_cmd: texture=%p, startVertex=%d, vertexCount=%d\n",
-                       cmd.texture, cmd.startVertex, cmd.vertexCount);
-            }
-            
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
-
         if (vertices.empty() || drawcommands.empty())
             return;
 
         Matrix4 m(graphics->getTransform(), matrix);
 
+        if (graphics->isCulled(m, vertices.data(), (int)vertices.size()))
+            return;
+
         for (const DrawCommand& cmd : drawcommands)
         {
-#ifdef __WIIU__
-            static int cmdCount = 0;
-            cmdCount++;
-            
-            if (cmdCount <= 20 || cmdCount % 30 == 0) {
-                FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile2) {
-                    fprintf(logFile2, "  DrawCommand (#%d): texture=%p, startVertex=%d, vertexCount=%d\n",
-                           cmdCount, cmd.texture, cmd.startVertex, cmd.vertexCount);
-                    
-                    if (cmd.texture) {
-                        fprintf(logFile2, "    texture: width=%d, height=%d\n", 
-                               cmd.texture->getWidth(), cmd.texture->getHeight());
-                    } else {
-                        fprintf(logFile2, "    texture: NULL_TEXTURE!!!\n");
-                    }
-                    
-                    fflush(logFile2);
-                    fclose(logFile2);
-                }
-            }
-#endif
-
             BatchedDrawCommand command {};
-            command.format      = CommonFormat::XYf_STf_RGBAf;
+            command.format      = CommonFormat::XYf_STf_RGBAub;
             command.indexMode   = TRIANGLEINDEX_QUADS;
             command.vertexCount = cmd.vertexCount;
             command.texture     = cmd.texture;
@@ -706,23 +662,6 @@ namespace love
             auto data               = graphics->requestBatchedDraw(command);
             GlyphVertex* vertexdata = (GlyphVertex*)data.stream;
 
-#ifdef __WIIU__
-            if (cmdCount <= 20) {
-                FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile3) {
-                    fprintf(logFile3, "    requestBatchedDraw returned: stream=%p\n", data.stream);
-                    if (data.stream && cmd.vertexCount > 0) {
-                        // Log what we're about to copy
-                        const auto& srcVertex = vertices[cmd.startVertex];
-                        fprintf(logFile3, "    copying from vertex[%d]: x=%.2f y=%.2f s=%.2f t=%.2f\n",
-                               cmd.startVertex, srcVertex.x, srcVertex.y, srcVertex.s, srcVertex.t);
-                    }
-                    fflush(logFile3);
-                    fclose(logFile3);
-                }
-            }
-#endif
-
             std::copy_n(&vertices[cmd.startVertex], cmd.vertexCount, vertexdata);
             m.transformXY(vertexdata, &vertices[cmd.startVertex], cmd.vertexCount);
         }
@@ -753,6 +692,7 @@ namespace love
     void FontBase::setLineHeight(float height)
     {
         this->shaper->setLineHeight(height);
+        this->clearTextLayouts();
     }
 
     float FontBase::getLineHeight() const
@@ -809,6 +749,14 @@ namespace love
 
         this->shaper->setFallbacks(rasterizers);
         this->glyphs.clear();
+        this->clearTextLayouts();
+
+        /* its rasterizer copies no longer match the shaper's */
+        if (this->glyphPreloader.get() != nullptr)
+        {
+            this->glyphPreloader->stop();
+            this->glyphPreloader.set(nullptr);
+        }
 
         if constexpr (!Console::is(Console::CTR))
         {
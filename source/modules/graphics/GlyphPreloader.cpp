@@ -0,0 +1,113 @@
+#include "common/Logger.hpp"
+
+#include "modules/graphics/GlyphPreloader.hpp"
+
+namespace love
+{
+    GlyphPreloader::GlyphPreloader(const StrongRasterizers& rasterizers) :
+        rasterizers {},
+        pending {},
+        finished {},
+        working(false),
+        stopping(false)
+    {
+        this->threadName = "GlyphPreloader";
+
+        for (const auto& rasterizer : rasterizers)
+            this->rasterizers.emplace_back(rasterizer->clone(), Acquire::NO_RETAIN);
+    }
+
+    GlyphPreloader::~GlyphPreloader()
+    {
+        this->stop();
+    }
+
+    bool GlyphPreloader::canPreload(TextShaper::GlyphIndex glyphIndex) const
+    {
+        const auto index = (size_t)glyphIndex.rasterizerIndex;
+        return index < this->rasterizers.size() && this->rasterizers[index].get() != nullptr;
+    }
+
+    void GlyphPreloader::run()
+    {
+        std::unique_lock lock(this->mutex);
+
+        while (!this->pending.empty() && !this->stopping)
+        {
+            const auto glyphIndex = this->pending.front();
+            this->pending.pop_front();
+
+            lock.unlock();
+
+            const auto& rasterizer = this->rasterizers[glyphIndex.rasterizerIndex];
+            GlyphData* glyphData   = nullptr;
+
+            try
+            {
+                glyphData = rasterizer->getGlyphDataForIndex(glyphIndex.index);
+            }
+            catch (love::Exception& e)
+            {
+                LOVE_LOG_WARN(FONT, "could not preload glyph %d: %s", glyphIndex.index, e.what());
+            }
+
+            lock.lock();
+
+            if (glyphData != nullptr)
+                this->finished.push_back({ glyphIndex, { glyphData, Acquire::NO_RETAIN } });
+        }
+
+        this->working = false;
+    }
+
+    void GlyphPreloader::enqueue(const std::vector<TextShaper::GlyphIndex>& glyphIndices)
+    {
+        std::unique_lock lock(this->mutex);
+
+        if (this->stopping)
+            return;
+
+        for (const auto glyphIndex : glyphIndices)
+        {
+            if (this->canPreload(glyphIndex))
+                this->pending.push_back(glyphIndex);
+        }
+
+        if (this->working || this->pending.empty())
+            return;
+
+        this->working = true;
+
+        /* the last run may have returned without its thread being marked as finished yet */
+        if (!Threadable::start())
+        {
+            Threadable::wait();
+
+            if (!Threadable::start())
+                this->working = false;
+        }
+    }
+
+    void GlyphPreloader::takeFinished(std::vector<Result>& results)
+    {
+        std::unique_lock lock(this->mutex);
+
+        if (this->finished.empty())
+            return;
+
+        results.insert(results.end(), std::make_move_iterator(this->finished.begin()),
+                       std::make_move_iterator(this->finished.end()));
+
+        this->finished.clear();
+    }
+
+    void GlyphPreloader::stop()
+    {
+        {
+            std::unique_lock lock(this->mutex);
+            this->stopping = true;
+        }
+
+        Threadable::wait();
+    }
+} // namespace love
@@ -1,10 +1,13 @@
 #include "modules/graphics/Graphics.tcc"
 
+#include "modules/graphics/Mesh.hpp"
 #include "modules/graphics/Polyline.hpp"
 #include "modules/graphics/SpriteBatch.hpp"
+#include "modules/graphics/Tessellation.hpp"
 #include "modules/window/Window.tcc"
 
 #include "common/Console.hpp"
+#include "common/Logger.hpp"
 #include "common/screen.hpp"
 
 #include <cmath>
@@ -14,6 +17,9 @@ namespace love
     GraphicsBase::GraphicsBase(const char* name) :
         Module(M_GRAPHICS, name),
         defaultTextures(),
+        batchReorderer(),
+        drainingReorderer(false),
+        culling(true),
         created(false),
         active(true),
         deviceProjectionMatrix(),
@@ -22,11 +28,17 @@ namespace love
         pixelWidth(0),
         pixelHeight(0),
         drawCallsBatched(0),
+        drawCallsMerged(0),
+        drawCallsReordered(0),
+        batchesMergedByReordering(0),
+        drawCallsCulled(0),
+        drawCallsIndex32(0),
         drawCalls(0),
         batchedDrawState(),
         cpuProcessingTime(0.0f),
         gpuDrawingTime(0.0f),
-        capabilities()
+        capabilities(),
+        shaderPreloader(new ShaderPreloader(), Acquire::NO_RETAIN)
     {
         this->transformStack.reserve(16);
         this->transformStack.push_back(Matrix4());
@@ -40,6 +52,9 @@ namespace love
 
     GraphicsBase::~GraphicsBase()
     {
+        this->shaderPreloader->stop();
+        this->textureAtlas.clear();
+
         for (int index = 0; index < ShaderBase::STANDARD_MAX_ENUM; index++)
         {
             if (ShaderBase::standardShaders[index])
@@ -57,6 +72,12 @@ namespace love
 
         if (this->batchedDrawState.indexBuffer)
             this->batchedDrawState.indexBuffer->release();
+
+        if (this->batchedDrawState.indexBuffer32)
+            this->batchedDrawState.indexBuffer32->release();
+
+        if (this->batchedDrawState.quadIndexBuffer)
+            this->batchedDrawState.quadIndexBuffer->release();
     }
 
     void GraphicsBase::resetProjection()
@@ -236,12 +257,19 @@ namespace love
         if (this->batchedDrawState.vertexCount > 0)
             stats.drawCalls++;
 
-        stats.drawCallsBatched  = this->drawCallsBatched;
-        stats.textures          = TextureBase::textureCount;
-        stats.textureMemory     = TextureBase::totalGraphicsMemory;
-        stats.shaderSwitches    = ShaderBase::shaderSwitches;
-        stats.cpuProcessingTime = GraphicsBase::cpuProcessingTime;
-        stats.gpuDrawingTime    = GraphicsBase::gpuDrawingTime;
+        stats.drawCallsBatched          = this->drawCallsBatched;
+        stats.drawCallsMerged           = this->drawCallsMerged;
+        stats.drawCallsReordered        = this->drawCallsReordered;
+        stats.batchesMergedByReordering = this->batchesMergedByReordering;
+        stats.drawCallsCulled           = this->drawCallsCulled;
+        stats.drawCallsIndex32          = this->drawCallsIndex32;
+        stats.textures                  = TextureBase::textureCount;
+        stats.textureMemory             = TextureBase::totalGraphicsMemory;
+        stats.shaderSwitches            = ShaderBase::shaderSwitches;
+        stats.cpuProcessingTime         = GraphicsBase::cpuProcessingTime;
+        stats.gpuDrawingTime            = GraphicsBase::gpuDrawingTime;
+
+        this->getBackendStats(stats);
 
         return stats;
     }
@@ -296,80 +324,282 @@ namespace love
         this->pendingScreenshotCallbacks.push_back(info);
     }
 
+    void GraphicsBase::setBatchReorderingEnabled(bool enabled)
+    {
+        if (!enabled)
+            this->drainBatchReorderer();
+
+        this->batchReorderer.setEnabled(enabled);
+    }
+
+    bool GraphicsBase::isCulled(const Matrix4& transform, const Vector2& min, const Vector2& max)
+    {
+        /* custom vertex shaders and 3D transforms can put vertices anywhere */
+        if (!this->culling || !transform.isAffine2DTransform() || !ShaderBase::isDefaultActive())
+            return false;
+
+        const Vector2 corners[4] = { min, Vector2(max.x, min.y), max, Vector2(min.x, max.y) };
+
+        Vector2 transformed[4];
+        transform.transformXY(transformed, corners, 4);
+
+        Vector2 low  = transformed[0];
+        Vector2 high = transformed[0];
+
+        for (int index = 1; index < 4; index++)
+        {
+            low.x  = std::min(low.x, transformed[index].x);
+            low.y  = std::min(low.y, transformed[index].y);
+            high.x = std::max(high.x, transformed[index].x);
+            high.y = std::max(high.y, transformed[index].y);
+        }
+
+        const Rect area = this->getVisibleArea();
+
+        /* NaN bounds fail every comparison and are drawn */
+        if (high.x < area.x || high.y < area.y || low.x > area.x + area.w || low.y > area.y + area.h)
+        {
+            this->drawCallsCulled++;
+            return true;
+        }
+
+        return false;
+    }
+
+    Rect GraphicsBase::getVisibleArea() const
+    {
+        const auto& state   = this->states.back();
+        const auto& targets = state.renderTargets;
+        const auto& target  = targets.colors.empty() ? targets.depthStencil : targets.colors[0];
+
+        Rect area = { 0, 0, this->getWidth(), this->getHeight() };
+
+        if (target.texture.get() != nullptr)
+        {
+            area.w = target.texture->getWidth(target.mipmap);
+            area.h = target.texture->getHeight(target.mipmap);
+        }
+
+        if (state.scissor)
+        {
+            const auto& scissor = state.scissorRect;
+
+            int x1 = std::max(area.x, scissor.x);
+            int y1 = std::max(area.y, scissor.y);
+            int x2 = std::min(area.x + area.w, scissor.x + scissor.w);
+            int y2 = std::min(area.y + area.h, scissor.y + scissor.h);
+
+            area = { x1, y1, std::max(0, x2 - x1), std::max(0, y2 - y1) };
+        }
+
+        return area;
+    }
+
+    void GraphicsBase::drainBatchReorderer()
+    {
+        if (this->batchReorderer.isEmpty() || this->drainingReorderer)
+            return;
+
+        this->drainingReorderer = true;
+
+        const auto emit = [this](const BatchedDrawCommand& command, const uint8_t* vertices, size_t size) {
+            auto data = this->requestBatchedDrawInternal(command);
+            std::memcpy(data.stream, vertices, size);
+        };
+
+        this->batchReorderer.drain(emit, this->drawCallsReordered, this->batchesMergedByReordering);
+        this->drainingReorderer = false;
+    }
+
     BatchedVertexData GraphicsBase::requestBatchedDraw(const BatchedDrawCommand& command)
+    {
+        if (this->batchReorderer.isEnabled() && !this->drainingReorderer)
+        {
+            if (BatchReorderer::canReorder(command))
+            {
+                if (!this->batchReorderer.hasRoom(command))
+                    this->drainBatchReorderer();
+
+                return BatchedVertexData { this->batchReorderer.push(command) };
+            }
+
+            /* anything that can't wait has to come after what is already pending */
+            this->drainBatchReorderer();
+        }
+
+        return this->requestBatchedDrawInternal(command);
+    }
+
+    BatchedVertexData GraphicsBase::requestBatchedDrawInternal(const BatchedDrawCommand& command)
     {
         BatchedDrawState& state = this->batchedDrawState;
 
         bool shouldFlush  = false;
         bool shouldResize = false;
 
-        // clang-format off
-        if (command.primitiveMode != state.primitiveMode
-            || command.format != state.format
-            || ((command.indexMode != TRIANGLEINDEX_NONE) != (state.indexCount > 0))
-            || command.texture != state.texture
-            || command.shaderType != state.shaderType)
-        {
-            shouldFlush = true;
-        }
-        // clang-format on
+        const bool indexed = command.indexMode != TRIANGLEINDEX_NONE;
 
-        int totalVertices = state.vertexCount + command.vertexCount;
+        /* quads index the static quad buffer relative to the batch's first vertex */
+        const bool staticQuads = command.indexMode == TRIANGLEINDEX_QUADS && state.quadIndexBuffer != nullptr &&
+                                 command.vertexCount <= QUAD_INDEX_BUFFER_VERTICES;
 
-        if (totalVertices > LOVE_UINT16_MAX && command.indexMode != TRIANGLEINDEX_NONE)
-            shouldFlush = true;
+        const int requestedIndexCount = getIndexCount(command.indexMode, command.vertexCount);
+        const int totalVertices       = state.vertexCount + command.vertexCount;
 
-        int requestedIndexCount   = getIndexCount(command.indexMode, command.vertexCount);
-        size_t requestedIndexSize = requestedIndexCount * sizeof(uint16_t);
+        bool quadIndices         = staticQuads;
+        int promotedQuadVertices = 0;
 
-        size_t newDataSize    = 0;
-        size_t bufferSizes[2] = { 0, 0 };
+        IndexDataType indexType = INDEX_UINT16;
+        int streamedIndexCount  = 0;
 
-        if (command.format != CommonFormat::NONE)
+        size_t newDataSize    = 0;
+        size_t bufferSizes[3] = { 0, 0, 0 };
+
+        /*
+        ** Try joining the current batch first. If that needs a flush, plan the
+        ** draw again as the first one of a new batch, which may use smaller
+        ** indices or the static quad buffer after all.
+        */
+        for (bool joining = state.lastVertexCount > 0;; joining = false)
         {
-            size_t stride   = getFormatStride(command.format);
-            size_t dataSize = stride * totalVertices;
+            quadIndices          = staticQuads;
+            promotedQuadVertices = 0;
+
+            /*
+            ** Joining a batch that streams its indices means streaming ours too.
+            ** A static quad batch that something else joins (or that outgrows the
+            ** static buffer) is promoted to streamed indices instead of flushing;
+            ** the quads already in it get their indices written below.
+            */
+            if (joining && indexed && state.indexed)
+            {
+                if (!state.quadIndices)
+                    quadIndices = false;
+                else if (!staticQuads ||
+                         state.lastVertexCount + command.vertexCount > QUAD_INDEX_BUFFER_VERTICES)
+                {
+                    quadIndices          = false;
+                    promotedQuadVertices = state.lastVertexCount;
+                }
+            }
 
-            if (state.vertexBufferMap.data != nullptr && dataSize > state.vertexBufferMap.size)
+            /* streamed indices count from the batch's first vertex, only a batch this big needs 32 bits */
+            const int batchVertices = (joining ? state.lastVertexCount : 0) + command.vertexCount;
+            indexType               = getIndexDataTypeFromMax(std::max(batchVertices - 1, 0));
+
+            const bool hasStreamedIndices = !state.quadIndices && state.lastIndexCount > 0;
+
+            // clang-format off
+            if (joining && (command.primitiveMode != state.primitiveMode
+                || command.format != state.format
+                || indexed != state.indexed
+                || (quadIndices != state.quadIndices && promotedQuadVertices == 0)
+                || (indexed && !quadIndices && hasStreamedIndices && indexType != state.indexType)
+                || command.texture != state.texture
+                || command.shaderType != state.shaderType))
+            {
                 shouldFlush = true;
+                continue;
+            }
+            // clang-format on
+
+            streamedIndexCount = 0;
+
+            if (!quadIndices)
+            {
+                const int promotedIndexCount = getIndexCount(TRIANGLEINDEX_QUADS, promotedQuadVertices);
+                streamedIndexCount           = requestedIndexCount + promotedIndexCount;
+            }
+
+            bool full = false;
 
-            if (dataSize > state.vertexBuffer->getUsableSize())
+            newDataSize    = 0;
+            bufferSizes[0] = bufferSizes[1] = bufferSizes[2] = 0;
+            shouldResize   = false;
+
+            if (command.format != CommonFormat::NONE)
             {
+                size_t stride   = getFormatStride(command.format);
+                size_t dataSize = stride * totalVertices;
+
+                if (state.vertexBufferMap.data != nullptr && dataSize > state.vertexBufferMap.size)
+                    full = true;
+
+                if (dataSize > state.vertexBuffer->getUsableSize())
+                {
 #ifdef __WIIU__
-                // Wii U: Use conservative growth to prevent memory issues
-                const size_t WII_U_MAX_VERTEX_BUFFER = 64 * 1024 * 1024; // 64MB limit
-                size_t newSize = std::max(dataSize, state.vertexBuffer->getSize() + (state.vertexBuffer->getSize() / 2));
-                bufferSizes[0] = std::min(newSize, WII_U_MAX_VERTEX_BUFFER);
+                    // Wii U: Use conservative growth to prevent memory issues
+                    const size_t WII_U_MAX_VERTEX_BUFFER = 64 * 1024 * 1024; // 64MB limit
+                    const size_t currentSize = state.vertexBuffer->getSize();
+                    size_t newSize = std::max(dataSize, currentSize + (currentSize / 2));
+                    bufferSizes[0] = std::min(newSize, WII_U_MAX_VERTEX_BUFFER);
 #else
-                bufferSizes[0] = std::max(dataSize, state.vertexBuffer->getSize() * 2);
+                    bufferSizes[0] = std::max(dataSize, state.vertexBuffer->getSize() * 2);
 #endif
-                shouldResize   = true;
+                    shouldResize   = true;
+                }
+
+                newDataSize = stride * command.vertexCount;
             }
 
-            newDataSize = stride * command.vertexCount;
-        }
+            if (streamedIndexCount > 0 && indexType == INDEX_UINT16)
+            {
+                size_t dataSize = (state.indexCount + streamedIndexCount) * sizeof(uint16_t);
 
-        if (command.indexMode != TRIANGLEINDEX_NONE)
-        {
-            size_t dataSize = (state.indexCount + requestedIndexCount) * sizeof(uint16_t);
+                if (state.indexBufferMap.data != nullptr && dataSize > state.indexBufferMap.size)
+                    full = true;
 
-            if (state.indexBufferMap.data != nullptr && dataSize > state.indexBufferMap.size)
-                shouldFlush = true;
-
-            if (dataSize > state.indexBuffer->getUsableSize())
+                if (dataSize > state.indexBuffer->getUsableSize())
+                {
+#ifdef __WIIU__
+                    // Wii U: Use conservative growth to prevent memory issues
+                    const size_t WII_U_MAX_INDEX_BUFFER = 16 * 1024 * 1024; // 16MB limit
+                    const size_t currentSize = state.indexBuffer->getSize();
+                    size_t newSize = std::max(dataSize, currentSize + (currentSize / 2));
+                    bufferSizes[1] = std::min(newSize, WII_U_MAX_INDEX_BUFFER);
+#else
+                    bufferSizes[1] = std::max(dataSize, state.indexBuffer->getSize() * 2);
+#endif
+                    shouldResize   = true;
+                }
+            }
+            else if (streamedIndexCount > 0)
             {
+                size_t dataSize    = (state.indexCount32 + streamedIndexCount) * sizeof(uint32_t);
+                size_t currentSize = state.indexBuffer32 ? state.indexBuffer32->getSize() : 0;
+
+                if (state.indexBufferMap32.data != nullptr && dataSize > state.indexBufferMap32.size)
+                    full = true;
+
+                if (state.indexBuffer32 == nullptr || dataSize > state.indexBuffer32->getUsableSize())
+                {
 #ifdef __WIIU__
-                // Wii U: Use conservative growth to prevent memory issues
-                const size_t WII_U_MAX_INDEX_BUFFER = 16 * 1024 * 1024; // 16MB limit
-                size_t newSize = std::max(dataSize, state.indexBuffer->getSize() + (state.indexBuffer->getSize() / 2));
-                bufferSizes[1] = std::min(newSize, WII_U_MAX_INDEX_BUFFER);
+                    const size_t WII_U_MAX_INDEX_BUFFER = 16 * 1024 * 1024; // 16MB limit
+                    size_t newSize = std::max(dataSize, currentSize + (currentSize / 2));
+                    newSize        = std::max(newSize, INIT_INDEX_BUFFER_SIZE);
+                    bufferSizes[2] = std::min(newSize, WII_U_MAX_INDEX_BUFFER);
 #else
-                bufferSizes[1] = std::max(dataSize, state.indexBuffer->getSize() * 2);
+                    bufferSizes[2] = std::max({ dataSize, currentSize * 2, INIT_INDEX_BUFFER_SIZE });
 #endif
-                shouldResize   = true;
+                    shouldResize   = true;
+                }
             }
+
+            shouldFlush = shouldFlush || full;
+
+            /* both flush the current batch, so this draw starts the next one */
+            if (joining && (full || shouldResize))
+            {
+                shouldFlush = true;
+                continue;
+            }
+
+            break;
         }
 
+        const size_t indexSize          = (indexType == INDEX_UINT32) ? sizeof(uint32_t) : sizeof(uint16_t);
+        const size_t requestedIndexSize = streamedIndexCount * indexSize;
+
         if (shouldFlush || shouldResize)
         {
             flushBatchedDraws();
@@ -380,58 +610,85 @@ namespace love
             state.shaderType    = command.shaderType;
             state.isFont        = command.isFont;
             state.pushTransform = command.pushTransform;
+            state.indexed       = indexed;
         }
 
+        state.quadIndices = quadIndices;
+
+        if (streamedIndexCount > 0)
+            state.indexType = indexType;
+
         if (state.lastVertexCount == 0)
         {
             if (ShaderBase::isDefaultActive())
             {
-#ifdef __WIIU__
-                static int shaderSwitchCount = 0;
-                shaderSwitchCount++;
-                
-                FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile) {
-                    const char* typeName = "unknown";
-                    switch(state.shaderType) {
-                        case ShaderBase::STANDARD_DEFAULT: typeName = "STANDARD_DEFAULT"; break;
-                        case ShaderBase::STANDARD_TEXTURE: typeName = "STANDARD_TEXTURE"; break;
-                        case ShaderBase::STANDARD_VIDEO: typeName = "STANDARD_VIDEO"; break;
-                    }
-                    fprintf(logFile, "requestBatchedDraw() #%d: switching to shader type %s for %s\n", 
-                            shaderSwitchCount, typeName, command.isFont ? "FONT" : "GRAPHICS");
-                    fflush(logFile);
-                    fclose(logFile);
-                }
-#endif
+                LOVE_LOG_TRACE(GRAPHICS, "requestBatchedDraw() attaching default shader %d (%s)",
+                               (int)state.shaderType, command.isFont ? "font" : "graphics");
                 ShaderBase::attachDefault(state.shaderType);
             }
         }
 
         if (shouldResize)
         {
+            this->submitDeferredDraws();
+
             if (state.vertexBuffer->getSize() < bufferSizes[0])
             {
                 state.vertexBuffer->release();
                 state.vertexBuffer = newVertexBuffer(bufferSizes[0]);
+                state.vertexCount  = 0;
             }
 
             if (state.indexBuffer->getSize() < bufferSizes[1])
             {
                 state.indexBuffer->release();
                 state.indexBuffer = newIndexBuffer(bufferSizes[1]);
+                state.indexCount  = 0;
+            }
+
+            if (bufferSizes[2] > 0 && (!state.indexBuffer32 || state.indexBuffer32->getSize() < bufferSizes[2]))
+            {
+                if (state.indexBuffer32)
+                    state.indexBuffer32->release();
+
+                state.indexBuffer32 = newIndexBuffer32(bufferSizes[2]);
+                state.indexCount32  = 0;
             }
         }
 
-        if (command.indexMode != TRIANGLEINDEX_NONE)
+        if (streamedIndexCount > 0 && state.indexType == INDEX_UINT16)
         {
             if (state.indexBufferMap.data == nullptr)
                 state.indexBufferMap = state.indexBuffer->map(requestedIndexSize);
 
-            auto* indices = state.indexBufferMap.data;
-            fillIndices(command.indexMode, state.vertexCount, command.vertexCount, indices);
+            auto*& indices = state.indexBufferMap.data;
+
+            if (promotedQuadVertices > 0)
+            {
+                fillIndices(TRIANGLEINDEX_QUADS, (uint16_t)0, (uint16_t)promotedQuadVertices, indices);
+                indices += getIndexCount(TRIANGLEINDEX_QUADS, promotedQuadVertices);
+            }
+
+            const uint16_t first = (uint16_t)state.lastVertexCount;
+            fillIndices(command.indexMode, first, (uint16_t)command.vertexCount, indices);
+            indices += requestedIndexCount;
+        }
+        else if (streamedIndexCount > 0)
+        {
+            if (state.indexBufferMap32.data == nullptr)
+                state.indexBufferMap32 = state.indexBuffer32->map(requestedIndexSize);
+
+            auto*& indices = state.indexBufferMap32.data;
 
-            state.indexBufferMap.data += requestedIndexCount;
+            if (promotedQuadVertices > 0)
+            {
+                fillIndices(TRIANGLEINDEX_QUADS, (uint32_t)0, (uint32_t)promotedQuadVertices, indices);
+                indices += getIndexCount(TRIANGLEINDEX_QUADS, promotedQuadVertices);
+            }
+
+            const uint32_t first = (uint32_t)state.lastVertexCount;
+            fillIndices(command.indexMode, first, (uint32_t)command.vertexCount, indices);
+            indices += requestedIndexCount;
         }
 
         BatchedVertexData data {};
@@ -452,50 +709,34 @@ namespace love
         state.lastIndexCount += requestedIndexCount;
 
         state.vertexCount += command.vertexCount;
-        state.indexCount += requestedIndexCount;
+
+        if (state.indexType == INDEX_UINT32)
+            state.indexCount32 += streamedIndexCount;
+        else
+            state.indexCount += streamedIndexCount;
 
         return data;
     }
 
     void GraphicsBase::flushBatchedDraws()
     {
+        this->drainBatchReorderer();
+
         BatchedDrawState& state = this->batchedDrawState;
 
         if ((state.lastIndexCount == 0 && state.lastVertexCount == 0) || state.flushing)
         {
-#ifdef __WIIU__
-            static int emptyFlushCount = 0;
-            emptyFlushCount++;
-            if (emptyFlushCount <= 5 || emptyFlushCount % 120 == 0) {
-                FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile) {
-                    fprintf(logFile, "flushBatchedDraws() called but no draw data (empty flush #%d)\n", emptyFlushCount);
-                    fflush(logFile);
-                    fclose(logFile);
-                }
-            }
-#endif
             return;
         }
 
-#ifdef __WIIU__
-        static int realFlushCount = 0;
-        realFlushCount++;
-        if (realFlushCount <= 10 || realFlushCount % 60 == 0) {
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "flushBatchedDraws() ACTUALLY FLUSHING %d vertices, %d indices (flush #%d)\n", 
-                        state.lastVertexCount, state.lastIndexCount, realFlushCount);
-                fflush(logFile);
-                fclose(logFile);
-            }
-        }
-#endif
+        LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 10, 60, "flushBatchedDraws() %d vertices, %d indices",
+                         state.lastVertexCount, state.lastIndexCount);
 
         VertexAttributes attributes {};
         BufferBindings buffers {};
 
-        size_t usedSizes[2] = { 0, 0 };
+        size_t usedSizes[3] = { 0, 0, 0 };
+        size_t firstVertex  = 0;
 
         if (state.format != CommonFormat::NONE)
         {
@@ -503,8 +744,8 @@ namespace love
 
             usedSizes[0] = state.lastVertexCount;
 
-            size_t offset = state.vertexBuffer->unmap(usedSizes[0]);
-            buffers.set(0, state.vertexBuffer, offset, state.vertexCount);
+            firstVertex = state.vertexBuffer->unmap(usedSizes[0]);
+            buffers.set(0, state.vertexBuffer, firstVertex, state.vertexCount);
 
             state.vertexBufferMap = MapInfo<Vertex>();
         }
@@ -518,7 +759,39 @@ namespace love
         // if (state.pushTransform)
         this->pushIdentityTransform();
 
-        if (state.lastIndexCount > 0)
+        if (state.lastIndexCount > 0 && state.quadIndices)
+        {
+            DrawIndexedCommand command(&attributes, &buffers, state.quadIndexBuffer);
+            command.primitiveType     = state.primitiveMode;
+            command.indexCount        = state.lastIndexCount;
+            command.indexType         = INDEX_UINT16;
+            command.indexBufferOffset = 0;
+            command.baseVertex        = firstVertex;
+            command.quadIndices       = true;
+            command.texture           = state.texture;
+            command.isFont            = state.isFont;
+
+            this->draw(command);
+        }
+        else if (state.lastIndexCount > 0 && state.indexType == INDEX_UINT32)
+        {
+            usedSizes[2] = state.lastIndexCount;
+
+            DrawIndexedCommand command(&attributes, &buffers, state.indexBuffer32);
+            command.primitiveType     = state.primitiveMode;
+            command.indexCount        = state.lastIndexCount;
+            command.indexType         = INDEX_UINT32;
+            command.indexBufferOffset = state.indexBuffer32->unmap(usedSizes[2]);
+            command.baseVertex        = firstVertex;
+            command.texture           = state.texture;
+            command.isFont            = state.isFont;
+
+            this->draw(command);
+            this->drawCallsIndex32++;
+
+            state.indexBufferMap32 = MapInfo<uint32_t>();
+        }
+        else if (state.lastIndexCount > 0)
         {
             usedSizes[1] = state.lastIndexCount;
 
@@ -527,6 +800,7 @@ namespace love
             command.indexCount        = state.lastIndexCount;
             command.indexType         = INDEX_UINT16;
             command.indexBufferOffset = state.indexBuffer->unmap(usedSizes[1]);
+            command.baseVertex        = firstVertex;
             command.texture           = state.texture;
             command.isFont            = state.isFont;
 
@@ -551,6 +825,9 @@ namespace love
         if (usedSizes[1] > 0)
             state.indexBuffer->markUsed(usedSizes[1]);
 
+        if (usedSizes[2] > 0)
+            state.indexBuffer32->markUsed(usedSizes[2]);
+
         // if (state.pushTransform)
         this->popTransform();
 
@@ -574,15 +851,7 @@ namespace love
 
     ShaderStageBase* GraphicsBase::newShaderStage(ShaderStageType stage, const std::string& filepath)
     {
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "GraphicsBase::newShaderStage() called - stage: %d (%s), filepath: %s\n", 
-                    stage, (stage == 0 ? "VERTEX" : "PIXEL"), filepath.c_str());
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "GraphicsBase::newShaderStage() called - stage: %d (%s), filepath: %s", stage, (stage == 0 ? "VERTEX" : "PIXEL"), filepath.c_str());
         return this->newShaderStageInternal(stage, filepath);
     }
 
@@ -591,22 +860,26 @@ namespace love
         return new SpriteBatch(this, texture, size, usage);
     }
 
+    MeshBase* GraphicsBase::newMesh(const std::vector<XYf_STf_RGBAf>& vertices, MeshDrawMode mode,
+                                    BufferDataUsage usage)
+    {
+        return new MeshBase(vertices, mode, usage);
+    }
+
+    MeshBase* GraphicsBase::newMesh(int vertexCount, MeshDrawMode mode, BufferDataUsage usage)
+    {
+        return new MeshBase(vertexCount, mode, usage);
+    }
+
     ShaderBase* GraphicsBase::newShader(const std::vector<std::string>& filepaths,
                                         const ShaderBase::CompileOptions& options)
     {
         StrongRef<ShaderStageBase> stages[SHADERSTAGE_MAX_ENUM] {};
 
-#ifdef __WIIU__
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "GraphicsBase::newShader() called with %zu filepaths\n", filepaths.size());
-            for (size_t i = 0; i < filepaths.size(); i++) {
-                fprintf(logFile, "  filepath[%zu] = %s\n", i, filepaths[i].c_str());
-            }
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
+        LOVE_LOG_DEBUG(GRAPHICS, "newShader() called with %zu filepath(s)", filepaths.size());
+
+        for (size_t index = 0; index < filepaths.size(); index++)
+            LOVE_LOG_DEBUG(GRAPHICS, "  filepath[%zu] = %s", index, filepaths[index].c_str());
 
         bool validStages[SHADERSTAGE_MAX_ENUM] {};
         validStages[SHADERSTAGE_VERTEX] = true;
@@ -640,42 +913,29 @@ namespace love
                     throw Exception("No shader files provided");
                 }
 
-#ifdef __WIIU__
-                FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile2) {
-                    fprintf(logFile2, "GraphicsBase::newShader() - creating stage %d (%s) with filepath: %s\n", 
-                            index, (index == 0 ? "VERTEX" : "PIXEL"), filepath.c_str());
-                    fflush(logFile2);
-                    fclose(logFile2);
-                }
-#endif
+                LOVE_LOG_TRACE(GRAPHICS, "GraphicsBase::newShader() - creating stage %d (%s) with filepath: %s", index, (index == 0 ? "VERTEX" : "PIXEL"), filepath.c_str());
                 
                 stages[index].set(this->newShaderStage(type, filepath), Acquire::NO_RETAIN);
 
-#ifdef __WIIU__
-                FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-                if (logFile3) {
-                    fprintf(logFile3, "GraphicsBase::newShader() - stage %d (%s) created successfully\n", 
-                            index, (index == 0 ? "VERTEX" : "PIXEL"));
-                    fflush(logFile3);
-                    fclose(logFile3);
-                }
-#endif
+                LOVE_LOG_TRACE(GRAPHICS, "GraphicsBase::newShader() - stage %d (%s) created successfully", index, (index == 0 ? "VERTEX" : "PIXEL"));
             }
         }
 
-#ifdef __WIIU__
-        FILE* logFile4 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile4) {
-            fprintf(logFile4, "GraphicsBase::newShader() - about to call newShaderInternal()\n");
-            fflush(logFile4);
-            fclose(logFile4);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "GraphicsBase::newShader() - about to call newShaderInternal()");
 
         return this->newShaderInternal(stages, options);
     }
 
+    void GraphicsBase::precompileShaders(const std::vector<std::string>& filepaths)
+    {
+        this->shaderPreloader->enqueue(filepaths);
+    }
+
+    bool GraphicsBase::takePreloadedShaderStage(const std::string& filepath, std::vector<uint8_t>& code)
+    {
+        return this->shaderPreloader->take(filepath, code);
+    }
+
     void GraphicsBase::checkSetDefaultFont()
     {
         if (this->states.back().font.get() != nullptr)
@@ -737,8 +997,14 @@ namespace love
         if (this->batchedDrawState.indexBuffer)
             this->batchedDrawState.indexBuffer->nextFrame();
 
-        this->batchedDrawState.vertexCount = 0;
-        this->batchedDrawState.indexCount  = 0;
+        if (this->batchedDrawState.indexBuffer32)
+            this->batchedDrawState.indexBuffer32->nextFrame();
+
+        this->batchedDrawState.vertexCount  = 0;
+        this->batchedDrawState.indexCount   = 0;
+        this->batchedDrawState.indexCount32 = 0;
+
+        DataBufferFrame::current++;
     }
 
     void GraphicsBase::advanceStreamBuffersGlobal()
@@ -1089,21 +1355,24 @@ namespace love
             const auto& transform = this->getTransform();
             bool is2D             = transform.isAffine2DTransform();
 
+            if (this->isCulled(transform, vertices.data(), (int)vertices.size()))
+                return;
+
             BatchedDrawCommand command {};
-            command.format      = CommonFormat::XYf_STf_RGBAf;
+            command.format      = CommonFormat::XYf_STf_RGBAub;
             command.indexMode   = TRIANGLEINDEX_FAN;
             command.vertexCount = (int)vertices.size() - (skipLastFilledVertex ? 1 : 0);
 
             BatchedVertexData data = this->requestBatchedDraw(command);
 
-            XYf_STf_RGBAf* stream = (XYf_STf_RGBAf*)data.stream;
+            Vertex* stream = (Vertex*)data.stream;
 
-            Color color = this->getColor();
+            Color32 color = this->getColor();
 
             for (int index = 0; index < command.vertexCount; index++)
             {
-                stream[index].s     = 0.0f;
-                stream[index].t     = 0.0f;
+                stream[index].s     = 0;
+                stream[index].t     = 0;
                 stream[index].color = color;
             }
 
@@ -1112,9 +1381,27 @@ namespace love
         }
     }
 
+    template<typename Generate>
+    void GraphicsBase::fillFan(int vertexCount, const Vector2& min, const Vector2& max, Generate&& generate)
+    {
+        const auto& transform = this->getTransform();
+
+        if (this->isCulled(transform, min, max))
+            return;
+
+        BatchedDrawCommand command {};
+        command.format      = CommonFormat::XYf_STf_RGBAub;
+        command.indexMode   = TRIANGLEINDEX_FAN;
+        command.vertexCount = vertexCount;
+
+        BatchedVertexData data = this->requestBatchedDraw(command);
+
+        generate(tessellation::VertexWriter((Vertex*)data.stream, transform, this->getColor()));
+    }
+
     int GraphicsBase::calculateEllipsePoints(float a, float b) const
     {
-        auto points = (int)std::sqrtf(((a + b) / 2.0f) * 20.0f * (float)this->pixelScaleStack.back());
+        auto points = (int)std::sqrt(((a + b) / 2.0f) * 20.0f * (float)this->pixelScaleStack.back());
         return std::max(points, 8);
     }
 
@@ -1140,43 +1427,26 @@ namespace love
 
         points = std::max(points / 4, 1);
 
-        const float halfPi = float(LOVE_M_PI / 2);
-        float shift        = halfPi / ((float)points + 1.0f);
-
-        size_t numCoords = (points + 2) * 4;
-        auto* coords     = this->getScratchBuffer<Vector2>(numCoords + 1);
-
-        float phi = 0.0f;
-
-        for (int i = 0; i <= points + 2; ++i, phi += shift)
-        {
-            coords[i].x = x + rx * (1 - cosf(phi));
-            coords[i].y = y + ry * (1 - sinf(phi));
-        }
+        const auto generate = [&](auto&& emit) {
+            tessellation::roundedRectangle(x, y, w, h, rx, ry, points, emit);
+        };
 
-        phi = halfPi;
+        const int numCoords = tessellation::getRoundedRectangleCount(points);
 
-        for (int i = points + 2; i <= 2 * (points + 2); ++i, phi += shift)
+        if (mode == DRAW_FILL)
         {
-            coords[i].x = x + w - rx * (1 + cosf(phi));
-            coords[i].y = y + ry * (1 - sinf(phi));
-        }
+            const Vector2 extent(std::abs(rx), std::abs(ry));
+            const Vector2 low(std::min(x + rx, x + w - rx), std::min(y + ry, y + h - ry));
+            const Vector2 high(std::max(x + rx, x + w - rx), std::max(y + ry, y + h - ry));
 
-        phi = 2 * halfPi;
-
-        for (int i = 2 * (points + 2); i <= 3 * (points + 2); ++i, phi += shift)
-        {
-            coords[i].x = x + w - rx * (1 + cosf(phi));
-            coords[i].y = y + h - ry * (1 + sinf(phi));
+            this->fillFan(numCoords, low - extent, high + extent, generate);
+            return;
         }
 
-        phi = 3 * halfPi;
+        auto* coords = this->getScratchBuffer<Vector2>(numCoords + 1);
+        int count    = 0;
 
-        for (int i = 3 * (points + 2); i <= 4 * (points + 2); ++i, phi += shift)
-        {
-            coords[i].x = x + rx * (1 - cosf(phi));
-            coords[i].y = y + h - ry * (1 + sinf(phi));
-        }
+        generate([&](float px, float py) { coords[count++] = Vector2(px, py); });
 
         coords[numCoords] = coords[0];
         this->polygon(mode, std::span(coords, numCoords + 1));
@@ -1193,34 +1463,29 @@ namespace love
 
     void GraphicsBase::ellipse(DrawMode mode, float x, float y, float a, float b, int points)
     {
-        float twoPi = float(LOVE_M_PI * 2);
-
         if (points <= 0)
             points = 1;
 
-        float shift = twoPi / points;
-        float phi   = 0.0f;
-
-        int extraPoints = 1 + (mode == DRAW_FILL ? 1 : 0);
-
-        auto* polygonCoords = this->getScratchBuffer<Vector2>(points + extraPoints);
-        auto* coords        = polygonCoords;
-
         if (mode == DRAW_FILL)
         {
-            coords[0].x = x;
-            coords[0].y = y;
-            coords++;
-        }
+            const Vector2 center(x, y);
+            const Vector2 extent(std::abs(a), std::abs(b));
 
-        for (int index = 0; index < points; ++index, phi += shift)
-        {
-            coords[index].x = x + a * cosf(phi);
-            coords[index].y = y + b * sinf(phi);
+            this->fillFan(points + 2, center - extent, center + extent, [&](auto&& emit) {
+                emit(x, y);
+                tessellation::ellipse(x, y, a, b, points, emit);
+            });
+
+            return;
         }
 
-        coords[points] = coords[0];
-        this->polygon(mode, std::span(polygonCoords, points + extraPoints), false);
+        auto* coords = this->getScratchBuffer<Vector2>(points + 1);
+        int count    = 0;
+
+        const auto collect = [&](float px, float py) { coords[count++] = Vector2(px, py); };
+        tessellation::ellipse(x, y, a, b, points, collect);
+
+        this->polygon(mode, std::span(coords, points + 1), false);
     }
 
     void GraphicsBase::ellipse(DrawMode mode, float x, float y, float a, float b)
@@ -1262,19 +1527,48 @@ namespace love
         if (mode == DRAW_FILL && arcMode == ARC_OPEN)
             arcMode = ARC_CLOSED;
 
-        float phi = angle1;
+        /* arcs start at any angle, so the points are rotated along instead of read from a table */
+        const double cosShift = std::cos((double)shift);
+        const double sinShift = std::sin((double)shift);
 
-        Vector2* coords = nullptr;
-        int numCoords   = 0;
+        const auto createPoints = [&](auto&& emit) {
+            double c = std::cos((double)angle1);
+            double s = std::sin((double)angle1);
 
-        const auto createPoints = [&](Vector2* coordinates) {
-            for (int i = 0; i <= points; ++i, phi += shift)
+            for (int i = 0; i <= points; ++i)
             {
-                coordinates[i].x = x + radius * cosf(phi);
-                coordinates[i].y = y + radius * sinf(phi);
+                emit(x + radius * (float)c, y + radius * (float)s);
+
+                const double next = c * cosShift - s * sinShift;
+                s                 = s * cosShift + c * sinShift;
+                c                 = next;
             }
         };
 
+        if (mode == DRAW_FILL)
+        {
+            const Vector2 center(x, y);
+            const Vector2 extent(std::abs(radius), std::abs(radius));
+
+            if (arcMode == ARC_PIE)
+            {
+                this->fillFan(points + 2, center - extent, center + extent, [&](auto&& emit) {
+                    emit(x, y);
+                    createPoints(emit);
+                });
+            }
+            else
+                this->fillFan(points + 1, center - extent, center + extent, createPoints);
+
+            return;
+        }
+
+        Vector2* coords = nullptr;
+        int numCoords   = 0;
+        int count       = 0;
+
+        const auto store = [&](float px, float py) { coords[count++] = Vector2(px, py); };
+
         if (arcMode == ARC_PIE)
         {
             numCoords = points + 3;
@@ -1282,21 +1576,22 @@ namespace love
             coords    = this->getScratchBuffer<Vector2>(numCoords);
             coords[0] = coords[numCoords - 1] = Vector2(x, y);
 
-            createPoints(coords + 1);
+            count = 1;
+            createPoints(store);
         }
         else if (arcMode == ARC_OPEN)
         {
             numCoords = points + 1;
             coords    = this->getScratchBuffer<Vector2>(numCoords);
 
-            createPoints(coords);
+            createPoints(store);
         }
         else
         {
             numCoords = points + 2;
             coords    = this->getScratchBuffer<Vector2>(numCoords);
 
-            createPoints(coords);
+            createPoints(store);
             coords[numCoords - 1] = coords[0];
         }
 
@@ -1322,19 +1617,25 @@ namespace love
 
         BatchedDrawCommand command {};
         command.primitiveMode = PRIMITIVE_POINTS;
-        command.format        = CommonFormat::XYf_STf_RGBAf;
+        command.format        = CommonFormat::XYf_STf_RGBAub;
         command.vertexCount   = count;
 
         BatchedVertexData data = this->requestBatchedDraw(command);
 
-        XYf_STf_RGBAf* stream = (XYf_STf_RGBAf*)data.stream;
+        Vertex* stream = (Vertex*)data.stream;
 
         if (is2D)
             transform.transformXY(stream, positions, command.vertexCount);
 
+        for (int index = 0; index < command.vertexCount; index++)
+        {
+            stream[index].s = 0;
+            stream[index].t = 0;
+        }
+
         if (!colors)
         {
-            Color color = this->getColor();
+            Color32 color = this->getColor();
 
             for (int index = 0; index < command.vertexCount; index++)
                 stream[index].color = color;
@@ -1374,4 +1675,12 @@ namespace love
     {
         texture->draw(this, q, matrix);
     }
+
+    void GraphicsBase::drawInstanced(MeshBase* mesh, const Matrix4& matrix, int instanceCount)
+    {
+        if (!this->capabilities.features[FEATURE_INSTANCING])
+            throw love::Exception("Instancing is not supported on this system.");
+
+        mesh->drawInstanced(this, matrix, instanceCount);
+    }
 } // namespace love
@@ -1,180 +1,500 @@
 #include "modules/graphics/Mesh.hpp"
+
 #include "common/Exception.hpp"
+
+#include "modules/graphics/Graphics.tcc"
+
+#include <algorithm>
 #include <cstring>
 
-using namespace love;
-
-love::Type MeshBase::type("Mesh", &Drawable::type);
-
-static const char* drawModeNames[] = {
-    "fan",
-    "strip", 
-    "triangles",
-    "points"
-};
-
-MeshBase::MeshBase(const std::vector<Vertex>& vertices, DrawMode mode, BufferDataUsage usage)
-    : vertices(vertices)
-    , drawMode(mode)
-    , usage(usage)
-    , texture(nullptr)
-    , hasDrawRange(false)
-    , drawRangeStart(0)
-    , drawRangeCount(0)
-{
-}
-
-MeshBase::MeshBase(int vertexCount, DrawMode mode, BufferDataUsage usage)
-    : drawMode(mode)
-    , usage(usage)
-    , texture(nullptr)
-    , hasDrawRange(false)
-    , drawRangeStart(0)
-    , drawRangeCount(0)
+namespace love
 {
-    vertices.resize(vertexCount);
-}
+    Type MeshBase::type("Mesh", &Drawable::type);
 
-MeshBase::~MeshBase()
-{
-    if (texture)
-        texture->release();
-}
+    // clang-format off
+    static constexpr const char* drawModeNames[] = {
+        "fan",
+        "strip",
+        "triangles",
+        "points"
+    };
+    // clang-format on
 
-void MeshBase::setVertices(const std::vector<Vertex>& verts)
-{
-    vertices = verts;
-}
+    static Vertex packVertex(const XYf_STf_RGBAf& vertex)
+    {
+        Vertex result {};
+        result.x     = vertex.x;
+        result.y     = vertex.y;
+        result.s     = vertex.s;
+        result.t     = vertex.t;
+        result.color = vertex.color;
 
-const std::vector<Vertex>& MeshBase::getVertices() const
-{
-    return vertices;
-}
+        return result;
+    }
 
-void MeshBase::setVertex(size_t index, const Vertex& vertex)
-{
-    if (index >= vertices.size())
-        throw Exception("Mesh vertex index %zu out of range (mesh has %zu vertices)", index, vertices.size());
-    
-    vertices[index] = vertex;
-}
+    static PrimitiveType getPrimitiveType(MeshDrawMode mode)
+    {
+        switch (mode)
+        {
+            case MESHDRAWMODE_FAN:
+                return PRIMITIVE_TRIANGLE_FAN;
+            case MESHDRAWMODE_STRIP:
+                return PRIMITIVE_TRIANGLE_STRIP;
+            case MESHDRAWMODE_POINTS:
+                return PRIMITIVE_POINTS;
+            case MESHDRAWMODE_TRIANGLES:
+            default:
+                return PRIMITIVE_TRIANGLES;
+        }
+    }
 
-Vertex MeshBase::getVertex(size_t index) const
-{
-    if (index >= vertices.size())
-        throw Exception("Mesh vertex index %zu out of range (mesh has %zu vertices)", index, vertices.size());
-    
-    return vertices[index];
-}
+    /* queued draws may still reference a buffer that is about to be replaced */
+    static void submitPendingDraws()
+    {
+        auto* graphics = Module::getInstance<GraphicsBase>(Module::M_GRAPHICS);
 
-void MeshBase::setVertexMap(const std::vector<uint32_t>& map)
-{
-    vertexMap = map;
-}
+        if (graphics != nullptr)
+        {
+            graphics->flushBatchedDraws();
+            graphics->submitDeferredDraws();
+        }
+    }
 
-void MeshBase::setVertexMap()
-{
-    vertexMap.clear();
-}
+    MeshBase::MeshBase(const std::vector<XYf_STf_RGBAf>& vertices, DrawMode mode, BufferDataUsage usage) :
+        vertices(vertices),
+        packedVertices {},
+        vertexMap {},
+        vertexBuffer(nullptr),
+        indexBuffer(nullptr),
+        indexBuffer32(nullptr),
+        indexType(INDEX_UINT16),
+        modifiedVertices(),
+        vertexMapModified(false),
+        drawMode(mode),
+        usage(usage),
+        texture(nullptr),
+        hasDrawRange(false),
+        drawRangeStart(0),
+        drawRangeCount(0)
+    {
+        if (vertices.empty())
+            throw love::Exception("A Mesh must have at least one vertex.");
 
-const std::vector<uint32_t>& MeshBase::getVertexMap() const
-{
-    return vertexMap;
-}
+        this->createVertexBuffer();
+    }
 
-void MeshBase::setTexture(TextureBase* tex)
-{
-    if (texture)
-        texture->release();
-    
-    texture = tex;
-    
-    if (texture)
-        texture->retain();
-}
-
-TextureBase* MeshBase::getTexture() const
-{
-    return texture;
-}
+    MeshBase::MeshBase(int vertexCount, DrawMode mode, BufferDataUsage usage) :
+        MeshBase(std::vector<XYf_STf_RGBAf>(std::max(vertexCount, 0), XYf_STf_RGBAf { 0, 0, 0, 0, Color::WHITE }),
+                 mode, usage)
+    {}
 
-void MeshBase::setDrawMode(DrawMode mode)
-{
-    drawMode = mode;
-}
+    MeshBase::~MeshBase()
+    {}
 
-MeshBase::DrawMode MeshBase::getDrawMode() const
-{
-    return drawMode;
-}
+    void MeshBase::createVertexBuffer()
+    {
+        this->packedVertices.resize(this->vertices.size());
 
-void MeshBase::setDrawRange(int start, int count)
-{
-    if (start < 0 || count < 0)
-        throw Exception("Invalid draw range values");
-    
-    drawRangeStart = start;
-    drawRangeCount = count;
-    hasDrawRange = true;
-}
-
-void MeshBase::setDrawRange()
-{
-    hasDrawRange = false;
-    drawRangeStart = 0;
-    drawRangeCount = 0;
-}
+        for (size_t index = 0; index < this->vertices.size(); index++)
+            this->packedVertices[index] = packVertex(this->vertices[index]);
 
-bool MeshBase::getDrawRange(int& start, int& count) const
-{
-    if (hasDrawRange)
+        if (this->vertexBuffer.get() != nullptr)
+            submitPendingDraws();
+
+        auto* buffer = new DataBuffer<Vertex>(BUFFERUSAGE_VERTEX, this->usage, this->vertices.size());
+        this->vertexBuffer.set(buffer, Acquire::NO_RETAIN);
+
+        this->modifiedVertices = Range(0, this->vertices.size());
+
+        /* the index width depends on the vertex count */
+        if (!this->vertexMap.empty())
+            this->vertexMapModified = true;
+    }
+
+    void MeshBase::setVertices(const std::vector<XYf_STf_RGBAf>& vertices)
     {
-        start = drawRangeStart;
-        count = drawRangeCount;
+        if (vertices.empty())
+            throw love::Exception("A Mesh must have at least one vertex.");
+
+        if (vertices.size() != this->vertices.size())
+        {
+            /* a smaller mesh can't keep a map that points past its end */
+            for (uint32_t index : this->vertexMap)
+            {
+                if (index >= vertices.size())
+                    throw love::Exception("Invalid vertex map value: {:d} (the Mesh now has {:d} vertices).",
+                                          index + 1, vertices.size());
+            }
+
+            this->vertices = vertices;
+            this->createVertexBuffer();
+
+            return;
+        }
+
+        this->setVertices(vertices, 0);
+    }
+
+    void MeshBase::setVertices(const std::vector<XYf_STf_RGBAf>& vertices, size_t startVertex)
+    {
+        if (vertices.empty())
+            return;
+
+        if (startVertex + vertices.size() > this->vertices.size())
+            throw love::Exception("Too many vertices (expected at most {:d}, got {:d}).",
+                                  this->vertices.size() - std::min(startVertex, this->vertices.size()),
+                                  vertices.size());
+
+        for (size_t index = 0; index < vertices.size(); index++)
+        {
+            this->vertices[startVertex + index]       = vertices[index];
+            this->packedVertices[startVertex + index] = packVertex(vertices[index]);
+        }
+
+        this->modifiedVertices.encapsulate(startVertex, vertices.size());
+    }
+
+    const std::vector<XYf_STf_RGBAf>& MeshBase::getVertices() const
+    {
+        return this->vertices;
+    }
+
+    void MeshBase::setVertex(size_t index, const XYf_STf_RGBAf& vertex)
+    {
+        if (index >= this->vertices.size())
+            throw love::Exception("Invalid vertex index: {:d}.", index + 1);
+
+        this->vertices[index]       = vertex;
+        this->packedVertices[index] = packVertex(vertex);
+
+        this->modifiedVertices.encapsulate(index);
+    }
+
+    XYf_STf_RGBAf MeshBase::getVertex(size_t index) const
+    {
+        if (index >= this->vertices.size())
+            throw love::Exception("Invalid vertex index: {:d}.", index + 1);
+
+        return this->vertices[index];
+    }
+
+    void MeshBase::setVertexMap(const std::vector<uint32_t>& map)
+    {
+        for (uint32_t index : map)
+        {
+            if (index >= this->vertices.size())
+                throw love::Exception("Invalid vertex map value: {:d}.", index + 1);
+        }
+
+        this->vertexMap         = map;
+        this->vertexMapModified = true;
+    }
+
+    void MeshBase::setVertexMap()
+    {
+        this->vertexMap.clear();
+        this->vertexMapModified = false;
+    }
+
+    const std::vector<uint32_t>& MeshBase::getVertexMap() const
+    {
+        return this->vertexMap;
+    }
+
+    void MeshBase::setTexture(TextureBase* texture)
+    {
+        this->texture.set(texture);
+    }
+
+    TextureBase* MeshBase::getTexture() const
+    {
+        return this->texture.get();
+    }
+
+    void MeshBase::setDrawMode(DrawMode mode)
+    {
+        this->drawMode = mode;
+    }
+
+    MeshBase::DrawMode MeshBase::getDrawMode() const
+    {
+        return this->drawMode;
+    }
+
+    void MeshBase::setDrawRange(int start, int count)
+    {
+        if (start < 0 || count <= 0)
+            throw love::Exception("Invalid draw range.");
+
+        this->drawRangeStart = start;
+        this->drawRangeCount = count;
+        this->hasDrawRange   = true;
+    }
+
+    void MeshBase::setDrawRange()
+    {
+        this->hasDrawRange   = false;
+        this->drawRangeStart = 0;
+        this->drawRangeCount = 0;
+    }
+
+    bool MeshBase::getDrawRange(int& start, int& count) const
+    {
+        if (!this->hasDrawRange)
+            return false;
+
+        start = this->drawRangeStart;
+        count = this->drawRangeCount;
+
         return true;
     }
-    return false;
-}
 
-size_t MeshBase::getVertexCount() const
-{
-    return vertices.size();
-}
+    size_t MeshBase::getVertexCount() const
+    {
+        return this->vertices.size();
+    }
 
-bool MeshBase::getConstant(const char* in, DrawMode& out)
-{
-    for (int i = 0; i < MESHDRAWMODE_MAX_ENUM; i++)
+    void MeshBase::attachAttribute(const std::string& name, MeshBase* mesh, AttributeStep step)
     {
-        if (strcmp(drawModeNames[i], in) == 0)
+        BuiltinVertexAttribute attribute;
+        if (!getConstant(name.c_str(), attribute))
+            throw love::Exception("Unknown vertex attribute '{}'.", name);
+
+        if (step != STEP_PER_INSTANCE)
+            throw love::Exception("Only per-instance attributes can be attached to a Mesh.");
+
+        if (mesh == this)
+            throw love::Exception("A Mesh cannot attach its own attributes.");
+
+        /* the instance stream is a single vertex buffer binding */
+        for (const auto& attached : this->attachedAttributes)
         {
-            out = (DrawMode) i;
-            return true;
+            if (attached.attribute != attribute && attached.mesh.get() != mesh)
+                throw love::Exception("All attached attributes must come from the same Mesh.");
         }
+
+        for (auto& attached : this->attachedAttributes)
+        {
+            if (attached.attribute == attribute)
+            {
+                attached.mesh.set(mesh);
+                attached.step = step;
+
+                return;
+            }
+        }
+
+        this->attachedAttributes.push_back({ attribute, StrongRef<MeshBase>(mesh), step });
     }
-    return false;
-}
 
-bool MeshBase::getConstant(DrawMode in, const char*& out)
-{
-    if (in < 0 || in >= MESHDRAWMODE_MAX_ENUM)
+    bool MeshBase::detachAttribute(const std::string& name)
+    {
+        BuiltinVertexAttribute attribute;
+        if (!getConstant(name.c_str(), attribute))
+            throw love::Exception("Unknown vertex attribute '{}'.", name);
+
+        for (auto it = this->attachedAttributes.begin(); it != this->attachedAttributes.end(); ++it)
+        {
+            if (it->attribute == attribute)
+            {
+                this->attachedAttributes.erase(it);
+                return true;
+            }
+        }
+
         return false;
-    
-    out = drawModeNames[in];
-    return true;
-}
+    }
 
-std::vector<std::string> MeshBase::getConstants(DrawMode)
-{
-    std::vector<std::string> constants;
-    for (int i = 0; i < MESHDRAWMODE_MAX_ENUM; i++)
-        constants.push_back(std::string(drawModeNames[i]));
-    return constants;
-}
+    MeshBase* MeshBase::getInstanceMesh() const
+    {
+        if (this->attachedAttributes.empty())
+            return nullptr;
 
-void MeshBase::draw(GraphicsBase* graphics, const Matrix4& transform)
-{
-    // Basic stub implementation - should be overridden by platform-specific classes
-    // For now, just do nothing to prevent the class from being abstract
-    (void)graphics; // Suppress unused parameter warning
-    (void)transform; // Suppress unused parameter warning
-}
+        return this->attachedAttributes.front().mesh.get();
+    }
+
+    void MeshBase::flush()
+    {
+        if (this->modifiedVertices.isValid())
+        {
+            const size_t offset = this->modifiedVertices.getOffset();
+            const size_t size   = this->modifiedVertices.getSize();
+
+            this->vertexBuffer->upload(this->packedVertices.data(), this->packedVertices.size(), offset, size);
+            this->modifiedVertices.invalidate();
+        }
+
+        if (!this->vertexMapModified || this->vertexMap.empty())
+            return;
+
+        const size_t count = this->vertexMap.size();
+
+        if (this->vertices.size() > LOVE_UINT16_MAX)
+        {
+            if (this->indexBuffer32.get() == nullptr || this->indexBuffer32->getSize() < count)
+            {
+                if (this->indexBuffer32.get() != nullptr)
+                    submitPendingDraws();
+
+                auto* buffer = new DataBuffer<uint32_t>(BUFFERUSAGE_INDEX, this->usage, count);
+                this->indexBuffer32.set(buffer, Acquire::NO_RETAIN);
+            }
+
+            this->indexBuffer32->upload(this->vertexMap.data(), count, 0, count);
+            this->indexType = INDEX_UINT32;
+        }
+        else
+        {
+            if (this->indexBuffer.get() == nullptr || this->indexBuffer->getSize() < count)
+            {
+                if (this->indexBuffer.get() != nullptr)
+                    submitPendingDraws();
+
+                auto* buffer = new DataBuffer<uint16_t>(BUFFERUSAGE_INDEX, this->usage, count);
+                this->indexBuffer.set(buffer, Acquire::NO_RETAIN);
+            }
+
+            std::vector<uint16_t> indices(this->vertexMap.begin(), this->vertexMap.end());
+
+            this->indexBuffer->upload(indices.data(), count, 0, count);
+            this->indexType = INDEX_UINT16;
+        }
+
+        this->vertexMapModified = false;
+    }
+
+    void MeshBase::draw(GraphicsBase* graphics, const Matrix4& matrix)
+    {
+        this->drawInternal(graphics, matrix, 1);
+    }
+
+    void MeshBase::drawInstanced(GraphicsBase* graphics, const Matrix4& matrix, int instanceCount)
+    {
+        if (instanceCount <= 0)
+            throw love::Exception("Invalid instance count: {:d}.", instanceCount);
+
+        MeshBase* instanceMesh = this->getInstanceMesh();
+
+        if (instanceMesh != nullptr && (size_t)instanceCount > instanceMesh->getVertexCount())
+            throw love::Exception("Instance count ({:d}) exceeds the vertex count of the attached Mesh ({:d}).",
+                                  instanceCount, instanceMesh->getVertexCount());
+
+        this->drawInternal(graphics, matrix, instanceCount);
+    }
+
+    void MeshBase::drawInternal(GraphicsBase* graphics, const Matrix4& matrix, int instanceCount)
+    {
+        const bool indexed = !this->vertexMap.empty();
+        const int total    = (int)(indexed ? this->vertexMap.size() : this->vertices.size());
+
+        int start = 0;
+        int count = total;
+
+        if (this->hasDrawRange)
+        {
+            start = std::min(this->drawRangeStart, total);
+            count = std::min(this->drawRangeCount, total - start);
+        }
+
+        if (count <= 0)
+            return;
+
+        /* keep the order with anything batched before this */
+        graphics->flushBatchedDraws();
+
+        this->flush();
+
+        if (ShaderBase::isDefaultActive())
+        {
+            auto type = this->texture ? ShaderBase::STANDARD_TEXTURE : ShaderBase::STANDARD_DEFAULT;
+            ShaderBase::attachDefault(type);
+        }
+
+        Matrix4 transform(graphics->getTransform(), matrix);
+
+        VertexAttributes attributes {};
+        attributes.setCommonFormat(CommonFormat::XYf_STf_RGBAub, (uint8_t)0);
+
+        BufferBindings buffers {};
+        buffers.set(0, this->vertexBuffer, 0, (int)this->vertices.size());
+
+        MeshBase* instanceMesh = this->getInstanceMesh();
+
+        if (instanceMesh != nullptr)
+        {
+            instanceMesh->flush();
+            buffers.set(1, instanceMesh->vertexBuffer, 0, (int)instanceMesh->getVertexCount());
+        }
+
+        if (indexed)
+        {
+            Resource* indices = this->indexBuffer.get();
+
+            if (this->indexType == INDEX_UINT32)
+                indices = this->indexBuffer32.get();
+
+            DrawIndexedCommand command(&attributes, &buffers, indices);
+            command.primitiveType     = getPrimitiveType(this->drawMode);
+            command.indexCount        = count;
+            command.indexType         = this->indexType;
+            command.indexBufferOffset = start;
+            command.instanceCount     = instanceCount;
+            command.texture           = this->texture;
+            command.cullMode          = graphics->getMeshCullMode();
+            command.transform         = &transform;
+
+            graphics->draw(command);
+
+            if (this->indexType == INDEX_UINT32)
+                this->indexBuffer32->markUsed();
+            else
+                this->indexBuffer->markUsed();
+        }
+        else
+        {
+            DrawCommand command(&buffers);
+            command.primitiveType = getPrimitiveType(this->drawMode);
+            command.vertexStart   = start;
+            command.vertexCount   = count;
+            command.instanceCount = instanceCount;
+            command.texture       = this->texture;
+            command.cullMode      = graphics->getMeshCullMode();
+            command.transform     = &transform;
+
+            graphics->draw(command);
+        }
+
+        this->vertexBuffer->markUsed();
+
+        if (instanceMesh != nullptr)
+            instanceMesh->vertexBuffer->markUsed();
+    }
+
+    bool MeshBase::getConstant(const char* in, DrawMode& out)
+    {
+        for (int index = 0; index < MESHDRAWMODE_MAX_ENUM; index++)
+        {
+            if (std::strcmp(drawModeNames[index], in) == 0)
+            {
+                out = (DrawMode)index;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool MeshBase::getConstant(DrawMode in, const char*& out)
+    {
+        if (in < 0 || in >= MESHDRAWMODE_MAX_ENUM)
+            return false;
+
+        out = drawModeNames[in];
+        return true;
+    }
+
+    std::vector<std::string> MeshBase::getConstants(DrawMode)
+    {
+        return std::vector<std::string>(std::begin(drawModeNames), std::end(drawModeNames));
+    }
+} // namespace love
@@ -421,26 +421,28 @@ namespace love
             const Vector2* verts = vertices + vertex_start;
 
             BatchedDrawCommand cmd {};
-            cmd.format      = CommonFormat::XYf_STf_RGBAf;
+            cmd.format      = CommonFormat::XYf_STf_RGBAub;
             cmd.indexMode   = triangle_mode;
             cmd.vertexCount = std::min(maxvertices, total_vertex_count - vertex_start);
 
             BatchedVertexData data = gfx->requestBatchedDraw(cmd);
 
             if (is2D)
-                t.transformXY((XYf_STf_RGBAf*)data.stream, verts, cmd.vertexCount);
+                t.transformXY((Vertex*)data.stream, verts, cmd.vertexCount);
 
-            XYf_STf_RGBAf* attributes = (XYf_STf_RGBAf*)data.stream;
-            int draw_rough_count      = std::min(cmd.vertexCount, (int)vertex_count - vertex_start);
+            Vertex* attributes   = (Vertex*)data.stream;
+            int draw_rough_count = std::min(cmd.vertexCount, (int)vertex_count - vertex_start);
 
             // Constant vertex color up to the overdraw vertices.
             // Texture coordinates are a constant value, we only have them to keep auto-batching
             // when drawing filled and line polygons together.
+            Color32 packedcolor = curcolor;
+
             for (int i = 0; i < draw_rough_count; i++)
             {
-                attributes[i].s     = 0.0f;
-                attributes[i].t     = 0.0f;
-                attributes[i].color = curcolor;
+                attributes[i].s     = 0;
+                attributes[i].t     = 0;
+                attributes[i].color = packedcolor;
             }
 
             if (overdraw)
@@ -457,14 +459,14 @@ namespace love
 
                 if (draw_overdraw_count > 0)
                 {
-                    XYf_STf_RGBAf* c = attributes + draw_overdraw_begin;
-                    fill_color_array(curcolor, c, draw_overdraw_count);
+                    Vertex* c = attributes + draw_overdraw_begin;
+                    fill_color_array(packedcolor, c, draw_overdraw_count);
                 }
             }
         }
     }
 
-    void Polyline::fill_color_array(Color constant_color, XYf_STf_RGBAf* attributes, int count)
+    void Polyline::fill_color_array(Color32 constant_color, Vertex* attributes, int count)
     {
         // Note: assigning each element individually seems to be needed to avoid
         // performance issues in OpenGL + Windows. VS' compiler is likely doing
@@ -473,8 +475,8 @@ namespace love
         // when using memcpy.
         for (int i = 0; i < count; ++i)
         {
-            attributes[i].s       = 0.0f;
-            attributes[i].t       = 0.0f;
+            attributes[i].s       = 0;
+            attributes[i].t       = 0;
             attributes[i].color.r = constant_color.r;
             attributes[i].color.g = constant_color.g;
             attributes[i].color.b = constant_color.b;
@@ -482,12 +484,12 @@ namespace love
         }
     }
 
-    void NoneJoinPolyline::fill_color_array(Color constant_color, XYf_STf_RGBAf* attributes, int count)
+    void NoneJoinPolyline::fill_color_array(Color32 constant_color, Vertex* attributes, int count)
     {
         for (int i = 0; i < count; ++i)
         {
-            attributes[i].s       = 0.0f;
-            attributes[i].t       = 0.0f;
+            attributes[i].s       = 0;
+            attributes[i].t       = 0;
             attributes[i].color.r = constant_color.r;
             attributes[i].color.g = constant_color.g;
             attributes[i].color.b = constant_color.b;
@@ -1,7 +1,12 @@
 #include "common/Exception.hpp"
+#include "common/Logger.hpp"
 
+#include "modules/graphics/Graphics.tcc"
 #include "modules/graphics/Shader.tcc"
 
+#include <algorithm>
+#include <cstring>
+
 namespace love
 {
     Type ShaderBase::type("Shader", &Object::type);
@@ -12,6 +17,9 @@ namespace love
     int ShaderBase::shaderSwitches = 0;
 
     ShaderBase::ShaderBase(StrongRef<ShaderStageBase> _stages[], const CompileOptions& options) :
+        builtinUniformInfo {},
+        uniformStaging {},
+        uniformsDirty(false),
         stages(),
         debugName(options.debugName)
     {
@@ -38,36 +46,13 @@ namespace love
 
     void ShaderBase::attachDefault(StandardShader type)
     {
-#ifdef __WIIU__
-        static int attachDefaultCount = 0;
-        attachDefaultCount++;
-        
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            const char* typeName = "unknown";
-            switch(type) {
-                case STANDARD_DEFAULT: typeName = "STANDARD_DEFAULT"; break;
-                case STANDARD_TEXTURE: typeName = "STANDARD_TEXTURE"; break;
-                case STANDARD_VIDEO: typeName = "STANDARD_VIDEO"; break;
-            }
-            fprintf(logFile, "ShaderBase::attachDefault() #%d: type=%s\n", attachDefaultCount, typeName);
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
+        LOVE_LOG_TRACE(SHADER, "attachDefault() type=%d", (int)type);
 
         auto* defaultShader = standardShaders[type];
 
         if (defaultShader == nullptr)
         {
-#ifdef __WIIU__
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "  WARNING: standardShaders[%d] is NULL, shaders not ready yet\n", type);
-                fflush(logFile);
-                fclose(logFile);
-            }
-#endif
+            LOVE_LOG_SAMPLED(WARN, SHADER, 1, 600, "attachDefault() standard shader %d is not loaded yet", (int)type);
             // Don't set current to nullptr, just return early
             // Shaders will be attached when they're ready
             return;
@@ -75,26 +60,8 @@ namespace love
 
         if (current != defaultShader)
         {
-#ifdef __WIIU__
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "  Calling attach() on shader %p\n", defaultShader);
-                fflush(logFile);
-                fclose(logFile);
-            }
-#endif
             defaultShader->attach();
         }
-#ifdef __WIIU__
-        else {
-            FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile) {
-                fprintf(logFile, "  Shader already current, no switch needed\n");
-                fflush(logFile);
-                fclose(logFile);
-            }
-        }
-#endif
     }
 
     const ShaderBase::UniformInfo* ShaderBase::getUniformInfo(const std::string& name) const
@@ -103,12 +70,86 @@ namespace love
         return it != this->reflection.uniforms.end() ? it->second : nullptr;
     }
 
+    void ShaderBase::mapBuiltinUniforms()
+    {
+        for (int index = 0; index < BUILTIN_MAX_ENUM; index++)
+        {
+            std::string_view name {};
+            UniformInfo* info = nullptr;
+
+            if (getConstant((BuiltinUniform)index, name))
+            {
+                const auto it = this->reflection.uniforms.find(std::string(name));
+
+                if (it != this->reflection.uniforms.end())
+                    info = it->second;
+            }
+
+            this->builtinUniformInfo[index] = info;
+        }
+    }
+
     bool ShaderBase::hasUniform(const std::string& name) const
     {
         const auto it = this->reflection.uniforms.find(name);
         return it != this->reflection.uniforms.end() && it->second->active;
     }
 
+    bool ShaderBase::sendUniform(const UniformInfo* info, const void* values, int count)
+    {
+        if (info->components == 0)
+            return false;
+
+        count = std::min(count, info->count);
+
+        const auto* source      = (const uint8_t*)values;
+        const size_t columnSize = info->components * sizeof(uint32_t);
+
+        const auto forEachColumn = [&](const auto& callback) {
+            for (int stage = 0; stage < SHADERSTAGE_MAX_ENUM; stage++)
+            {
+                if ((info->stageMask & (1u << stage)) == 0)
+                    continue;
+
+                for (int element = 0; element < count; element++)
+                {
+                    for (int column = 0; column < info->columns; column++)
+                    {
+                        const size_t offset = info->offset[stage] + element * info->stride +
+                                              column * info->columnStride;
+                        const size_t index  = element * info->columns + column;
+
+                        if (offset + columnSize > this->uniformStaging.size())
+                            continue;
+
+                        if (!callback(this->uniformStaging.data() + offset, source + index * columnSize))
+                            return false;
+                    }
+                }
+            }
+
+            return true;
+        };
+
+        const bool unchanged = forEachColumn([columnSize](const uint8_t* staged, const uint8_t* value) {
+            return std::memcmp(staged, value, columnSize) == 0;
+        });
+
+        if (unchanged)
+            return false;
+
+        if (current == this)
+            GraphicsBase::flushBatchedDrawsGlobal();
+
+        forEachColumn([columnSize](uint8_t* staged, const uint8_t* value) {
+            std::memcpy(staged, value, columnSize);
+            return true;
+        });
+
+        this->uniformsDirty = true;
+        return true;
+    }
+
     bool ShaderBase::isDefaultActive()
     {
         for (int index = 0; index < STANDARD_MAX_ENUM; index++)
@@ -0,0 +1,162 @@
+#include "common/Logger.hpp"
+
+#include "modules/graphics/ShaderPreloader.hpp"
+
+#include <cstdio>
+
+namespace love
+{
+    ShaderPreloader::ShaderPreloader() :
+        entries {},
+        pending {},
+        working(false),
+        stopping(false)
+    {
+        this->threadName = "ShaderPreloader";
+    }
+
+    ShaderPreloader::~ShaderPreloader()
+    {
+        this->stop();
+    }
+
+    bool ShaderPreloader::readFile(const std::string& filepath, std::vector<uint8_t>& code)
+    {
+        std::FILE* file = std::fopen(filepath.c_str(), "rb");
+
+        if (file == nullptr)
+            return false;
+
+        std::fseek(file, 0, SEEK_END);
+        const long size = std::ftell(file);
+        std::rewind(file);
+
+        bool success = size > 0;
+
+        if (success)
+        {
+            code.resize(size);
+            success = std::fread(code.data(), size, 1, file) == 1;
+        }
+
+        std::fclose(file);
+        return success;
+    }
+
+    void ShaderPreloader::run()
+    {
+        std::unique_lock lock(this->mutex);
+
+        while (!this->pending.empty() && !this->stopping)
+        {
+            const std::string filepath = std::move(this->pending.front());
+            this->pending.pop_front();
+
+            lock.unlock();
+
+            std::vector<uint8_t> code {};
+            const bool success = readFile(filepath, code);
+
+            lock.lock();
+
+            auto it = this->entries.find(filepath);
+
+            /* cleared while it was being read */
+            if (it == this->entries.end())
+                continue;
+
+            it->second.state = success ? ENTRY_LOADED : ENTRY_FAILED;
+            it->second.code  = std::move(code);
+
+            if (!success)
+                LOVE_LOG_WARN(SHADER, "could not preload shader stage %s", filepath.c_str());
+
+            this->loaded.notify_all();
+        }
+
+        this->working = false;
+        this->loaded.notify_all();
+    }
+
+    void ShaderPreloader::enqueue(const std::vector<std::string>& filepaths)
+    {
+        std::unique_lock lock(this->mutex);
+
+        if (this->stopping)
+            return;
+
+        for (const auto& filepath : filepaths)
+        {
+            auto it = this->entries.find(filepath);
+
+            if (it != this->entries.end())
+            {
+                it->second.takes++;
+                continue;
+            }
+
+            this->entries[filepath] = { ENTRY_PENDING, 1, {} };
+            this->pending.push_back(filepath);
+        }
+
+        if (this->working || this->pending.empty())
+            return;
+
+        this->working = true;
+
+        /* the last run may have returned without its thread being marked as finished yet */
+        if (!Threadable::start())
+        {
+            Threadable::wait();
+
+            if (!Threadable::start())
+                this->working = false;
+        }
+    }
+
+    bool ShaderPreloader::take(const std::string& filepath, std::vector<uint8_t>& code)
+    {
+        std::unique_lock lock(this->mutex);
+
+        auto it = this->entries.find(filepath);
+
+        if (it == this->entries.end())
+            return false;
+
+        this->loaded.wait(lock, [&]() { return it->second.state != ENTRY_PENDING || !this->working; });
+
+        const bool success = it->second.state == ENTRY_LOADED;
+
+        if (--it->second.takes > 0)
+        {
+            if (success)
+                code = it->second.code;
+
+            return success;
+        }
+
+        if (success)
+            code = std::move(it->second.code);
+
+        this->entries.erase(it);
+        return success;
+    }
+
+    void ShaderPreloader::clear()
+    {
+        std::unique_lock lock(this->mutex);
+
+        this->pending.clear();
+        this->entries.clear();
+    }
+
+    void ShaderPreloader::stop()
+    {
+        {
+            std::unique_lock lock(this->mutex);
+            this->stopping = true;
+        }
+
+        Threadable::wait();
+    }
+} // namespace love
@@ -7,6 +7,7 @@
 #include "modules/graphics/Texture.tcc"
 
 #include <algorithm>
+#include <limits>
 
 #include <stddef.h>
 
@@ -21,10 +22,17 @@ namespace love
         size(size),
         next(0),
         color(1.0f, 1.0f, 1.0f, 1.0f),
-        buffer {},
+        usage(usage),
         modifiedSprites(),
+        buffer {},
+        vertexBuffer(nullptr),
         rangeStart(-1),
-        rangeCount(-1)
+        rangeCount(-1),
+        boundsMin(std::numeric_limits<float>::max(), std::numeric_limits<float>::max()),
+        boundsMax(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()),
+        spatialIndex(false),
+        grid(),
+        visibleRuns {}
     {
         if (size <= 0)
             throw love::Exception(E_INVALID_SPRITEBATCH_SIZE, size);
@@ -35,12 +43,14 @@ namespace love
         if (texture->getTextureType() == TEXTURE_2D_ARRAY)
             this->vertexFormat = CommonFormat::XYf_STPf_RGBAf;
         else
-            this->vertexFormat = CommonFormat::XYf_STf_RGBAf;
+            this->vertexFormat = CommonFormat::XYf_STf_RGBAub;
 
         this->vertexStride = 1;
         size_t vertexSize  = this->vertexStride * 4 * size;
 
         this->buffer.resize(vertexSize);
+        this->vertexBuffer.set(new DataBuffer<Vertex>(BUFFERUSAGE_VERTEX, usage, vertexSize),
+                               Acquire::NO_RETAIN);
     }
 
     SpriteBatch::~SpriteBatch()
@@ -75,15 +85,25 @@ namespace love
 
         matrix.transformXY(buffer, positions, 4);
 
+        Color32 color = this->color;
+
         for (int i = 0; i < 4; i++)
         {
             buffer[i].s     = texCoords[i].x;
             buffer[i].t     = texCoords[i].y;
-            buffer[i].color = this->color;
+            buffer[i].color = color;
+
+            this->boundsMin.x = std::min(this->boundsMin.x, buffer[i].x);
+            this->boundsMin.y = std::min(this->boundsMin.y, buffer[i].y);
+            this->boundsMax.x = std::max(this->boundsMax.x, buffer[i].x);
+            this->boundsMax.y = std::max(this->boundsMax.y, buffer[i].y);
         }
 
         this->modifiedSprites.encapsulate(spriteIndex);
 
+        if (this->spatialIndex)
+            this->insertSprite(spriteIndex);
+
         if (index == -1)
             return this->next++;
 
@@ -103,6 +123,44 @@ namespace love
     void SpriteBatch::clear()
     {
         this->next = 0;
+
+        this->boundsMin = Vector2(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+        this->boundsMax = Vector2(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+
+        this->grid.clear();
+    }
+
+    void SpriteBatch::insertSprite(int index)
+    {
+        const auto* vertices = &this->buffer[index * this->vertexStride * 4];
+
+        Vector2 min(vertices[0].x, vertices[0].y);
+        Vector2 max = min;
+
+        for (int i = 1; i < 4; i++)
+        {
+            min.x = std::min(min.x, vertices[i].x);
+            min.y = std::min(min.y, vertices[i].y);
+            max.x = std::max(max.x, vertices[i].x);
+            max.y = std::max(max.y, vertices[i].y);
+        }
+
+        this->grid.insert(index, min, max);
+    }
+
+    void SpriteBatch::setSpatialIndexEnabled(bool enabled)
+    {
+        if (enabled == this->spatialIndex)
+            return;
+
+        this->spatialIndex = enabled;
+        this->grid.clear();
+
+        if (!enabled)
+            return;
+
+        for (int index = 0; index < this->next; index++)
+            this->insertSprite(index);
     }
 
     void SpriteBatch::flush()
@@ -112,7 +170,10 @@ namespace love
             size_t offset = this->modifiedSprites.getOffset() * this->vertexStride * 4;
             size_t size   = this->modifiedSprites.getSize() * this->vertexStride * 4;
 
-            // fill the buffer at offset
+            /* sprites may be set past the end with an explicit index */
+            const size_t sprites = std::max<size_t>(this->next, this->modifiedSprites.getMax() + 1);
+            const size_t used    = sprites * this->vertexStride * 4;
+            this->vertexBuffer->upload(this->buffer.data(), used, offset, size);
 
             this->modifiedSprites.invalidate();
         }
@@ -156,9 +217,23 @@ namespace love
 
         size_t vertexSize = this->vertexStride * 4 * newSize;
 
+        /* queued draws may still reference the old buffer */
+        GraphicsBase::flushBatchedDrawsGlobal();
+
+        auto* graphics = Module::getInstance<GraphicsBase>(Module::M_GRAPHICS);
+        if (graphics != nullptr)
+            graphics->submitDeferredDraws();
+
         this->buffer.resize(vertexSize);
+        this->vertexBuffer.set(new DataBuffer<Vertex>(BUFFERUSAGE_VERTEX, this->usage, vertexSize),
+                               Acquire::NO_RETAIN);
+
         this->size = newSize;
         this->next = std::min(this->next, newSize);
+
+        /* the new buffer starts out empty */
+        if (this->next > 0)
+            this->modifiedSprites = Range(0, this->next);
     }
 
     int SpriteBatch::getBufferSize() const
@@ -191,6 +266,34 @@ namespace love
         return true;
     }
 
+    bool SpriteBatch::queryVisibleRuns(GraphicsBase* graphics, const Matrix4& transform, int start, int count)
+    {
+        if (!transform.isAffine2DTransform() || !ShaderBase::isDefaultActive())
+            return false;
+
+        const Rect area = graphics->getVisibleArea();
+
+        const Vector2 corners[4] = { Vector2(area.x, area.y), Vector2(area.x + area.w, area.y),
+                                     Vector2(area.x + area.w, area.y + area.h),
+                                     Vector2(area.x, area.y + area.h) };
+
+        Vector2 local[4];
+        transform.inverse().transformXY(local, corners, 4);
+
+        Vector2 min = local[0];
+        Vector2 max = local[0];
+
+        for (int i = 1; i < 4; i++)
+        {
+            min.x = std::min(min.x, local[i].x);
+            min.y = std::min(min.y, local[i].y);
+            max.x = std::max(max.x, local[i].x);
+            max.y = std::max(max.y, local[i].y);
+        }
+
+        return this->grid.query(min, max, start, count, this->visibleRuns);
+    }
+
     static constexpr ShaderBase::StandardShader SHADER_TYPE =
         (Console::is(Console::CTR)) ? ShaderBase::STANDARD_DEFAULT : ShaderBase::STANDARD_TEXTURE;
 
@@ -199,8 +302,6 @@ namespace love
         if (this->next == 0)
             return;
 
-        GraphicsBase::TempTransform transform(graphics, matrix);
-
         int start = std::min(std::max(0, this->rangeStart), this->next - 1);
         int count = this->next;
 
@@ -212,17 +313,55 @@ namespace love
         if (count <= 0)
             return;
 
-        BatchedDrawCommand command {};
-        command.format        = CommonFormat::XYf_STf_RGBAf;
-        command.indexMode     = TRIANGLEINDEX_QUADS;
-        command.texture       = this->texture;
-        command.vertexCount   = count * 4;
-        command.pushTransform = false;
-        command.shaderType    = SHADER_TYPE;
+        Matrix4 transform(graphics->getTransform(), matrix);
+
+        if (graphics->isCulled(transform, this->boundsMin, this->boundsMax))
+            return;
+
+        if (!this->spatialIndex || !this->queryVisibleRuns(graphics, transform, start, count))
+            this->visibleRuns.assign(1, { start, count });
+
+        if (this->visibleRuns.empty())
+            return;
+
+        /* keep the order with anything batched before this */
+        graphics->flushBatchedDraws();
 
-        auto data = graphics->requestBatchedDraw(command);
+        this->flush();
+
+        if (ShaderBase::isDefaultActive())
+            ShaderBase::attachDefault(SHADER_TYPE);
+
+        VertexAttributes attributes {};
+        attributes.setCommonFormat(CommonFormat::XYf_STf_RGBAub, (uint8_t)0);
+
+        BufferBindings buffers {};
+        buffers.set(0, this->vertexBuffer, 0, this->next * 4);
+
+        for (auto run : this->visibleRuns)
+        {
+            /* the static quad indices address QUAD_INDEX_BUFFER_QUADS sprites per draw */
+            while (run.count > 0)
+            {
+                const int quads = std::min(run.count, QUAD_INDEX_BUFFER_QUADS);
+
+                DrawIndexedCommand command(&attributes, &buffers, graphics->getQuadIndexBuffer());
+                command.primitiveType     = PRIMITIVE_TRIANGLES;
+                command.indexCount        = getIndexCount(TRIANGLEINDEX_QUADS, quads * 4);
+                command.indexType         = INDEX_UINT16;
+                command.indexBufferOffset = 0;
+                command.baseVertex        = run.start * 4;
+                command.quadIndices       = true;
+                command.texture           = this->texture;
+                command.transform         = &transform;
+
+                graphics->draw(command);
+
+                run.start += quads;
+                run.count -= quads;
+            }
+        }
 
-        Vertex* stream = (Vertex*)data.stream;
-        std::copy_n(this->buffer.data() + start, command.vertexCount, stream);
+        this->vertexBuffer->markUsed();
     }
 } // namespace love
@@ -0,0 +1,210 @@
+#include "modules/graphics/SpriteGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace love
+{
+    /* keeps cell coordinates well inside int range */
+    static constexpr float MAX_CELL_COORDINATE = float(1 << 24);
+
+    SpriteGrid::SpriteGrid() :
+        cellSize(0.0f),
+        cells {},
+        large {},
+        ranges {},
+        placements {},
+        occupied { 0, 0, -1, -1 },
+        found {}
+    {}
+
+    int SpriteGrid::getCell(float position) const
+    {
+        float cell = std::floor(position / this->cellSize);
+        return (int)std::clamp(cell, -MAX_CELL_COORDINATE, MAX_CELL_COORDINATE);
+    }
+
+    bool SpriteGrid::getCells(const Vector2& min, const Vector2& max, CellRange& range) const
+    {
+        if (!std::isfinite(min.x) || !std::isfinite(min.y) || !std::isfinite(max.x) || !std::isfinite(max.y))
+            return false;
+
+        range.x1 = this->getCell(min.x);
+        range.y1 = this->getCell(min.y);
+        range.x2 = this->getCell(max.x);
+        range.y2 = this->getCell(max.y);
+
+        return range.isValid();
+    }
+
+    void SpriteGrid::erase(std::vector<int>& sprites, int sprite)
+    {
+        auto it = std::find(sprites.begin(), sprites.end(), sprite);
+
+        if (it == sprites.end())
+            return;
+
+        *it = sprites.back();
+        sprites.pop_back();
+    }
+
+    void SpriteGrid::insert(int sprite, const Vector2& min, const Vector2& max)
+    {
+        if (sprite < 0)
+            return;
+
+        this->remove(sprite);
+
+        if ((size_t)sprite >= this->placements.size())
+        {
+            this->placements.resize(sprite + 1, PLACEMENT_NONE);
+            this->ranges.resize(sprite + 1);
+        }
+
+        if (this->cellSize <= 0.0f)
+        {
+            float size = std::max(max.x - min.x, max.y - min.y) * CELL_SPRITES;
+            this->cellSize = (std::isfinite(size) && size > 0.0f) ? size : DEFAULT_CELL_SIZE;
+        }
+
+        CellRange range {};
+
+        if (!this->getCells(min, max, range) || range.getCellCount() > MAX_CELLS)
+        {
+            this->large.push_back(sprite);
+            this->placements[sprite] = PLACEMENT_LARGE;
+            return;
+        }
+
+        for (int y = range.y1; y <= range.y2; y++)
+        {
+            for (int x = range.x1; x <= range.x2; x++)
+                this->cells[getKey(x, y)].push_back(sprite);
+        }
+
+        if (this->occupied.isValid())
+        {
+            this->occupied.x1 = std::min(this->occupied.x1, range.x1);
+            this->occupied.y1 = std::min(this->occupied.y1, range.y1);
+            this->occupied.x2 = std::max(this->occupied.x2, range.x2);
+            this->occupied.y2 = std::max(this->occupied.y2, range.y2);
+        }
+        else
+            this->occupied = range;
+
+        this->ranges[sprite]     = range;
+        this->placements[sprite] = PLACEMENT_CELLS;
+    }
+
+    void SpriteGrid::remove(int sprite)
+    {
+        if (sprite < 0 || (size_t)sprite >= this->placements.size())
+            return;
+
+        if (this->placements[sprite] == PLACEMENT_LARGE)
+            erase(this->large, sprite);
+        else if (this->placements[sprite] == PLACEMENT_CELLS)
+        {
+            const auto& range = this->ranges[sprite];
+
+            for (int y = range.y1; y <= range.y2; y++)
+            {
+                for (int x = range.x1; x <= range.x2; x++)
+                {
+                    auto it = this->cells.find(getKey(x, y));
+
+                    if (it == this->cells.end())
+                        continue;
+
+                    erase(it->second, sprite);
+
+                    if (it->second.empty())
+                        this->cells.erase(it);
+                }
+            }
+        }
+
+        this->placements[sprite] = PLACEMENT_NONE;
+    }
+
+    void SpriteGrid::clear()
+    {
+        this->cellSize = 0.0f;
+
+        this->cells.clear();
+        this->large.clear();
+        this->ranges.clear();
+        this->placements.clear();
+
+        this->occupied = { 0, 0, -1, -1 };
+    }
+
+    bool SpriteGrid::query(const Vector2& min, const Vector2& max, int start, int count,
+                           std::vector<Run>& runs)
+    {
+        runs.clear();
+
+        if (this->cellSize <= 0.0f)
+            return false;
+
+        CellRange range {};
+        if (!this->getCells(min, max, range))
+            return false;
+
+        range.x1 = std::max(range.x1, this->occupied.x1);
+        range.y1 = std::max(range.y1, this->occupied.y1);
+        range.x2 = std::min(range.x2, this->occupied.x2);
+        range.y2 = std::min(range.y2, this->occupied.y2);
+
+        if (range.isValid() && range.getCellCount() > MAX_CELLS)
+            return false;
+
+        const int end = start + count;
+        this->found.clear();
+
+        const auto collect = [&](const std::vector<int>& sprites) {
+            for (int sprite : sprites)
+            {
+                if (sprite >= start && sprite < end)
+                    this->found.push_back(sprite);
+            }
+        };
+
+        collect(this->large);
+
+        if (range.isValid())
+        {
+            for (int y = range.y1; y <= range.y2; y++)
+            {
+                for (int x = range.x1; x <= range.x2; x++)
+                {
+                    auto it = this->cells.find(getKey(x, y));
+
+                    if (it != this->cells.end())
+                        collect(it->second);
+                }
+            }
+        }
+
+        std::sort(this->found.begin(), this->found.end());
+        this->found.erase(std::unique(this->found.begin(), this->found.end()), this->found.end());
+
+        for (int sprite : this->found)
+        {
+            if (!runs.empty())
+            {
+                auto& last = runs.back();
+
+                if (sprite - (last.start + last.count) <= MERGE_GAP)
+                {
+                    last.count = sprite - last.start + 1;
+                    continue;
+                }
+            }
+
+            runs.push_back({ sprite, 1 });
+        }
+
+        return true;
+    }
+} // namespace love
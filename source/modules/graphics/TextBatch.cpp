@@ -11,7 +11,7 @@ namespace love
 
     TextBatch::TextBatch(FontBase* font, const std::vector<ColoredString>& text) :
         font(font),
-        vertexAttributes(CommonFormat::XYf_STf_RGBAf, 0),
+        vertexAttributes(CommonFormat::XYf_STf_RGBAub, 0),
         buffer {},
         modifiedVertices(),
         vertexOffset(0),
@@ -226,7 +226,7 @@ namespace love
         for (const FontBase::DrawCommand& cmd : this->drawCommands)
         {
             BatchedDrawCommand command {};
-            command.format        = CommonFormat::XYf_STf_RGBAf;
+            command.format        = CommonFormat::XYf_STf_RGBAub;
             command.indexMode     = TRIANGLEINDEX_QUADS;
             command.vertexCount   = cmd.vertexCount;
             command.texture       = cmd.texture;
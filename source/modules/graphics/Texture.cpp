@@ -190,7 +190,8 @@ namespace love
         graphicsMemorySize(0),
         debugName(settings.debugName),
         rootView { this, 0, 0 },
-        parentView { this, 0, 0 }
+        parentView { this, 0, 0 },
+        atlasRegion {}
     {
         const auto& capabilities = graphics->getCapabilities();
         int requestedMipmapCount = settings.mipmapCount;
@@ -342,6 +343,14 @@ namespace love
 
     TextureBase::~TextureBase()
     {
+        if (this->atlasRegion.page != nullptr)
+        {
+            auto* graphics = Module::getInstance<GraphicsBase>(Module::M_GRAPHICS);
+
+            if (graphics != nullptr)
+                graphics->getTextureAtlas().remove(this);
+        }
+
         this->setGraphicsMemorySize(0);
 
         if (this == rootView.texture)
@@ -382,18 +391,40 @@ namespace love
         const auto& transform = graphics->getTransform();
         bool is2D             = transform.isAffine2DTransform();
 
+        const auto* texCoords = quad->getTextureCoordinates();
+
+        /*
+        ** Packed textures draw from their atlas page unless their sampler has
+        ** changed since. Coordinates outside [0, 1] would sample the neighbours
+        ** in the page instead of clamping, so those draw from the texture itself.
+        */
+        const auto& region = this->atlasRegion;
+        bool packed        = region.page != nullptr;
+
+        if (packed)
+            packed = region.page->getSamplerState().toKey() == this->samplerState.toKey();
+
+        for (int index = 0; packed && index < 4; index++)
+        {
+            const auto& texCoord = texCoords[index];
+            packed = texCoord.x >= 0.0f && texCoord.x <= 1.0f && texCoord.y >= 0.0f && texCoord.y <= 1.0f;
+        }
+
+        Matrix4 translated(transform, matrix);
+
+        if (graphics->isCulled(translated, quad->getVertexPositions(), 4))
+            return;
+
         BatchedDrawCommand command {};
-        command.format      = CommonFormat::XYf_STf_RGBAf;
+        command.format      = CommonFormat::XYf_STf_RGBAub;
         command.indexMode   = TRIANGLEINDEX_QUADS;
         command.vertexCount = 4;
-        command.texture     = this;
+        command.texture     = packed ? region.page : this;
         command.shaderType  = shader;
 
         BatchedVertexData data = graphics->requestBatchedDraw(command);
 
-        Matrix4 translated(transform, matrix);
-
-        XYf_STf_RGBAf* stream = (XYf_STf_RGBAf*)data.stream;
+        Vertex* stream = (Vertex*)data.stream;
 
         if (is2D)
             translated.transformXY(stream, quad->getVertexPositions(), 4);
@@ -401,13 +432,15 @@ namespace love
         if constexpr (Console::is(Console::CTR))
             this->updateQuad(quad);
 
-        const auto* texCoords = quad->getTextureCoordinates();
-        Color color           = graphics->getColor();
+        Color32 color = graphics->getColor();
+
+        const Vector2 offset = packed ? region.offset : Vector2(0.0f, 0.0f);
+        const Vector2 scale  = packed ? region.scale : Vector2(1.0f, 1.0f);
 
         for (int index = 0; index < 4; index++)
         {
-            stream[index].s     = texCoords[index].x;
-            stream[index].t     = texCoords[index].y;
+            stream[index].s     = offset.x + texCoords[index].x * scale.x;
+            stream[index].t     = offset.y + texCoords[index].y * scale.y;
             stream[index].color = color;
         }
     }
@@ -436,29 +469,33 @@ namespace love
 
         Matrix4 translated(transform, matrix);
 
+        if (graphics->isCulled(translated, quad->getVertexPositions(), 4))
+            return;
+
         BatchedDrawCommand command {};
-        command.format      = CommonFormat::XYf_STPf_RGBAf;
+        command.format      = CommonFormat::XYf_STf_RGBAub;
         command.indexMode   = TRIANGLEINDEX_QUADS;
         command.vertexCount = 4;
         command.texture     = this;
         command.shaderType  = shader;
 
-        auto data             = graphics->requestBatchedDraw(command);
-        XYf_STf_RGBAf* stream = (XYf_STf_RGBAf*)data.stream;
+        auto data      = graphics->requestBatchedDraw(command);
+        Vertex* stream = (Vertex*)data.stream;
 
         if (is2D)
-            translated.transformXY((Vertex*)data.stream, quad->getVertexPositions(), 4);
+            translated.transformXY(stream, quad->getVertexPositions(), 4);
 
         if constexpr (Console::is(Console::CTR))
             this->updateQuad(this->quad);
 
         const Vector2* texCoords = quad->getTextureCoordinates();
+        Color32 color            = graphics->getColor();
 
         for (int index = 0; index < 4; index++)
         {
             stream[index].s     = texCoords[index].x;
             stream[index].t     = texCoords[index].y;
-            stream[index].color = graphics->getColor();
+            stream[index].color = color;
         }
     }
 
@@ -518,6 +555,10 @@ namespace love
 
         GraphicsBase::flushBatchedDrawsGlobal();
 
+        /* textures that change at runtime are drawn on their own rather than patched in the page */
+        if (this->atlasRegion.page != nullptr && graphics != nullptr)
+            graphics->getTextureAtlas().remove(this);
+
         this->uploadImageData(data, mipmap, slice, x, y);
 
         if (reloadMipmaps && mipmap == 0 && this->getMipmapCount() > 1)
@@ -0,0 +1,245 @@
+#include "common/Logger.hpp"
+
+#include "modules/graphics/Graphics.tcc"
+#include "modules/graphics/TextureAtlas.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace love
+{
+    TextureAtlas::TextureAtlas() : pages {}, enabled(false)
+    {}
+
+    TextureAtlas::~TextureAtlas()
+    {
+        this->clear();
+    }
+
+    void TextureAtlas::setEnabled(bool enabled)
+    {
+        if (!enabled)
+            this->clear();
+
+        this->enabled = enabled;
+    }
+
+    bool TextureAtlas::canPack(TextureBase* texture, const TextureBase::Slices* slices)
+    {
+        if (slices == nullptr || slices->get(0, 0) == nullptr)
+            return false;
+
+        if (texture->getTextureType() != TEXTURE_2D || !texture->isReadable() || texture->isRenderTarget())
+            return false;
+
+        if (texture->isComputeWritable() || texture->isCompressed() || texture->getMipmapCount() > 1)
+            return false;
+
+        const auto& samplerState = texture->getSamplerState();
+
+        if (samplerState.wrapU != SamplerState::WRAP_CLAMP || samplerState.wrapV != SamplerState::WRAP_CLAMP)
+            return false;
+
+        const auto* imageData = slices->get(0, 0);
+        return imageData->getWidth() <= MAX_PACKED_SIZE && imageData->getHeight() <= MAX_PACKED_SIZE;
+    }
+
+    bool TextureAtlas::allocate(Page& page, int width, int height, Rect& rect)
+    {
+        for (auto it = page.freeRects.begin(); it != page.freeRects.end(); ++it)
+        {
+            if (it->w >= width && it->h >= height)
+            {
+                rect = { it->x, it->y, width, height };
+                page.freeRects.erase(it);
+                return true;
+            }
+        }
+
+        if (page.x + width > PAGE_SIZE)
+        {
+            page.x = 0;
+            page.y += page.rowHeight;
+            page.rowHeight = 0;
+        }
+
+        if (page.y + height > PAGE_SIZE)
+            return false;
+
+        rect = { page.x, page.y, width, height };
+
+        page.x += width;
+        page.rowHeight = std::max(page.rowHeight, height);
+
+        return true;
+    }
+
+    TextureAtlas::Page* TextureAtlas::createPage(GraphicsBase* graphics, PixelFormat format,
+                                                 const SamplerState& samplerState)
+    {
+        TextureBase::Settings settings {};
+        settings.format    = format;
+        settings.width     = PAGE_SIZE;
+        settings.height    = PAGE_SIZE;
+        settings.debugName = "TextureAtlas";
+
+        TextureBase* texture = nullptr;
+
+        try
+        {
+            texture = graphics->newTexture(settings, nullptr);
+            texture->setSamplerState(samplerState);
+        }
+        catch (love::Exception& e)
+        {
+            LOVE_LOG_WARN(GRAPHICS, "could not create texture atlas page: %s", e.what());
+
+            if (texture != nullptr)
+                texture->release();
+
+            return nullptr;
+        }
+
+        Page page {};
+        page.texture.set(texture, Acquire::NO_RETAIN);
+        page.samplerKey = samplerState.toKey();
+
+        this->pages.push_back(std::move(page));
+        return &this->pages.back();
+    }
+
+    bool TextureAtlas::pack(GraphicsBase* graphics, TextureBase* texture, const TextureBase::Slices* slices)
+    {
+        if (!this->enabled || !canPack(texture, slices))
+            return false;
+
+        const auto* imageData = slices->get(0, 0);
+
+        const int width        = imageData->getWidth();
+        const int height       = imageData->getHeight();
+        const int paddedWidth  = width + PADDING * 2;
+        const int paddedHeight = height + PADDING * 2;
+
+        const auto format     = texture->getPixelFormat();
+        const auto samplerKey = texture->getSamplerState().toKey();
+
+        Page* target = nullptr;
+        Rect rect {};
+
+        for (auto& page : this->pages)
+        {
+            if (page.texture->getPixelFormat() != format || page.samplerKey != samplerKey)
+                continue;
+
+            if (allocate(page, paddedWidth, paddedHeight, rect))
+            {
+                target = &page;
+                break;
+            }
+        }
+
+        if (target == nullptr)
+        {
+            target = this->createPage(graphics, format, texture->getSamplerState());
+
+            if (target == nullptr || !allocate(*target, paddedWidth, paddedHeight, rect))
+                return false;
+        }
+
+        /* the padding repeats the edge texels so filtering never picks up a neighbour */
+        const size_t pixelSize = getPixelFormatBlockSize(format);
+        const auto* source     = (const uint8_t*)imageData->getData();
+
+        std::vector<uint8_t> padded(paddedWidth * paddedHeight * pixelSize);
+
+        for (int y = 0; y < paddedHeight; y++)
+        {
+            const int sourceY    = std::clamp(y - PADDING, 0, height - 1);
+            const uint8_t* row   = source + sourceY * width * pixelSize;
+            uint8_t* destination = padded.data() + y * paddedWidth * pixelSize;
+
+            for (int x = 0; x < PADDING; x++)
+            {
+                std::memcpy(destination + x * pixelSize, row, pixelSize);
+                std::memcpy(destination + (PADDING + width + x) * pixelSize, row + (width - 1) * pixelSize,
+                            pixelSize);
+            }
+
+            std::memcpy(destination + PADDING * pixelSize, row, width * pixelSize);
+        }
+
+        target->texture->replacePixels(padded.data(), padded.size(), 0, 0, rect, false);
+        target->textures.push_back(texture);
+
+        TextureBase::AtlasRegion region {};
+        region.page   = target->texture;
+        region.rect   = { rect.x + PADDING, rect.y + PADDING, width, height };
+        region.offset = Vector2((float)region.rect.x / PAGE_SIZE, (float)region.rect.y / PAGE_SIZE);
+        region.scale  = Vector2((float)width / PAGE_SIZE, (float)height / PAGE_SIZE);
+
+        texture->setAtlasRegion(region);
+
+        return true;
+    }
+
+    void TextureAtlas::remove(TextureBase* texture)
+    {
+        const auto region = texture->getAtlasRegion();
+
+        if (region.page == nullptr)
+            return;
+
+        texture->setAtlasRegion({});
+
+        for (auto page = this->pages.begin(); page != this->pages.end(); ++page)
+        {
+            if (page->texture.get() != region.page)
+                continue;
+
+            auto& textures = page->textures;
+            textures.erase(std::remove(textures.begin(), textures.end(), texture), textures.end());
+
+            if (textures.empty())
+            {
+                GraphicsBase::flushBatchedDrawsGlobal();
+                this->pages.erase(page);
+                return;
+            }
+
+            Rect rect = region.rect;
+            rect.x -= PADDING;
+            rect.y -= PADDING;
+            rect.w += PADDING * 2;
+            rect.h += PADDING * 2;
+
+            page->freeRects.push_back(rect);
+            return;
+        }
+    }
+
+    void TextureAtlas::clear()
+    {
+        if (this->pages.empty())
+            return;
+
+        GraphicsBase::flushBatchedDrawsGlobal();
+
+        for (auto& page : this->pages)
+        {
+            for (auto* texture : page.textures)
+                texture->setAtlasRegion({});
+        }
+
+        this->pages.clear();
+    }
+
+    bool TextureAtlas::loadVolatile()
+    {
+        return true;
+    }
+
+    void TextureAtlas::unloadVolatile()
+    {
+        this->clear();
+    }
+} // namespace love
@@ -0,0 +1,42 @@
+#include "modules/graphics/UnitCircle.hpp"
+
+#include "common/math.hpp"
+
+#include <cmath>
+
+namespace love
+{
+    std::unordered_map<int, std::vector<Vector2>> UnitCircle::tables;
+
+    const Vector2* UnitCircle::get(int segments)
+    {
+        if (segments <= 0)
+            segments = 1;
+
+        auto it = tables.find(segments);
+
+        if (it != tables.end())
+            return it->second.data();
+
+        if (tables.size() >= MAX_TABLES)
+            tables.clear();
+
+        std::vector<Vector2> table(segments + 1);
+
+        /* each angle is computed directly, nothing accumulates around the circle */
+        for (int index = 0; index < segments; index++)
+        {
+            double phi   = (LOVE_M_PI * 2.0 * index) / segments;
+            table[index] = Vector2((float)std::cos(phi), (float)std::sin(phi));
+        }
+
+        table[segments] = table[0];
+
+        return tables.emplace(segments, std::move(table)).first->second.data();
+    }
+
+    void UnitCircle::clear()
+    {
+        tables.clear();
+    }
+} // namespace love
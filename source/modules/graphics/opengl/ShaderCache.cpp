@@ -0,0 +1,593 @@
+#include "ShaderCache.hpp"
+
+#include "common/Exception.hpp"
+#include "common/Logger.hpp"
+#include "common/StrongRef.hpp"
+
+#include "modules/filesystem/physfs/Filesystem.hpp"
+
+#ifdef USE_CAFEGLSL
+    #include "common/CafeGLSL.hpp"
+#endif
+
+#ifdef __WIIU__
+    #include <gx2/mem.h>
+    #include <gx2/shaders.h>
+    #include <malloc.h>
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace love
+{
+#ifdef __WIIU__
+    std::map<uint64_t, GX2VertexShader*> ShaderCache::vertexShaders;
+    std::map<uint64_t, GX2PixelShader*> ShaderCache::pixelShaders;
+#endif
+
+    ShaderCache::Stats ShaderCache::stats {};
+
+    namespace
+    {
+        constexpr const char* STAGE_EXTENSIONS[] = { "gx2v", "gx2p" };
+
+        /* sanity limits for tables read back from disk */
+        constexpr uint32_t MAX_TABLE_ENTRIES = 0x1000;
+        constexpr uint32_t MAX_PAYLOAD_SIZE  = 0x100000;
+
+        constexpr uint32_t NO_NAME = 0xFFFFFFFF;
+
+        class Writer
+        {
+          public:
+            Writer(std::vector<uint8_t>& output) : output(output)
+            {}
+
+            void write(const void* data, size_t size)
+            {
+                const auto* bytes = (const uint8_t*)data;
+                this->output.insert(this->output.end(), bytes, bytes + size);
+            }
+
+            void write(uint32_t value)
+            {
+                this->write(&value, sizeof(value));
+            }
+
+            /* names are stored as offsets into the string table that follows the program */
+            void writeName(const char* name)
+            {
+                if (name == nullptr)
+                    return this->write(NO_NAME);
+
+                this->write((uint32_t)this->strings.size());
+                this->strings.append(name, std::strlen(name) + 1);
+            }
+
+            std::string strings;
+
+          private:
+            std::vector<uint8_t>& output;
+        };
+
+        class Reader
+        {
+          public:
+            Reader(const uint8_t* data, size_t size) : data(data), size(size), position(0)
+            {}
+
+            const uint8_t* skip(size_t count)
+            {
+                if (count > this->size - this->position)
+                    return nullptr;
+
+                const uint8_t* result = this->data + this->position;
+                this->position += count;
+
+                return result;
+            }
+
+            bool read(void* out, size_t count)
+            {
+                const uint8_t* source = this->skip(count);
+
+                if (source == nullptr)
+                    return false;
+
+                std::memcpy(out, source, count);
+                return true;
+            }
+
+            template<typename T>
+            bool read(T& out)
+            {
+                uint32_t value = 0;
+
+                if (!this->read(&value, sizeof(value)))
+                    return false;
+
+                out = (T)value;
+                return true;
+            }
+
+            bool readName(const char* strings, uint32_t stringSize, const char*& out)
+            {
+                uint32_t offset = 0;
+
+                if (!this->read(offset))
+                    return false;
+
+                if (offset == NO_NAME)
+                {
+                    out = nullptr;
+                    return true;
+                }
+
+                if (offset >= stringSize)
+                    return false;
+
+                out = strings + offset;
+                return true;
+            }
+
+            bool atEnd() const
+            {
+                return this->position == this->size;
+            }
+
+          private:
+            const uint8_t* data;
+            size_t size;
+            size_t position;
+        };
+    } // namespace
+
+    uint64_t ShaderCache::hash(const void* data, size_t size, uint64_t seed)
+    {
+        const auto* bytes = (const uint8_t*)data;
+        uint64_t result   = seed;
+
+        for (size_t index = 0; index < size; index++)
+        {
+            result ^= bytes[index];
+            result *= 0x100000001B3ull;
+        }
+
+        return result;
+    }
+
+    uint64_t ShaderCache::getSourceHash(Stage stage, const std::string& source)
+    {
+        const uint32_t value = stage;
+        return hash(source.data(), source.size(), hash(&value, sizeof(value)));
+    }
+
+    uint64_t ShaderCache::getCompilerBuildId()
+    {
+#ifdef USE_CAFEGLSL
+        if (!CafeGLSLCompiler::Initialize())
+            return 0;
+
+        const uint64_t buildId = CafeGLSLCompiler::GetBuildId();
+        return hash(&CACHE_VERSION, sizeof(CACHE_VERSION), buildId);
+#else
+        return 0;
+#endif
+    }
+
+    const ShaderCache::Stats& ShaderCache::getStats()
+    {
+        return stats;
+    }
+
+    std::string ShaderCache::getFilepath(Stage stage, uint64_t sourceHash)
+    {
+        char name[32] {};
+        std::snprintf(name, sizeof(name), "%016llx.%s", (unsigned long long)sourceHash,
+                      STAGE_EXTENSIONS[stage]);
+
+        return std::string(CACHE_DIRECTORY) + "/" + name;
+    }
+
+    bool ShaderCache::readFile(Stage stage, uint64_t sourceHash, std::vector<uint8_t>& payload)
+    {
+        auto* filesystem = Module::getInstance<Filesystem>(Module::M_FILESYSTEM);
+
+        if (filesystem == nullptr)
+            return false;
+
+        const auto filepath = getFilepath(stage, sourceHash);
+
+        if (!filesystem->exists(filepath.c_str()))
+            return false;
+
+        StrongRef<FileData> data;
+
+        try
+        {
+            data.set(filesystem->read(filepath), Acquire::NO_RETAIN);
+        }
+        catch (love::Exception&)
+        {
+            return false;
+        }
+
+        Header header {};
+
+        if (data->getSize() < sizeof(Header))
+            return false;
+
+        std::memcpy(&header, data->getData(), sizeof(Header));
+
+        const auto* bytes = (const uint8_t*)data->getData() + sizeof(Header);
+        const size_t size = data->getSize() - sizeof(Header);
+
+        if (header.magic != CACHE_MAGIC || header.version != CACHE_VERSION)
+            return false;
+
+        if (header.compilerBuildId != getCompilerBuildId() || header.sourceHash != sourceHash)
+            return false;
+
+        if (header.stage != stage || header.payloadSize != size || size > MAX_PAYLOAD_SIZE)
+            return false;
+
+        if (header.payloadHash != hash(bytes, size))
+            return false;
+
+        payload.assign(bytes, bytes + size);
+        return true;
+    }
+
+    void ShaderCache::writeFile(Stage stage, uint64_t sourceHash, const std::vector<uint8_t>& payload)
+    {
+        auto* filesystem = Module::getInstance<Filesystem>(Module::M_FILESYSTEM);
+
+        if (filesystem == nullptr)
+            return;
+
+        Header header {};
+        header.magic           = CACHE_MAGIC;
+        header.version         = CACHE_VERSION;
+        header.compilerBuildId = getCompilerBuildId();
+        header.sourceHash      = sourceHash;
+        header.stage           = stage;
+        header.payloadSize     = (uint32_t)payload.size();
+        header.payloadHash     = hash(payload.data(), payload.size());
+
+        std::vector<uint8_t> contents(sizeof(Header) + payload.size());
+        std::memcpy(contents.data(), &header, sizeof(Header));
+        std::memcpy(contents.data() + sizeof(Header), payload.data(), payload.size());
+
+        try
+        {
+            filesystem->createDirectory(CACHE_DIRECTORY);
+            filesystem->write(getFilepath(stage, sourceHash), contents.data(), contents.size());
+        }
+        catch (love::Exception& e)
+        {
+            LOVE_LOG_WARN(SHADER, "could not write shader cache entry: %s", e.what());
+        }
+    }
+
+#ifdef __WIIU__
+    namespace
+    {
+        /*
+        ** Payload layout: the shader struct as-is (its pointers are rewritten on
+        ** load), the program, the string table, then every table with names
+        ** replaced by string table offsets.
+        */
+        template<typename T>
+        void serialize(const T& shader, std::vector<uint8_t>& payload)
+        {
+            std::vector<uint8_t> tables;
+            Writer writer(tables);
+
+            for (uint32_t index = 0; index < shader.uniformBlockCount; index++)
+            {
+                const auto& block = shader.uniformBlocks[index];
+
+                writer.writeName(block.name);
+                writer.write(block.offset);
+                writer.write(block.size);
+            }
+
+            for (uint32_t index = 0; index < shader.uniformVarCount; index++)
+            {
+                const auto& variable = shader.uniformVars[index];
+
+                writer.writeName(variable.name);
+                writer.write((uint32_t)variable.type);
+                writer.write(variable.count);
+                writer.write(variable.offset);
+                writer.write((uint32_t)variable.block);
+            }
+
+            writer.write(shader.initialValues, shader.initialValueCount * sizeof(GX2UniformInitialValue));
+            writer.write(shader.loopVars, shader.loopVarCount * sizeof(GX2LoopVar));
+
+            for (uint32_t index = 0; index < shader.samplerVarCount; index++)
+            {
+                const auto& sampler = shader.samplerVars[index];
+
+                writer.writeName(sampler.name);
+                writer.write((uint32_t)sampler.type);
+                writer.write(sampler.location);
+            }
+
+            if constexpr (std::is_same_v<T, GX2VertexShader>)
+            {
+                for (uint32_t index = 0; index < shader.attribVarCount; index++)
+                {
+                    const auto& attribute = shader.attribVars[index];
+
+                    writer.writeName(attribute.name);
+                    writer.write((uint32_t)attribute.type);
+                    writer.write(attribute.count);
+                    writer.write(attribute.location);
+                }
+            }
+
+            Writer output(payload);
+            output.write(&shader, sizeof(T));
+            output.write(shader.program, shader.size);
+            output.write((uint32_t)writer.strings.size());
+            output.write(writer.strings.data(), writer.strings.size());
+            output.write(tables.data(), tables.size());
+        }
+
+        template<typename T>
+        size_t getTableSize(const T& shader)
+        {
+            size_t size = shader.uniformBlockCount * sizeof(GX2UniformBlock) +
+                          shader.uniformVarCount * sizeof(GX2UniformVar) +
+                          shader.initialValueCount * sizeof(GX2UniformInitialValue) +
+                          shader.loopVarCount * sizeof(GX2LoopVar) +
+                          shader.samplerVarCount * sizeof(GX2SamplerVar);
+
+            if constexpr (std::is_same_v<T, GX2VertexShader>)
+                size += shader.attribVarCount * sizeof(GX2AttribVar);
+
+            return size;
+        }
+
+        template<typename T>
+        bool hasValidCounts(const T& shader)
+        {
+            if (shader.uniformBlockCount > MAX_TABLE_ENTRIES || shader.uniformVarCount > MAX_TABLE_ENTRIES ||
+                shader.initialValueCount > MAX_TABLE_ENTRIES || shader.loopVarCount > MAX_TABLE_ENTRIES ||
+                shader.samplerVarCount > MAX_TABLE_ENTRIES)
+                return false;
+
+            if constexpr (std::is_same_v<T, GX2VertexShader>)
+                return shader.attribVarCount <= MAX_TABLE_ENTRIES;
+
+            return true;
+        }
+
+        template<typename T>
+        void freeShader(T* shader)
+        {
+            if (shader == nullptr)
+                return;
+
+            std::free(shader->program);
+            std::free(shader);
+        }
+
+        /*
+        ** Rebuilds a shader from its payload. The struct, its tables and the
+        ** string table share one allocation; the program gets its own, aligned
+        ** for the GPU.
+        */
+        template<typename T>
+        T* deserialize(const std::vector<uint8_t>& payload)
+        {
+            Reader reader(payload.data(), payload.size());
+            T source {};
+
+            if (!reader.read(&source, sizeof(T)) || !hasValidCounts(source))
+                return nullptr;
+
+            const uint8_t* program = reader.skip(source.size);
+            uint32_t stringSize    = 0;
+
+            if (source.size == 0 || program == nullptr || !reader.read(stringSize))
+                return nullptr;
+
+            const auto* strings = (const char*)reader.skip(stringSize);
+
+            if (strings == nullptr || (stringSize > 0 && strings[stringSize - 1] != '\0'))
+                return nullptr;
+
+            const size_t tableSize = getTableSize(source);
+            auto* block            = (uint8_t*)std::malloc(sizeof(T) + tableSize + stringSize);
+
+            if (block == nullptr)
+                return nullptr;
+
+            T* shader = new (block) T(source);
+            std::memset(&shader->gx2rBuffer, 0, sizeof(shader->gx2rBuffer));
+
+            uint8_t* cursor  = block + sizeof(T);
+            char* ownStrings = (char*)(block + sizeof(T) + tableSize);
+            std::memcpy(ownStrings, strings, stringSize);
+
+            const auto take = [&cursor](auto*& table, uint32_t count) {
+                using Entry = std::remove_pointer_t<std::remove_reference_t<decltype(table)>>;
+
+                table = count > 0 ? (Entry*)cursor : nullptr;
+                cursor += count * sizeof(Entry);
+            };
+
+            take(shader->uniformBlocks, shader->uniformBlockCount);
+            take(shader->uniformVars, shader->uniformVarCount);
+            take(shader->initialValues, shader->initialValueCount);
+            take(shader->loopVars, shader->loopVarCount);
+            take(shader->samplerVars, shader->samplerVarCount);
+
+            if constexpr (std::is_same_v<T, GX2VertexShader>)
+                take(shader->attribVars, shader->attribVarCount);
+
+            bool valid = true;
+
+            for (uint32_t index = 0; valid && index < shader->uniformBlockCount; index++)
+            {
+                auto& entry = shader->uniformBlocks[index];
+
+                valid = reader.readName(ownStrings, stringSize, entry.name) && reader.read(entry.offset) &&
+                        reader.read(entry.size);
+            }
+
+            for (uint32_t index = 0; valid && index < shader->uniformVarCount; index++)
+            {
+                auto& entry = shader->uniformVars[index];
+
+                valid = reader.readName(ownStrings, stringSize, entry.name) && reader.read(entry.type) &&
+                        reader.read(entry.count) && reader.read(entry.offset) && reader.read(entry.block);
+            }
+
+            valid = valid &&
+                    reader.read(shader->initialValues,
+                                shader->initialValueCount * sizeof(GX2UniformInitialValue)) &&
+                    reader.read(shader->loopVars, shader->loopVarCount * sizeof(GX2LoopVar));
+
+            for (uint32_t index = 0; valid && index < shader->samplerVarCount; index++)
+            {
+                auto& entry = shader->samplerVars[index];
+
+                valid = reader.readName(ownStrings, stringSize, entry.name) && reader.read(entry.type) &&
+                        reader.read(entry.location);
+            }
+
+            if constexpr (std::is_same_v<T, GX2VertexShader>)
+            {
+                for (uint32_t index = 0; valid && index < shader->attribVarCount; index++)
+                {
+                    auto& entry = shader->attribVars[index];
+
+                    valid = reader.readName(ownStrings, stringSize, entry.name) && reader.read(entry.type) &&
+                            reader.read(entry.count) && reader.read(entry.location);
+                }
+            }
+
+            shader->program = valid && reader.atEnd()
+                                  ? (uint8_t*)memalign(GX2_SHADER_PROGRAM_ALIGNMENT, shader->size)
+                                  : nullptr;
+
+            if (shader->program == nullptr)
+            {
+                std::free(block);
+                return nullptr;
+            }
+
+            std::memcpy(shader->program, program, shader->size);
+            GX2Invalidate(GX2_INVALIDATE_MODE_CPU_SHADER, shader->program, shader->size);
+
+            return shader;
+        }
+
+        template<typename T>
+        T* compile(const std::string& source)
+        {
+    #ifdef USE_CAFEGLSL
+            if (!CafeGLSLCompiler::Initialize())
+                return nullptr;
+
+            if constexpr (std::is_same_v<T, GX2VertexShader>)
+                return CafeGLSLCompiler::CompileVertexShader(source);
+            else
+                return CafeGLSLCompiler::CompilePixelShader(source);
+    #else
+            (void)source;
+            return nullptr;
+    #endif
+        }
+
+        template<typename T>
+        void freeCompiled(T* shader)
+        {
+    #ifdef USE_CAFEGLSL
+            if constexpr (std::is_same_v<T, GX2VertexShader>)
+                CafeGLSLCompiler::FreeVertexShader(shader);
+            else
+                CafeGLSLCompiler::FreePixelShader(shader);
+    #else
+            (void)shader;
+    #endif
+        }
+    } // namespace
+
+    template<typename T>
+    T* ShaderCache::getShader(Stage stage, const std::string& source, std::map<uint64_t, T*>& shaders)
+    {
+        const uint64_t sourceHash = getSourceHash(stage, source);
+
+        if (auto it = shaders.find(sourceHash); it != shaders.end())
+        {
+            stats.memoryHits++;
+            return it->second;
+        }
+
+        std::vector<uint8_t> payload;
+        T* shader = nullptr;
+
+        if (readFile(stage, sourceHash, payload))
+        {
+            if ((shader = deserialize<T>(payload)) != nullptr)
+                stats.diskHits++;
+            else
+                stats.rejected++;
+        }
+
+        if (shader == nullptr)
+        {
+            /* failures are only remembered for this run, the compiler may be missing */
+            T* compiled = compile<T>(source);
+            stats.compiles++;
+
+            if (compiled != nullptr)
+            {
+                payload.clear();
+                serialize(*compiled, payload);
+                freeCompiled(compiled);
+
+                if ((shader = deserialize<T>(payload)) != nullptr)
+                    writeFile(stage, sourceHash, payload);
+            }
+        }
+
+        shaders[sourceHash] = shader;
+        return shader;
+    }
+
+    GX2VertexShader* ShaderCache::getVertexShader(const std::string& source)
+    {
+        return getShader(STAGE_VERTEX, source, vertexShaders);
+    }
+
+    GX2PixelShader* ShaderCache::getPixelShader(const std::string& source)
+    {
+        return getShader(STAGE_PIXEL, source, pixelShaders);
+    }
+#endif
+
+    void ShaderCache::clear()
+    {
+#ifdef __WIIU__
+        for (auto& [sourceHash, shader] : vertexShaders)
+            freeShader(shader);
+
+        for (auto& [sourceHash, shader] : pixelShaders)
+            freeShader(shader);
+
+        vertexShaders.clear();
+        pixelShaders.clear();
+#endif
+        stats = {};
+    }
+} // namespace love
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#ifdef __WIIU__
+struct GX2VertexShader;
+struct GX2PixelShader;
+#endif
+
+namespace love
+{
+    /*
+    ** Compiled GX2 shaders keyed by a hash of the translated GLSL the compiler
+    ** was given, kept in memory and persisted to shadercache/ in the save
+    ** directory. Hashing the translated source means changes to
+    ** ShaderTranslator or to the headers ShaderCompiler adds get new entries.
+    **
+    ** Each file stores the shader program together with its uniform, sampler
+    ** and attribute tables. The header records the cache format version and
+    ** the compiler build that produced it, files that don't match (or fail
+    ** validation) are recompiled and overwritten. Shaders returned from here
+    ** are owned by the cache and released in clear().
+    **
+    ** Only ShaderProgram compiles through here, and nothing creates one yet:
+    ** the shaders actually drawn with are the precompiled stages ShaderStage
+    ** loads.
+    */
+    class ShaderCache
+    {
+      public:
+        enum Stage : uint32_t
+        {
+            STAGE_VERTEX,
+            STAGE_PIXEL,
+            STAGE_MAX_ENUM
+        };
+
+        struct Stats
+        {
+            int memoryHits;
+            int diskHits;
+            int compiles;
+            int rejected;
+        };
+
+        static constexpr uint32_t CACHE_MAGIC   = 0x4C505343; //< "LPSC"
+        static constexpr uint32_t CACHE_VERSION = 2;
+
+        static constexpr const char* CACHE_DIRECTORY = "shadercache";
+
+        static uint64_t hash(const void* data, size_t size, uint64_t seed = 0xCBF29CE484222325ull);
+
+        /* `source` is the translated source handed to the compiler */
+        static uint64_t getSourceHash(Stage stage, const std::string& source);
+
+        /* identifies the compiler whose output is in the cache, 0 if unavailable */
+        static uint64_t getCompilerBuildId();
+
+        static const Stats& getStats();
+
+#ifdef __WIIU__
+        /* `source` is the translated source, see ShaderCompiler::compileVertexShader */
+        static GX2VertexShader* getVertexShader(const std::string& source);
+
+        static GX2PixelShader* getPixelShader(const std::string& source);
+#endif
+
+        static void clear();
+
+      private:
+        struct Header
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t compilerBuildId;
+            uint64_t sourceHash;
+            uint32_t stage;
+            uint32_t payloadSize;
+            uint64_t payloadHash;
+        };
+
+        static std::string getFilepath(Stage stage, uint64_t sourceHash);
+
+        static bool readFile(Stage stage, uint64_t sourceHash, std::vector<uint8_t>& payload);
+
+        static void writeFile(Stage stage, uint64_t sourceHash, const std::vector<uint8_t>& payload);
+
+#ifdef __WIIU__
+        template<typename T>
+        static T* getShader(Stage stage, const std::string& source, std::map<uint64_t, T*>& shaders);
+
+        static std::map<uint64_t, GX2VertexShader*> vertexShaders;
+        static std::map<uint64_t, GX2PixelShader*> pixelShaders;
+#endif
+
+        static Stats stats;
+    };
+} // namespace love
@@ -1,4 +1,6 @@
 #include "ShaderCompiler.hpp"
+#include "ShaderCache.hpp"
+#include "ShaderTranslator.hpp"
 
 #ifdef __WIIU__
 #include <gx2/shaders.h>
@@ -9,25 +11,19 @@
 #include <cstdlib>
 #endif
 
-#include <regex>
 #include <sstream>
 
 namespace love
 {
     std::map<std::string, int> ShaderCompiler::uniformLocations;
-    std::map<std::string, GX2VertexShader*> ShaderCompiler::compiledVertexShaders;
-    std::map<std::string, GX2PixelShader*> ShaderCompiler::compiledPixelShaders;
 
     std::string ShaderCompiler::compileVertexShader(const std::string& source)
     {
 #ifdef __WIIU__
         try {
-            // Enhanced GLSL to GX2 vertex shader conversion
-            std::string gx2Source = processShaderDefines(source);
-            
-            // Convert GLSL attributes to GX2 attributes
-            gx2Source = std::regex_replace(gx2Source, std::regex("attribute"), "in");
-            gx2Source = std::regex_replace(gx2Source, std::regex("varying"), "out");
+            // Strips LOVE_SHADER_* blocks and rewrites attribute/varying in one pass
+            auto translated = ShaderTranslator::translate(source, ShaderTranslator::STAGE_VERTEX);
+            std::string& gx2Source = translated.source;
             
             // Add required Love2D vertex shader uniforms and attributes
             std::string loveVertexHeader = R"(
@@ -54,7 +50,7 @@ out vec4 VaryingColor;
 )";
 
         // If no main function found, add default Love2D vertex main
-        if (gx2Source.find("main") == std::string::npos)
+        if (!translated.hasMain)
         {
             gx2Source += R"(
 void main()
@@ -79,11 +75,9 @@ void main()
     {
 #ifdef __WIIU__
         try {
-            // Enhanced GLSL to GX2 pixel shader conversion
-            std::string gx2Source = processShaderDefines(source);
-            
-            // Convert GLSL varying to in for fragment shaders
-            gx2Source = std::regex_replace(gx2Source, std::regex("varying"), "in");
+            // Strips LOVE_SHADER_* blocks and rewrites varying, gl_FragColor and texture2D in one pass
+            auto translated = ShaderTranslator::translate(source, ShaderTranslator::STAGE_PIXEL);
+            std::string& gx2Source = translated.source;
             
             // Add required Love2D pixel shader header
             std::string lovePixelHeader = R"(
@@ -103,7 +97,7 @@ out vec4 love_Pixelcolor;
 )";
 
             // If no main function found, add default Love2D pixel main
-            if (gx2Source.find("main") == std::string::npos)
+            if (!translated.hasMain)
             {
                 gx2Source += R"(
 void main()
@@ -112,12 +106,6 @@ void main()
 }
 )";
             }
-            else
-            {
-                // Replace common Love2D shader patterns
-                gx2Source = std::regex_replace(gx2Source, std::regex("gl_FragColor"), "love_Pixelcolor");
-                gx2Source = std::regex_replace(gx2Source, std::regex("texture2D"), "texture");
-            }
             
             return lovePixelHeader + "\n" + gx2Source;
         } catch (const std::exception& e) {
@@ -128,82 +116,30 @@ void main()
 #endif
     }
 
-    std::string ShaderCompiler::processShaderDefines(const std::string& source)
-    {
-        std::string processed = source;
-        
-        // Process #ifdef LOVE_SHADER_VERTEX and similar
-        processed = std::regex_replace(processed, 
-            std::regex("#ifdef LOVE_SHADER_VERTEX[\\s\\S]*?#endif"), "");
-        processed = std::regex_replace(processed, 
-            std::regex("#ifdef LOVE_SHADER_PIXEL[\\s\\S]*?#endif"), "");
-            
-        return processed;
-    }
-
+#ifdef __WIIU__
     GX2VertexShader* ShaderCompiler::compileAndCacheVertexShader(const std::string& source)
     {
-#ifdef __WIIU__
-        try {
-            // Check cache first
-            auto it = compiledVertexShaders.find(source);
-            if (it != compiledVertexShaders.end())
-                return it->second;
+        // Keyed by the translated source, so translator changes don't hit stale binaries
+        std::string compiledSource = compileVertexShader(source);
 
-            // Compile GLSL to GX2 compatible code
-            std::string compiledSource = compileVertexShader(source);
-            
-            // Check if compilation failed
-            if (compiledSource.find("// Vertex shader compilation failed:") == 0) {
-                return nullptr; // Return null for failed compilation
-            }
-            
-            // For now, return nullptr to avoid crashes until proper GX2 compilation is implemented
-            // TODO: Implement real GLSL-to-GX2 compilation
-            
-            // Cache null result to avoid repeated failed attempts
-            compiledVertexShaders[source] = nullptr;
-            
+        // Check if compilation failed
+        if (compiledSource.find("// Vertex shader compilation failed:") == 0)
             return nullptr;
-        } catch (const std::exception& e) {
-            return nullptr;
-        }
-#else
-        return nullptr;
-#endif
+
+        return ShaderCache::getVertexShader(compiledSource);
     }
 
     GX2PixelShader* ShaderCompiler::compileAndCachePixelShader(const std::string& source)
     {
-#ifdef __WIIU__
-        try {
-            // Check cache first
-            auto it = compiledPixelShaders.find(source);
-            if (it != compiledPixelShaders.end())
-                return it->second;
+        std::string compiledSource = compileFragmentShader(source);
 
-            // Compile GLSL to GX2 compatible code
-            std::string compiledSource = compileFragmentShader(source);
-            
-            // Check if compilation failed
-            if (compiledSource.find("// Fragment shader compilation failed:") == 0) {
-                return nullptr; // Return null for failed compilation
-            }
-            
-            // For now, return nullptr to avoid crashes until proper GX2 compilation is implemented
-            // TODO: Implement real GLSL-to-GX2 compilation
-            
-            // Cache null result to avoid repeated failed attempts
-            compiledPixelShaders[source] = nullptr;
-            
-            return nullptr;
-        } catch (const std::exception& e) {
+        // Check if compilation failed
+        if (compiledSource.find("// Fragment shader compilation failed:") == 0)
             return nullptr;
-        }
-#else
-        return nullptr;
-#endif
+
+        return ShaderCache::getPixelShader(compiledSource);
     }
+#endif
 
     bool ShaderCompiler::validateShader(const std::string& source, const std::string& type)
     {
@@ -343,23 +279,8 @@ void main()
 
     void ShaderCompiler::clearCache()
     {
-#ifdef __WIIU__
-        // Clean up cached shaders
-        for (auto& pair : compiledVertexShaders)
-        {
-            if (pair.second)
-                free(pair.second);
-        }
-        
-        for (auto& pair : compiledPixelShaders)
-        {
-            if (pair.second)
-                free(pair.second);
-        }
-        
-        compiledVertexShaders.clear();
-        compiledPixelShaders.clear();
-#endif
+        // Frees the in-memory copies; entries on disk are kept for the next run
+        ShaderCache::clear();
         uniformLocations.clear();
     }
 
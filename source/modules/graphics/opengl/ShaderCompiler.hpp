@@ -18,7 +18,7 @@ namespace love
         static std::string compileVertexShader(const std::string& source);
         static std::string compileFragmentShader(const std::string& source);
         
-        // Enhanced shader compilation with caching
+        // Compiled through ShaderCache, which persists GX2 binaries in the save directory
         #ifdef __WIIU__
         static struct GX2VertexShader* compileAndCacheVertexShader(const std::string& source);
         static struct GX2PixelShader* compileAndCachePixelShader(const std::string& source);
@@ -48,12 +48,6 @@ namespace love
         static bool hasShaderSupport();
         
     private:
-        static std::string processShaderDefines(const std::string& source);
         static std::map<std::string, int> uniformLocations;
-        
-        #ifdef __WIIU__
-        static std::map<std::string, struct GX2VertexShader*> compiledVertexShaders;
-        static std::map<std::string, struct GX2PixelShader*> compiledPixelShaders;
-        #endif
     };
 }
@@ -0,0 +1,190 @@
+#include "ShaderTranslator.hpp"
+
+namespace love
+{
+    namespace
+    {
+        bool isIdentifierStart(char c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+        }
+
+        bool isIdentifierPart(char c)
+        {
+            return isIdentifierStart(c) || (c >= '0' && c <= '9');
+        }
+
+        bool isSpace(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+        }
+
+        size_t findLineEnd(std::string_view source, size_t position)
+        {
+            const size_t end = source.find('\n', position);
+            return end == std::string_view::npos ? source.size() : end;
+        }
+    } // namespace
+
+    std::string_view ShaderTranslator::getReplacement(std::string_view identifier, Stage stage)
+    {
+        if (identifier == "varying")
+            return stage == STAGE_VERTEX ? "out" : "in";
+
+        if (stage == STAGE_VERTEX)
+        {
+            if (identifier == "attribute")
+                return "in";
+        }
+        else
+        {
+            if (identifier == "gl_FragColor")
+                return "love_Pixelcolor";
+            else if (identifier == "texture2D")
+                return "texture";
+        }
+
+        return identifier;
+    }
+
+    ShaderTranslator::Result ShaderTranslator::translate(std::string_view source, Stage stage)
+    {
+        Result result {};
+        result.source.reserve(source.size() + 32);
+
+        /* the compiler's preprocessor keeps the block for this stage and drops the other */
+        result.source += stage == STAGE_VERTEX ? "#define LOVE_SHADER_VERTEX\n" : "#define LOVE_SHADER_PIXEL\n";
+
+        bool lineStart = true;
+
+        /* uniform declaration state: the last identifier seen is the name until [ = , or ; */
+        bool inUniform = false;
+        bool named     = false;
+        std::string_view declarator;
+
+        const auto endDeclarator = [&]() {
+            if (!named && !declarator.empty())
+                result.uniforms.emplace_back(declarator);
+
+            named = true;
+        };
+
+        size_t position = 0;
+
+        while (position < source.size())
+        {
+            const char c = source[position];
+
+            if (c == '\n' || isSpace(c))
+            {
+                result.source += c;
+
+                lineStart = lineStart || c == '\n';
+                position++;
+                continue;
+            }
+
+            if (c == '#' && lineStart)
+            {
+                /* directives are left to the compiler's preprocessor */
+                const size_t end = findLineEnd(source, position);
+                result.source += source.substr(position, end - position);
+
+                position = end;
+                continue;
+            }
+
+            lineStart = false;
+
+            const char next = position + 1 < source.size() ? source[position + 1] : '\0';
+
+            if (c == '/' && (next == '/' || next == '*'))
+            {
+                size_t end = 0;
+
+                if (next == '/')
+                    end = findLineEnd(source, position);
+                else
+                {
+                    end = source.find("*/", position + 2);
+                    end = end == std::string_view::npos ? source.size() : end + 2;
+                }
+
+                result.source += source.substr(position, end - position);
+
+                position = end;
+                continue;
+            }
+
+            if (isIdentifierStart(c) || (c >= '0' && c <= '9'))
+            {
+                const size_t start = position;
+
+                /* numbers are read whole so suffixes and exponents are never taken for identifiers */
+                while (position < source.size())
+                {
+                    const char current = source[position];
+
+                    if (!isIdentifierPart(current) && (current != '.' || isIdentifierStart(c)))
+                        break;
+
+                    position++;
+                }
+
+                const auto token = source.substr(start, position - start);
+
+                if (!isIdentifierStart(c))
+                {
+                    result.source += token;
+                    continue;
+                }
+
+                if (token == "main")
+                    result.hasMain = true;
+
+                if (token == "uniform")
+                {
+                    inUniform  = true;
+                    named      = false;
+                    declarator = {};
+                }
+                else if (inUniform && !named)
+                    declarator = token;
+
+                result.source += getReplacement(token, stage);
+                continue;
+            }
+
+            if (inUniform)
+            {
+                switch (c)
+                {
+                    case '[':
+                    case '=':
+                        endDeclarator();
+                        break;
+                    case ',':
+                        endDeclarator();
+                        named      = false;
+                        declarator = {};
+                        break;
+                    case ';':
+                        endDeclarator();
+                        inUniform = false;
+                        break;
+                    case '{':
+                        /* uniform blocks are left to the compiler's reflection */
+                        inUniform = false;
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            result.source += c;
+            position++;
+        }
+
+        return result;
+    }
+} // namespace love
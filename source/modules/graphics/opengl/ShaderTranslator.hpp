@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Rewrites LOVE-style GLSL into GLSL 330 in one pass over the source.
+    **
+    ** Identifiers are rewritten as whole tokens (attribute, varying,
+    ** gl_FragColor, texture2D) and comments are copied through untouched.
+    ** LOVE_SHADER_VERTEX or LOVE_SHADER_PIXEL is defined at the top for the
+    ** stage, preprocessor lines are passed through, and the compiler picks
+    ** the matching #ifdef blocks. Uniform names are collected on the way.
+    */
+    class ShaderTranslator
+    {
+      public:
+        enum Stage
+        {
+            STAGE_VERTEX,
+            STAGE_PIXEL,
+            STAGE_MAX_ENUM
+        };
+
+        struct Result
+        {
+            std::string source;
+            std::vector<std::string> uniforms;
+            bool hasMain;
+        };
+
+        static Result translate(std::string_view source, Stage stage);
+
+      private:
+        static std::string_view getReplacement(std::string_view identifier, Stage stage);
+    };
+} // namespace love
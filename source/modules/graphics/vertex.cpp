@@ -13,7 +13,7 @@ namespace love
             std::printf("Vertex %zu:\n", i);
             std::printf("  Position: %.2f, %.2f\n", v.x, v.y);
             std::printf("  Texture Coordinates: %f, %f\n", v.s, v.t);
-            std::printf("  Color: %.2f, %.2f, %.2f, %.2f\n", v.color.r, v.color.g, v.color.b, v.color.a);
+            std::printf("  Color: %u, %u, %u, %u\n", v.color.r, v.color.g, v.color.b, v.color.a);
         }
     }
 
@@ -66,6 +66,8 @@ namespace love
                 return sizeof(XYf_STf_RGBAf);
             case CommonFormat::XYf_STus_RGBAf:
                 return sizeof(XYf_STus_RGBAf);
+            case CommonFormat::XYf_STf_RGBAub:
+                return sizeof(XYf_STf_RGBAub);
             case CommonFormat::XYf_STPf_RGBAf:
                 return sizeof(XYf_STPf_RGBAf);
         }
@@ -183,6 +185,11 @@ namespace love
                 set(ATTRIB_COLOR, DATAFORMAT_FLOAT_VEC4, uint16_t(sizeof(float) * 2 + sizeof(uint16_t) * 2),
                     bufferindex);
                 break;
+            case CommonFormat::XYf_STf_RGBAub:
+                set(ATTRIB_POS, DATAFORMAT_FLOAT_VEC2, 0, bufferindex);
+                set(ATTRIB_TEXCOORD, DATAFORMAT_FLOAT_VEC2, uint16_t(sizeof(float) * 2), bufferindex);
+                set(ATTRIB_COLOR, DATAFORMAT_UNORM8_VEC4, uint16_t(sizeof(float) * 4), bufferindex);
+                break;
             case CommonFormat::XYf_STPf_RGBAf:
                 set(ATTRIB_POS, DATAFORMAT_FLOAT_VEC2, 0, bufferindex);
                 set(ATTRIB_TEXCOORD, DATAFORMAT_FLOAT_VEC3, uint16_t(sizeof(float) * 2), bufferindex);
@@ -221,6 +221,17 @@ int Wrap_Font::getDPIScale(lua_State* L)
     return 1;
 }
 
+int Wrap_Font::preload(lua_State* L)
+{
+    auto* self      = luax_checkfont(L, 1);
+    auto text       = luax_checkstring(L, 2);
+    bool background = luax_optboolean(L, 3, false);
+
+    luax_catchexcept(L, [&]() { self->preload(text, background); });
+
+    return 0;
+}
+
 // clang-format off
 static constexpr luaL_Reg functions[] =
 {
@@ -236,7 +247,8 @@ static constexpr luaL_Reg functions[] =
     { "getBaseline",   Wrap_Font::getBaseline   },
     { "hasGlyphs",     Wrap_Font::hasGlyphs     },
     { "setFallbacks",  Wrap_Font::setFallbacks  },
-    { "getDPIScale",   Wrap_Font::getDPIScale   }
+    { "getDPIScale",   Wrap_Font::getDPIScale   },
+    { "preload",       Wrap_Font::preload       }
 };
 // clang-format on
 
@@ -1,3 +1,4 @@
+#include "common/Logger.hpp"
 #include "common/screen.hpp"
 
 #include "modules/graphics/wrap_Graphics.hpp"
@@ -9,6 +10,7 @@
 #include "modules/filesystem/wrap_Filesystem.hpp"
 
 #include "modules/graphics/wrap_Font.hpp"
+#include "modules/graphics/wrap_Mesh.hpp"
 #include "modules/graphics/wrap_Quad.hpp"
 #include "modules/graphics/wrap_SpriteBatch.hpp"
 #include "modules/graphics/wrap_TextBatch.hpp"
@@ -21,7 +23,6 @@
 #include "modules/image/wrap_Image.hpp"
 #include "modules/image/wrap_ImageData.hpp"
 
-#include <fstream>
 
 using namespace love;
 
@@ -52,20 +53,7 @@ int Wrap_Graphics::reset(lua_State*)
 
 int Wrap_Graphics::clear(lua_State* L)
 {
-#ifdef __WIIU__
-    static int clearCallCount = 0;
-    clearCallCount++;
-    
-    if (clearCallCount <= 10 || clearCallCount % 60 == 0) // Log first 10 calls, then every 60 calls
-    {
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "clear() called from Lua (call #%d)\n", clearCallCount);
-            fflush(logFile);
-            fclose(logFile);
-        }
-    }
-#endif
+    LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 10, 60, "clear() called from Lua");
     OptionalColor color(Color(0, 0, 0, 0));
     std::vector<OptionalColor> colors {};
 
@@ -155,18 +143,7 @@ int Wrap_Graphics::clear(lua_State* L)
 
 int Wrap_Graphics::present(lua_State* L)
 {
-#ifdef __WIIU__
-    static int presentCount = 0;
-    presentCount++;
-    if (presentCount <= 5 || presentCount % 60 == 0) {
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "present() called from Lua (#%d)\n", presentCount);
-            fflush(logFile);
-            fclose(logFile);
-        }
-    }
-#endif
+    LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 5, 60, "present() called from Lua");
     luax_catchexcept(L, [&]() { instance()->present(L); });
 
     return 0;
@@ -174,18 +151,7 @@ int Wrap_Graphics::present(lua_State* L)
 
 int Wrap_Graphics::setColor(lua_State* L)
 {
-#ifdef __WIIU__
-    static int setColorCount = 0;
-    setColorCount++;
-    if (setColorCount <= 10 || setColorCount % 120 == 0) {
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "setColor() called from Lua (#%d)\n", setColorCount);
-            fflush(logFile);
-            fclose(logFile);
-        }
-    }
-#endif
+    LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 10, 120, "setColor() called from Lua");
     Color color {};
 
     if (lua_istable(L, 1))
@@ -227,14 +193,7 @@ int Wrap_Graphics::getColor(lua_State* L)
 
 int Wrap_Graphics::setBackgroundColor(lua_State* L)
 {
-#ifdef __WIIU__
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "setBackgroundColor() called from Lua\n");
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "setBackgroundColor() called from Lua");
     Color color {};
 
     if (lua_istable(L, 1))
@@ -968,110 +927,42 @@ static int pushNewTexture(lua_State* L, TextureBase::Slices* slices, const Textu
 {
     StrongRef<TextureBase> texture;
 
-#ifdef __WIIU__
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "pushNewTexture() called - about to create texture\n");
-        fprintf(logFile, "  settings.type: %d, slices: %p\n", settings.type, slices);
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "pushNewTexture() called - about to create texture");
+    LOVE_LOG_TRACE(GRAPHICS, "  settings.type: %d, slices: %p", settings.type, slices);
 
     // clang-format off
     luax_catchexcept(L,
         [&]() { 
-#ifdef __WIIU__
-            FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile2) {
-                fprintf(logFile2, "pushNewTexture() - calling instance()->newTexture()\n");
-                fflush(logFile2);
-                fclose(logFile2);
-            }
-#endif
+            LOVE_LOG_TRACE(GRAPHICS, "pushNewTexture() - calling instance()->newTexture()");
             texture.set(instance()->newTexture(settings, slices), Acquire::NO_RETAIN);
-#ifdef __WIIU__
-            FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile3) {
-                fprintf(logFile3, "pushNewTexture() - newTexture() returned: %p\n", texture.get());
-                fflush(logFile3);
-                fclose(logFile3);
-            }
-#endif
+            instance()->getTextureAtlas().pack(instance(), texture, slices);
+            LOVE_LOG_TRACE(GRAPHICS, "pushNewTexture() - newTexture() returned: %p", texture.get());
         },
         [&](bool) { 
-#ifdef __WIIU__
-            FILE* logFile4 = fopen("fs:/vol/external01/simple_debug.log", "a");
-            if (logFile4) {
-                fprintf(logFile4, "pushNewTexture() - EXCEPTION occurred in newTexture()\n");
-                fflush(logFile4);
-                fclose(logFile4);
-            }
-#endif
+            LOVE_LOG_TRACE(GRAPHICS, "pushNewTexture() - EXCEPTION occurred in newTexture()");
             if (slices) slices->clear(); 
         }
     );
     // clang-format on
 
-#ifdef __WIIU__
-    FILE* logFile5 = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile5) {
-        fprintf(logFile5, "pushNewTexture() - about to push texture to Lua stack\n");
-        fprintf(logFile5, "pushNewTexture() - texture.get() = %p\n", texture.get());
-        if (texture.get() == nullptr) {
-            fprintf(logFile5, "pushNewTexture() - ERROR: texture is NULL, cannot push to Lua\n");
-        } else {
-            fprintf(logFile5, "pushNewTexture() - texture is valid, pushing to Lua\n");
-        }
-        fflush(logFile5);
-        fclose(logFile5);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "pushNewTexture() - texture.get() = %p", texture.get());
 
     if (texture.get() == nullptr) {
-#ifdef __WIIU__
-        FILE* logFile6 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile6) {
-            fprintf(logFile6, "pushNewTexture() - returning luaL_error due to NULL texture\n");
-            fflush(logFile6);
-            fclose(logFile6);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "pushNewTexture() - returning luaL_error due to NULL texture");
         return luaL_error(L, "Texture creation failed");
     }
 
     luax_pushtype(L, texture);
     
-#ifdef __WIIU__
-    FILE* logFile7 = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile7) {
-        fprintf(logFile7, "pushNewTexture() - texture successfully pushed to Lua stack\n");
-        fflush(logFile7);
-        fclose(logFile7);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "pushNewTexture() - texture successfully pushed to Lua stack");
     
     return 1;
 }
 
 int Wrap_Graphics::newTexture(lua_State* L)
 {
-#ifdef __WIIU__
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "newTexture() called from Lua with %d arguments\n", lua_gettop(L));
-        if (lua_gettop(L) > 0) {
-            int argType = lua_type(L, 1);
-            fprintf(logFile, "  First argument type: %d (%s)\n", argType, lua_typename(L, argType));
-            if (argType == LUA_TSTRING) {
-                const char* str = lua_tostring(L, 1);
-                fprintf(logFile, "  First argument string: %s\n", str ? str : "NULL");
-            }
-        }
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "newTexture() called with %d arguments (first: %s)", lua_gettop(L),
+                   lua_gettop(L) > 0 ? luaL_typename(L, 1) : "none");
     
     luax_checkgraphicscreated(L);
 
@@ -1306,18 +1197,7 @@ int Wrap_Graphics::newArrayTexture(lua_State* L)
 
 int Wrap_Graphics::draw(lua_State* L)
 {
-#ifdef __WIIU__
-    static int drawCount = 0;
-    drawCount++;
-    if (drawCount <= 10 || drawCount % 120 == 0) {
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "draw() called from Lua (#%d)\n", drawCount);
-            fflush(logFile);
-            fclose(logFile);
-        }
-    }
-#endif
+    LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 10, 120, "draw() called from Lua");
     Drawable* drawable   = nullptr;
     TextureBase* texture = nullptr;
 
@@ -1347,18 +1227,23 @@ int Wrap_Graphics::draw(lua_State* L)
     return 0;
 }
 
+int Wrap_Graphics::drawInstanced(lua_State* L)
+{
+    auto* mesh        = luax_checkmesh(L, 1);
+    int instanceCount = luaL_checkinteger(L, 2);
+
+    luax_checkstandardtransform(L, 3, [&](const Matrix4& transform) {
+        luax_catchexcept(L, [&]() { instance()->drawInstanced(mesh, transform, instanceCount); });
+    });
+
+    return 0;
+}
+
 int Wrap_Graphics::setFont(lua_State* L)
 {
     auto* font = luax_checktype<FontBase>(L, 1);
     
-#ifdef __WIIU__
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "setFont() called with font: %p\n", font);
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "setFont() called with font: %p", font);
     
     instance()->setFont(font);
 
@@ -1372,14 +1257,7 @@ int Wrap_Graphics::getFont(lua_State* L)
     FontBase* font = nullptr;
     luax_catchexcept(L, [&]() { font = instance()->getFont(); });
 
-#ifdef __WIIU__
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "getFont() called: returning font=%p\n", font);
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "getFont() called: returning font=%p", font);
 
     luax_pushtype(L, font);
 
@@ -1536,249 +1414,121 @@ int Wrap_Graphics::newSpriteBatch(lua_State* L)
     return 1;
 }
 
+int Wrap_Graphics::newMesh(lua_State* L)
+{
+    luax_checkgraphicscreated(L);
+
+    MeshBase::DrawMode mode = MESHDRAWMODE_FAN;
+    BufferDataUsage usage   = BUFFERDATAUSAGE_DYNAMIC;
+
+    if (!lua_isnoneornil(L, 2))
+    {
+        const char* name = luaL_checkstring(L, 2);
+        if (!MeshBase::getConstant(name, mode))
+            return luax_enumerror(L, "mesh draw mode", name);
+    }
+
+    if (!lua_isnoneornil(L, 3))
+    {
+        const char* usageType = luaL_checkstring(L, 3);
+        if (!getConstant(usageType, usage))
+            return luax_enumerror(L, "usage hint", BufferUsages, usageType);
+    }
+
+    MeshBase* mesh = nullptr;
+
+    if (lua_istable(L, 1))
+    {
+        auto vertices = luax_checkmeshvertices(L, 1);
+        luax_catchexcept(L, [&]() { mesh = instance()->newMesh(vertices, mode, usage); });
+    }
+    else
+    {
+        int count = luaL_checkinteger(L, 1);
+        luax_catchexcept(L, [&]() { mesh = instance()->newMesh(count, mode, usage); });
+    }
+
+    luax_pushtype(L, mesh);
+    mesh->release();
+
+    return 1;
+}
+
 int Wrap_Graphics::newFont(lua_State* L)
 {
     luax_checkgraphicscreated(L);
 
-#ifdef __WIIU__
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "newFont() called from Lua with %d arguments\n", lua_gettop(L));
-        for (int i = 1; i <= lua_gettop(L); i++) {
-            fprintf(logFile, "  Argument %d type: %d\n", i, lua_type(L, i));
-            if (lua_type(L, i) == LUA_TSTRING) {
-                fprintf(logFile, "  Argument %d string: %s\n", i, lua_tostring(L, i));
-            } else if (lua_type(L, i) == LUA_TNUMBER) {
-                fprintf(logFile, "  Argument %d number: %f\n", i, lua_tonumber(L, i));
-            }
-        }
-        fflush(logFile);
-        fclose(logFile);
+    if (LOVE_LOG_ENABLED(TRACE, GRAPHICS))
+    {
+        LOVE_LOG_TRACE(GRAPHICS, "newFont() called with %d arguments", lua_gettop(L));
+
+        for (int index = 1; index <= lua_gettop(L); index++)
+            LOVE_LOG_TRACE(GRAPHICS, "  argument %d: %s", index, luaL_typename(L, index));
     }
-#endif
 
     FontBase* font = nullptr;
 
-#ifdef __WIIU__
-    FILE* logFile_step1 = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile_step1) {
-        fprintf(logFile_step1, "newFont() - checking if need to create rasterizer\n");
-        fflush(logFile_step1);
-        fclose(logFile_step1);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "newFont() - checking if need to create rasterizer");
 
     if (!luax_istype(L, 1, Rasterizer::type))
     {
-#ifdef __WIIU__
-        FILE* logFile_rast = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile_rast) {
-            fprintf(logFile_rast, "newFont() - creating rasterizer from arguments\n");
-            fflush(logFile_rast);
-            fclose(logFile_rast);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "newFont() - creating rasterizer from arguments");
         std::vector<int> indices {};
 
         for (int index = 0; index < lua_gettop(L); index++)
             indices.push_back(index + 1);
 
         luax_convobj(L, indices, "font", "newRasterizer");
-#ifdef __WIIU__
-        FILE* logFile_rast2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile_rast2) {
-            fprintf(logFile_rast2, "newFont() - rasterizer created successfully\n");
-            fflush(logFile_rast2);
-            fclose(logFile_rast2);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "newFont() - rasterizer created successfully");
     }
 
-#ifdef __WIIU__
-    FILE* logFile_check = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile_check) {
-        fprintf(logFile_check, "newFont() - about to get rasterizer from Lua stack\n");
-        fflush(logFile_check);
-        fclose(logFile_check);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "newFont() - about to get rasterizer from Lua stack");
 
     auto* rasterizer = luax_checktype<Rasterizer>(L, 1);
 
-#ifdef __WIIU__
-    FILE* logFile_rast_ptr = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile_rast_ptr) {
-        fprintf(logFile_rast_ptr, "newFont() - got rasterizer: %p\n", rasterizer);
-        fflush(logFile_rast_ptr);
-        fclose(logFile_rast_ptr);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "newFont() - got rasterizer: %p", rasterizer);
 
     luax_catchexcept(L, [&]() { font = instance()->newFont(rasterizer); });
 
-#ifdef __WIIU__
-    FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile2) {
-        fprintf(logFile2, "newFont() created font: %p\n", font);
-        fflush(logFile2);
-        fclose(logFile2);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "newFont() created font: %p", font);
 
-#ifdef __WIIU__
-    FILE* logFile_push = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile_push) {
-        fprintf(logFile_push, "newFont() - about to push font to Lua stack\n");
-        fflush(logFile_push);
-        fclose(logFile_push);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "newFont() - about to push font to Lua stack");
 
     luax_pushtype(L, font);
 
-#ifdef __WIIU__
-    FILE* logFile_release = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile_release) {
-        fprintf(logFile_release, "newFont() - about to release font\n");
-        fflush(logFile_release);
-        fclose(logFile_release);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "newFont() - about to release font");
 
     font->release();
 
-#ifdef __WIIU__
-    FILE* logFile_end = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile_end) {
-        fprintf(logFile_end, "newFont() - completed successfully\n");
-        fflush(logFile_end);
-        fclose(logFile_end);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "newFont() - completed successfully");
 
     return 1;
 }
 
 int Wrap_Graphics::print(lua_State* L)
 {
-#ifdef __WIIU__
-    static int printCount = 0;
-    printCount++;
-    if (printCount <= 5 || printCount % 60 == 0) {
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "print() called from Lua (#%d)\n", printCount);
-            fflush(logFile);
-            fclose(logFile);
-        }
-    }
-#endif
+    LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 5, 60, "print() called from Lua");
     std::vector<ColoredString> strings {};
     luax_checkcoloredstring(L, 1, strings);
 
-#ifdef __WIIU__
-    static int printDetailCount = 0;
-    printDetailCount++;
-    
-    // Enhanced logging for error handler debugging
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        bool shouldLog = false;
-        
-        // Always log first 15 prints, or prints 10-25, or error messages, or long texts
-        if (printDetailCount <= 15 || 
-            (printDetailCount > 10 && printDetailCount <= 25) ||
-            (!strings.empty() && (strings[0].string.find("Error") != std::string::npos || 
-                                 strings[0].string.find("error") != std::string::npos ||
-                                 strings[0].string.find("ERROR") != std::string::npos)) ||
-            (!strings.empty() && strings[0].string.length() > 100)) {
-            shouldLog = true;
-        }
-        
-        if (shouldLog) {
-            fprintf(logFile, "print() ENHANCED (#%d): strings.size()=%zu\n", 
-                   printDetailCount, strings.size());
-            
-            if (!strings.empty()) {
-                // For very long texts, print more to help debug
-                if (strings[0].string.length() > 300) {
-                    fprintf(logFile, "  LONG_TEXT_DETECTED: text_length=%zu\n", strings[0].string.length());
-                    fprintf(logFile, "  text_start='%.200s'\n", strings[0].string.c_str());
-                    if (strings[0].string.length() > 200) {
-                        size_t startPos = strings[0].string.length() - 200;
-                        fprintf(logFile, "  text_end='%.200s'\n", strings[0].string.substr(startPos).c_str());
-                    }
-                } else {
-                    fprintf(logFile, "  text='%.100s'\n", strings[0].string.c_str());
-                    fprintf(logFile, "  text_length=%zu\n", strings[0].string.length());
-                }
-            } else {
-                fprintf(logFile, "  text=EMPTY_STRINGS_VECTOR\n");
-            }
-            
-            // Check font status
-            FontBase* currentFont = nullptr;
-            try {
-                currentFont = instance()->getFont();
-            } catch (...) {
-                currentFont = nullptr;
-            }
-            
-            if (currentFont) {
-                fprintf(logFile, "  font=VALID_FONT_PTR(%p)\n", currentFont);
-            } else {
-                fprintf(logFile, "  font=NULL_OR_INVALID\n");
-            }
-            
-            // Check graphics state
-            bool graphicsCreated = instance()->isCreated();
-            bool graphicsActive = instance()->isActive();
-            fprintf(logFile, "  graphics_created=%s, graphics_active=%s\n", 
-                   graphicsCreated ? "true" : "false",
-                   graphicsActive ? "true" : "false");
-            
-            // Check current color
-            Color currentColor = instance()->getColor();
-            fprintf(logFile, "  color=R:%.2f G:%.2f B:%.2f A:%.2f\n", 
-                   currentColor.r, currentColor.g, currentColor.b, currentColor.a);
-        }
-        fflush(logFile);
-        fclose(logFile);
+    if (LOVE_LOG_ENABLED(TRACE, GRAPHICS) && !strings.empty())
+    {
+        const auto& text = strings[0].string;
+        LOVE_LOG_TRACE(GRAPHICS, "print() %zu string(s), text (%zu): '%.100s'", strings.size(), text.size(),
+                       text.c_str());
     }
-#endif
 
     // clang-format off
     if (luax_istype(L, 2, FontBase::type))
     {
         auto* font = luax_checkfont(L, 2);
-#ifdef __WIIU__
-        FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile2) {
-            fprintf(logFile2, "print() using explicit font: %p\n", font);
-            fflush(logFile2);
-            fclose(logFile2);
-        }
-#endif
+        LOVE_LOG_TRACE(GRAPHICS, "print() using explicit font: %p", font);
         luax_checkstandardtransform(L, 3, [&](const Matrix4& transform) {
             instance()->print(strings, font, transform);
         });
     }
     else
     {
-#ifdef __WIIU__
-        FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile2) {
-            FontBase* defaultFont = nullptr;
-            try {
-                defaultFont = instance()->getFont();
-            } catch (...) {
-                defaultFont = nullptr;
-            }
-            fprintf(logFile2, "print() using default font: %p\n", defaultFont);
-            fflush(logFile2);
-            fclose(logFile2);
-        }
-#endif
         luax_checkstandardtransform(L, 2, [&](const Matrix4& transform) {
             instance()->print(strings, transform);
         });
@@ -1851,7 +1601,7 @@ int Wrap_Graphics::getStats(lua_State* L)
     if (lua_istable(L, 1))
         lua_pushvalue(L, 1);
     else
-        lua_createtable(L, 0, 7);
+        lua_createtable(L, 0, 14);
 
     lua_pushinteger(L, stats.drawCalls);
     lua_setfield(L, -2, "drawcalls");
@@ -1859,6 +1609,27 @@ int Wrap_Graphics::getStats(lua_State* L)
     lua_pushinteger(L, stats.drawCallsBatched);
     lua_setfield(L, -2, "drawcallsbatched");
 
+    lua_pushinteger(L, stats.drawCallsMerged);
+    lua_setfield(L, -2, "drawcallsmerged");
+
+    lua_pushinteger(L, stats.drawCallsReordered);
+    lua_setfield(L, -2, "drawcallsreordered");
+
+    lua_pushinteger(L, stats.batchesMergedByReordering);
+    lua_setfield(L, -2, "batchesmergedbyreordering");
+
+    lua_pushinteger(L, stats.drawCallsCulled);
+    lua_setfield(L, -2, "drawcallsculled");
+
+    lua_pushinteger(L, stats.drawCallsIndex32);
+    lua_setfield(L, -2, "drawcallsindex32");
+
+    lua_pushinteger(L, stats.stateChanges);
+    lua_setfield(L, -2, "statechanges");
+
+    lua_pushinteger(L, stats.stateChangesSkipped);
+    lua_setfield(L, -2, "statechangesskipped");
+
     lua_pushinteger(L, stats.shaderSwitches);
     lua_setfield(L, -2, "shaderswitches");
 
@@ -1934,18 +1705,6 @@ int Wrap_Graphics::polygon(lua_State* L)
 
 int Wrap_Graphics::rectangle(lua_State* L)
 {
-#ifdef __WIIU__
-    static int rectCount = 0;
-    rectCount++;
-    if (rectCount <= 5 || rectCount % 60 == 0) {
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "rectangle() called from Lua (#%d)\n", rectCount);
-            fflush(logFile);
-            fclose(logFile);
-        }
-    }
-#endif
     Graphics::DrawMode mode;
     const char* name = luaL_checkstring(L, 1);
 
@@ -1957,19 +1716,8 @@ int Wrap_Graphics::rectangle(lua_State* L)
     float w = luaL_checknumber(L, 4);
     float h = luaL_checknumber(L, 5);
 
-#ifdef __WIIU__
-    static int rectDetailCount = 0;
-    rectDetailCount++;
-    if (rectDetailCount <= 3) {
-        FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "rectangle() details (#%d): mode='%s', x=%.1f, y=%.1f, w=%.1f, h=%.1f\n", 
-                   rectDetailCount, name, x, y, w, h);
-            fflush(logFile);
-            fclose(logFile);
-        }
-    }
-#endif
+    LOVE_LOG_SAMPLED(TRACE, GRAPHICS, 5, 60, "rectangle() mode='%s', x=%.1f, y=%.1f, w=%.1f, h=%.1f", name, x,
+                     y, w, h);
 
     if (lua_isnoneornil(L, 6))
     {
@@ -2216,6 +1964,54 @@ int Wrap_Graphics::setDefaultFilter(lua_State* L)
     return 0;
 }
 
+int Wrap_Graphics::setBatchReorderingEnabled(lua_State* L)
+{
+    bool enable = luax_checkboolean(L, 1);
+
+    luax_catchexcept(L, [&]() { instance()->setBatchReorderingEnabled(enable); });
+
+    return 0;
+}
+
+int Wrap_Graphics::isBatchReorderingEnabled(lua_State* L)
+{
+    luax_pushboolean(L, instance()->isBatchReorderingEnabled());
+
+    return 1;
+}
+
+int Wrap_Graphics::setCullingEnabled(lua_State* L)
+{
+    bool enable = luax_checkboolean(L, 1);
+
+    instance()->setCullingEnabled(enable);
+
+    return 0;
+}
+
+int Wrap_Graphics::isCullingEnabled(lua_State* L)
+{
+    luax_pushboolean(L, instance()->isCullingEnabled());
+
+    return 1;
+}
+
+int Wrap_Graphics::setTextureAtlasEnabled(lua_State* L)
+{
+    bool enable = luax_checkboolean(L, 1);
+
+    luax_catchexcept(L, [&]() { instance()->getTextureAtlas().setEnabled(enable); });
+
+    return 0;
+}
+
+int Wrap_Graphics::isTextureAtlasEnabled(lua_State* L)
+{
+    luax_pushboolean(L, instance()->getTextureAtlas().isEnabled());
+
+    return 1;
+}
+
 int Wrap_Graphics::getWidth(lua_State* L)
 {
     lua_pushinteger(L, instance()->getWidth());
@@ -2278,26 +2074,11 @@ int Wrap_Graphics::getScreens(lua_State* L)
 
 int Wrap_Graphics::getActiveScreen(lua_State* L)
 {
-#ifdef __WIIU__
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "getActiveScreen() called from Lua\n");
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "getActiveScreen() called from Lua");
     
     auto& info = love::getScreenInfo(love::currentScreen);
     
-#ifdef __WIIU__
-    FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile2) {
-        fprintf(logFile2, "getActiveScreen() - current screen: %d ('%.*s')\n", 
-               love::currentScreen, (int)info.name.size(), info.name.data());
-        fflush(logFile2);
-        fclose(logFile2);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "getActiveScreen() - current screen: %d ('%.*s')", love::currentScreen, (int)info.name.size(), info.name.data());
     
     luax_pushstring(L, info.name);
 
@@ -2306,14 +2087,7 @@ int Wrap_Graphics::getActiveScreen(lua_State* L)
 
 int Wrap_Graphics::setActiveScreen(lua_State* L)
 {
-#ifdef __WIIU__
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "setActiveScreen() called from Lua\n");
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "setActiveScreen() called from Lua");
     
     std::string name = luax_checkstring(L, 1);
     auto value       = love::getScreenId(name);
@@ -2321,26 +2095,12 @@ int Wrap_Graphics::setActiveScreen(lua_State* L)
     if (value == INVALID_SCREEN)
         return luaL_error(L, "Invalid screen '%s'", name.c_str());
 
-#ifdef __WIIU__
-    FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile2) {
-        fprintf(logFile2, "setActiveScreen() - setting screen '%s' to: %d\n", name.c_str(), value);
-        fflush(logFile2);
-        fclose(logFile2);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "setActiveScreen() - setting screen '%s' to: %d", name.c_str(), value);
 
     love::currentScreen = value;
     instance()->setActiveScreen();
 
-#ifdef __WIIU__
-    FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile3) {
-        fprintf(logFile3, "setActiveScreen() completed\n");
-        fflush(logFile3);
-        fclose(logFile3);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "setActiveScreen() completed");
 
     return 0;
 }
@@ -2472,6 +2232,12 @@ static constexpr luaL_Reg functions[] =
     { "getPixelDimensions",     Wrap_Graphics::getPixelDimensions    },
 
     { "setDefaultFilter",       Wrap_Graphics::setDefaultFilter      },
+    { "setTextureAtlasEnabled", Wrap_Graphics::setTextureAtlasEnabled },
+    { "isTextureAtlasEnabled",  Wrap_Graphics::isTextureAtlasEnabled  },
+    { "setBatchReorderingEnabled", Wrap_Graphics::setBatchReorderingEnabled },
+    { "isBatchReorderingEnabled",  Wrap_Graphics::isBatchReorderingEnabled  },
+    { "setCullingEnabled",      Wrap_Graphics::setCullingEnabled     },
+    { "isCullingEnabled",       Wrap_Graphics::isCullingEnabled      },
     { "getDefaultFilter",       Wrap_Graphics::getDefaultFilter      },
 
     { "setShader",              Wrap_Graphics::setShader             },
@@ -2479,6 +2245,7 @@ static constexpr luaL_Reg functions[] =
     // { "newShader",              Wrap_Graphics::newShader             }, // DISABLED - causing problems
 
     { "draw",                   Wrap_Graphics::draw                  },
+    { "drawInstanced",          Wrap_Graphics::drawInstanced         },
 
     { "polygon",                Wrap_Graphics::polygon               },
     { "rectangle",              Wrap_Graphics::rectangle             },
@@ -2501,6 +2268,7 @@ static constexpr luaL_Reg functions[] =
     { "newTextBatch",           Wrap_Graphics::newTextBatch          },
     { "newText",                Wrap_Graphics::newText               },
     { "newSpriteBatch",         Wrap_Graphics::newSpriteBatch        },
+    { "newMesh",                Wrap_Graphics::newMesh               },
 
     { "newFont",                Wrap_Graphics::newFont               },
     { "setFont",                Wrap_Graphics::setFont               },
@@ -2520,118 +2288,23 @@ static int open_drawable(lua_State* L)
     return luax_register_type(L, &Drawable::type);
 }
 
-// Shader functions array
-// Shader wrapper functions
-static int w_Shader_send(lua_State* L)
-{
-    return 0;  // Minimal implementation
-}
-
-static int w_Shader_hasUniform(lua_State* L)
-{
-    lua_pushboolean(L, true);  // Always return true
-    return 1;
-}
-
-static int w_Shader_getWarnings(lua_State* L)
-{
-    lua_pushstring(L, "");  // Return empty string
-    return 1;
-}
-
-#ifdef __WIIU__
-// Debug function to log shader_functions registration
-void debug_shader_functions()
-{
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "[WII U DEBUG] === SHADER FUNCTIONS DEBUG ===\n");
-        fprintf(logFile, "[WII U DEBUG] w_Shader_send address: %p\n", w_Shader_send);
-        fprintf(logFile, "[WII U DEBUG] w_Shader_hasUniform address: %p\n", w_Shader_hasUniform);  
-        fprintf(logFile, "[WII U DEBUG] w_Shader_getWarnings address: %p\n", w_Shader_getWarnings);
-        fflush(logFile);
-        fclose(logFile);
-    }
-}
-#endif
-
-static constexpr luaL_Reg shader_functions[] = {
-    { "send", w_Shader_send },
-    { "hasUniform", w_Shader_hasUniform },
-    { "getWarnings", w_Shader_getWarnings },
-    { 0, 0 }
-};
-
-int open_shader(lua_State* L)
-{
-#ifdef __WIIU__
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "[WII U DEBUG] open_shader() - implementing minimal shader system\n");
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
-
-    try {
-        // Create a minimal shader table with basic functionality
-        lua_newtable(L);
-        
-        // Register basic shader functions to the table manually (Lua 5.1 compatible)
-        for (int i = 0; shader_functions[i].name != nullptr; i++)
-        {
-            lua_pushstring(L, shader_functions[i].name);
-            lua_pushcfunction(L, shader_functions[i].func);
-            lua_settable(L, -3);
-        }
-        
-#ifdef __WIIU__
-        logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "[WII U DEBUG] open_shader() - minimal shader functions registered successfully\n");
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
-
-        return 1;
-    }
-    catch (...) {
-#ifdef __WIIU__
-        logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "[WII U DEBUG] open_shader() - ERROR: exception caught!\n");
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
-        return 0;
-    }
-}
-
 static constexpr lua_CFunction types[] =
 {
     open_drawable,
-    // open_shader,  // DISABLED - causing problems with love.graphics
+    love::open_shader,
     love::open_texture,
     love::open_quad,
     love::open_font,
     love::open_textbatch,
     love::open_spritebatch,
+    love::open_mesh,
     love::open_video
 };
 // clang-format on
 
 int Wrap_Graphics::open(lua_State* L)
 {
-#ifdef __WIIU__
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "[WII U DEBUG] Wrap_Graphics::open() called - starting graphics module registration\n");
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "Wrap_Graphics::open() called - starting graphics module registration");
 
     auto* instance = instance();
     if (instance == nullptr)
@@ -2639,14 +2312,7 @@ int Wrap_Graphics::open(lua_State* L)
     else
         instance->retain();
 
-#ifdef __WIIU__
-    logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "[WII U DEBUG] Wrap_Graphics::open() - graphics instance created/retained: %p\n", instance);
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "Wrap_Graphics::open() - graphics instance created/retained: %p", instance);
 
     WrappedModule module {};
     module.instance          = instance;
@@ -2656,25 +2322,11 @@ int Wrap_Graphics::open(lua_State* L)
     module.platformFunctions = platformFunctions;
     module.types             = types;
 
-#ifdef __WIIU__
-    logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "[WII U DEBUG] Wrap_Graphics::open() - about to call luax_register_module\n");
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "Wrap_Graphics::open() - about to call luax_register_module");
 
     int result = luax_register_module(L, module);
 
-#ifdef __WIIU__
-    logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "[WII U DEBUG] Wrap_Graphics::open() - luax_register_module returned: %d\n", result);
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
+    LOVE_LOG_TRACE(GRAPHICS, "Wrap_Graphics::open() - luax_register_module returned: %d", result);
 
     return result;
 }
@@ -2898,14 +2550,7 @@ int Wrap_Graphics::newShader(lua_State* L)
     std::vector<std::string> filepaths;
     ShaderBase::CompileOptions options;
     
-    // Debug: Log shader creation at Lua wrapper level
-    const std::string logPath = "/vol/content/simple_debug.log";
-    std::ofstream debugFile(logPath, std::ios::app);
-    if (debugFile.is_open())
-    {
-        debugFile << "[DEBUG] Wrap_Graphics::newShader() - Lua wrapper called with " << lua_gettop(L) << " arguments" << std::endl;
-        debugFile.close();
-    }
+    LOVE_LOG_DEBUG(SHADER, "newShader() called with %d arguments", lua_gettop(L));
     
     // Handle different argument patterns:
     // newShader(vertexCode, fragmentCode) - string codes
@@ -2916,25 +2561,14 @@ int Wrap_Graphics::newShader(lua_State* L)
     {
         const char* code1 = luaL_checkstring(L, 1);
         
-        // Debug: Log shader paths/code
-        std::ofstream debugFile2(logPath, std::ios::app);
-        if (debugFile2.is_open())
-        {
-            debugFile2 << "[DEBUG] Wrap_Graphics::newShader() - First argument: " << std::string(code1) << std::endl;
-            debugFile2.close();
-        }
+        LOVE_LOG_DEBUG(SHADER, "newShader() first argument: %.200s", code1);
         
         if (lua_gettop(L) >= 2 && lua_type(L, 2) == LUA_TSTRING)
         {
             // Two strings: vertex and fragment code/files
             const char* code2 = luaL_checkstring(L, 2);
             
-            std::ofstream debugFile3(logPath, std::ios::app);
-            if (debugFile3.is_open())
-            {
-                debugFile3 << "[DEBUG] Wrap_Graphics::newShader() - Second argument: " << std::string(code2) << std::endl;
-                debugFile3.close();
-            }
+            LOVE_LOG_DEBUG(SHADER, "newShader() second argument: %.200s", code2);
             
             filepaths.push_back(std::string(code1));
             filepaths.push_back(std::string(code2));
@@ -2952,21 +2586,11 @@ int Wrap_Graphics::newShader(lua_State* L)
     
     ShaderBase* shader = nullptr;
     luax_catchexcept(L, [&]() {
-        std::ofstream debugFile4(logPath, std::ios::app);
-        if (debugFile4.is_open())
-        {
-            debugFile4 << "[DEBUG] Wrap_Graphics::newShader() - About to call graphics->newShader() with " << filepaths.size() << " file paths" << std::endl;
-            debugFile4.close();
-        }
+        LOVE_LOG_DEBUG(SHADER, "newShader() creating shader from %zu file path(s)", filepaths.size());
         
         shader = graphics->newShader(filepaths, options);
         
-        std::ofstream debugFile5(logPath, std::ios::app);
-        if (debugFile5.is_open())
-        {
-            debugFile5 << "[DEBUG] Wrap_Graphics::newShader() - graphics->newShader() returned shader pointer: " << (void*)shader << std::endl;
-            debugFile5.close();
-        }
+        LOVE_LOG_DEBUG(SHADER, "newShader() created shader %p", (void*)shader);
     });
     
     luax_pushtype(L, shader);
@@ -3,151 +3,331 @@
 
 using namespace love;
 
-MeshBase* love::luax_checkmesh(lua_State* L, int idx)
+int Wrap_Mesh::setVertices(lua_State* L)
 {
-    return luax_checktype<MeshBase>(L, idx);
+    auto* self = luax_checkmesh(L, 1);
+
+    auto vertices = luax_checkmeshvertices(L, 2);
+
+    if (lua_isnoneornil(L, 3))
+        luax_catchexcept(L, [&]() { self->setVertices(vertices); });
+    else
+    {
+        size_t start = luaL_checkinteger(L, 3) - 1;
+        luax_catchexcept(L, [&]() { self->setVertices(vertices, start); });
+    }
+
+    return 0;
 }
 
-int Wrap_Mesh::setVertices(lua_State* L)
+int Wrap_Mesh::setVertex(lua_State* L)
 {
-    MeshBase* mesh = luax_checkmesh(L, 1);
-    
-    if (!lua_istable(L, 2))
-        return luaL_error(L, "Expected table for vertices");
-    
-    std::vector<Vertex> vertices;
-    size_t count = luax_objlen(L, 2);
-    
-    for (size_t i = 1; i <= count; i++)
+    auto* self   = luax_checkmesh(L, 1);
+    size_t index = luaL_checkinteger(L, 2) - 1;
+
+    XYf_STf_RGBAf vertex {};
+
+    if (lua_istable(L, 3))
+        vertex = luax_checkmeshvertex(L, 3);
+    else
     {
-        lua_rawgeti(L, 2, i);
-        
-        if (!lua_istable(L, -1))
-        {
-            lua_pop(L, 1);
-            return luaL_error(L, "Each vertex must be a table");
-        }
-        
-        Vertex vertex = {};
-        
-        // Get position (required)
-        lua_rawgeti(L, -1, 1);
-        lua_rawgeti(L, -2, 2);
-        vertex.x = (float)luaL_checknumber(L, -2);
-        vertex.y = (float)luaL_checknumber(L, -1);
-        lua_pop(L, 2);
-        
-        // Get texture coordinates (optional)
-        lua_rawgeti(L, -1, 3);
-        lua_rawgeti(L, -2, 4);
-        if (!lua_isnil(L, -2) && !lua_isnil(L, -1))
-        {
-            vertex.s = (float)luaL_checknumber(L, -2);
-            vertex.t = (float)luaL_checknumber(L, -1);
-        }
-        lua_pop(L, 2);
-        
-        // Get color (optional)
-        lua_rawgeti(L, -1, 5);
-        lua_rawgeti(L, -2, 6);
-        lua_rawgeti(L, -3, 7);
-        lua_rawgeti(L, -4, 8);
-        if (!lua_isnil(L, -4))
-        {
-            vertex.color.r = (float)luaL_checknumber(L, -4);
-            vertex.color.g = (float)luaL_checknumber(L, -3);
-            vertex.color.b = (float)luaL_checknumber(L, -2);
-            vertex.color.a = (float)luaL_optnumber(L, -1, 1.0);
-        }
-        else
-        {
-            vertex.color.r = vertex.color.g = vertex.color.b = vertex.color.a = 1.0f;
-        }
-        lua_pop(L, 4);
-        
-        vertices.push_back(vertex);
-        lua_pop(L, 1);
+        vertex.x     = luaL_checknumber(L, 3);
+        vertex.y     = luaL_checknumber(L, 4);
+        vertex.s     = luaL_optnumber(L, 5, 0.0);
+        vertex.t     = luaL_optnumber(L, 6, 0.0);
+        vertex.color = Color(luaL_optnumber(L, 7, 1.0), luaL_optnumber(L, 8, 1.0),
+                             luaL_optnumber(L, 9, 1.0), luaL_optnumber(L, 10, 1.0));
     }
-    
-    mesh->setVertices(vertices);
+
+    luax_catchexcept(L, [&]() { self->setVertex(index, vertex); });
+
     return 0;
 }
 
+int Wrap_Mesh::getVertex(lua_State* L)
+{
+    auto* self   = luax_checkmesh(L, 1);
+    size_t index = luaL_checkinteger(L, 2) - 1;
+
+    XYf_STf_RGBAf vertex {};
+    luax_catchexcept(L, [&]() { vertex = self->getVertex(index); });
+
+    lua_pushnumber(L, vertex.x);
+    lua_pushnumber(L, vertex.y);
+    lua_pushnumber(L, vertex.s);
+    lua_pushnumber(L, vertex.t);
+    lua_pushnumber(L, vertex.color.r);
+    lua_pushnumber(L, vertex.color.g);
+    lua_pushnumber(L, vertex.color.b);
+    lua_pushnumber(L, vertex.color.a);
+
+    return 8;
+}
+
 int Wrap_Mesh::getVertexCount(lua_State* L)
 {
-    MeshBase* mesh = luax_checkmesh(L, 1);
-    lua_pushinteger(L, mesh->getVertexCount());
+    auto* self = luax_checkmesh(L, 1);
+    lua_pushinteger(L, self->getVertexCount());
+
     return 1;
 }
 
-int Wrap_Mesh::setTexture(lua_State* L)
+int Wrap_Mesh::setVertexMap(lua_State* L)
 {
-    MeshBase* mesh = luax_checkmesh(L, 1);
-    
-    if (lua_isnil(L, 2))
+    auto* self = luax_checkmesh(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+    {
+        self->setVertexMap();
+        return 0;
+    }
+
+    std::vector<uint32_t> map {};
+
+    if (lua_istable(L, 2))
     {
-        mesh->setTexture(nullptr);
+        size_t count = luax_objlen(L, 2);
+        map.reserve(count);
+
+        for (size_t index = 0; index < count; index++)
+        {
+            lua_rawgeti(L, 2, index + 1);
+            map.push_back((uint32_t)(luaL_checkinteger(L, -1) - 1));
+            lua_pop(L, 1);
+        }
     }
     else
     {
-        TextureBase* texture = luax_checktexture(L, 2);
-        mesh->setTexture(texture);
+        int count = lua_gettop(L) - 1;
+        map.reserve(count);
+
+        for (int index = 0; index < count; index++)
+            map.push_back((uint32_t)(luaL_checkinteger(L, index + 2) - 1));
     }
-    
+
+    luax_catchexcept(L, [&]() { self->setVertexMap(map); });
+
     return 0;
 }
 
-int Wrap_Mesh::getTexture(lua_State* L)
+int Wrap_Mesh::getVertexMap(lua_State* L)
 {
-    MeshBase* mesh = luax_checkmesh(L, 1);
-    TextureBase* texture = mesh->getTexture();
-    
-    if (texture)
-        luax_pushtype(L, texture);
-    else
+    auto* self = luax_checkmesh(L, 1);
+
+    const auto& map = self->getVertexMap();
+
+    if (map.empty())
+    {
         lua_pushnil(L);
-    
+        return 1;
+    }
+
+    lua_createtable(L, (int)map.size(), 0);
+
+    for (size_t index = 0; index < map.size(); index++)
+    {
+        lua_pushinteger(L, (lua_Integer)map[index] + 1);
+        lua_rawseti(L, -2, index + 1);
+    }
+
+    return 1;
+}
+
+int Wrap_Mesh::flush(lua_State* L)
+{
+    auto* self = luax_checkmesh(L, 1);
+    luax_catchexcept(L, [&]() { self->flush(); });
+
+    return 0;
+}
+
+int Wrap_Mesh::setTexture(lua_State* L)
+{
+    auto* self = luax_checkmesh(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+        self->setTexture(nullptr);
+    else
+        self->setTexture(luax_checktexture(L, 2));
+
+    return 0;
+}
+
+int Wrap_Mesh::getTexture(lua_State* L)
+{
+    auto* self    = luax_checkmesh(L, 1);
+    auto* texture = self->getTexture();
+
+    if (texture == nullptr)
+        return 0;
+
+    luax_pushtype(L, texture);
+
     return 1;
 }
 
 int Wrap_Mesh::setDrawMode(lua_State* L)
 {
-    MeshBase* mesh = luax_checkmesh(L, 1);
-    const char* str = luaL_checkstring(L, 2);
-    
+    auto* self       = luax_checkmesh(L, 1);
+    const char* name = luaL_checkstring(L, 2);
+
     MeshBase::DrawMode mode;
-    if (!MeshBase::getConstant(str, mode))
-        return luaL_error(L, "Invalid draw mode: %s", str);
-    
-    mesh->setDrawMode(mode);
+    if (!MeshBase::getConstant(name, mode))
+        return luax_enumerror(L, "mesh draw mode", name);
+
+    self->setDrawMode(mode);
+
     return 0;
 }
 
 int Wrap_Mesh::getDrawMode(lua_State* L)
 {
-    MeshBase* mesh = luax_checkmesh(L, 1);
-    MeshBase::DrawMode mode = mesh->getDrawMode();
-    
-    const char* str;
-    if (!MeshBase::getConstant(mode, str))
-        return luaL_error(L, "Unknown draw mode");
-    
-    lua_pushstring(L, str);
+    auto* self = luax_checkmesh(L, 1);
+
+    const char* name = nullptr;
+    if (!MeshBase::getConstant(self->getDrawMode(), name))
+        return luaL_error(L, "Unknown mesh draw mode.");
+
+    lua_pushstring(L, name);
+
+    return 1;
+}
+
+int Wrap_Mesh::setDrawRange(lua_State* L)
+{
+    auto* self = luax_checkmesh(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+        self->setDrawRange();
+    else
+    {
+        int start = luaL_checkinteger(L, 2) - 1;
+        int count = luaL_checkinteger(L, 3);
+
+        luax_catchexcept(L, [&]() { self->setDrawRange(start, count); });
+    }
+
+    return 0;
+}
+
+int Wrap_Mesh::getDrawRange(lua_State* L)
+{
+    auto* self = luax_checkmesh(L, 1);
+
+    int start = 0;
+    int count = 0;
+
+    if (!self->getDrawRange(start, count))
+        return 0;
+
+    lua_pushinteger(L, start + 1);
+    lua_pushinteger(L, count);
+
+    return 2;
+}
+
+int Wrap_Mesh::attachAttribute(lua_State* L)
+{
+    auto* self        = luax_checkmesh(L, 1);
+    const char* name  = luaL_checkstring(L, 2);
+    auto* mesh        = luax_checkmesh(L, 3);
+    const char* value = luaL_optstring(L, 4, "perinstance");
+
+    MeshBase::AttributeStep step;
+    if (!MeshBase::getConstant(value, step))
+        return luax_enumerror(L, "vertex attribute step", MeshBase::AttributeSteps, value);
+
+    luax_catchexcept(L, [&]() { self->attachAttribute(name, mesh, step); });
+
+    return 0;
+}
+
+int Wrap_Mesh::detachAttribute(lua_State* L)
+{
+    auto* self       = luax_checkmesh(L, 1);
+    const char* name = luaL_checkstring(L, 2);
+
+    bool success = false;
+    luax_catchexcept(L, [&]() { success = self->detachAttribute(name); });
+
+    lua_pushboolean(L, success);
+
     return 1;
 }
 
+// clang-format off
 static constexpr luaL_Reg functions[] =
 {
-    { "setVertices",    Wrap_Mesh::setVertices    },
-    { "getVertexCount", Wrap_Mesh::getVertexCount },
-    { "setTexture",     Wrap_Mesh::setTexture     },
-    { "getTexture",     Wrap_Mesh::getTexture     },
-    { "setDrawMode",    Wrap_Mesh::setDrawMode    },
-    { "getDrawMode",    Wrap_Mesh::getDrawMode    },
-    { nullptr,          nullptr                   }
+    { "setVertices",     Wrap_Mesh::setVertices     },
+    { "setVertex",       Wrap_Mesh::setVertex       },
+    { "getVertex",       Wrap_Mesh::getVertex       },
+    { "getVertexCount",  Wrap_Mesh::getVertexCount  },
+    { "setVertexMap",    Wrap_Mesh::setVertexMap    },
+    { "getVertexMap",    Wrap_Mesh::getVertexMap    },
+    { "flush",           Wrap_Mesh::flush           },
+    { "setTexture",      Wrap_Mesh::setTexture      },
+    { "getTexture",      Wrap_Mesh::getTexture      },
+    { "setDrawMode",     Wrap_Mesh::setDrawMode     },
+    { "getDrawMode",     Wrap_Mesh::getDrawMode     },
+    { "setDrawRange",    Wrap_Mesh::setDrawRange    },
+    { "getDrawRange",    Wrap_Mesh::getDrawRange    },
+    { "attachAttribute", Wrap_Mesh::attachAttribute },
+    { "detachAttribute", Wrap_Mesh::detachAttribute }
 };
+// clang-format on
 
-int love::open_mesh(lua_State* L)
+namespace love
 {
-    return luax_register_type(L, &MeshBase::type, functions);
-}
+    MeshBase* luax_checkmesh(lua_State* L, int index)
+    {
+        return luax_checktype<MeshBase>(L, index);
+    }
+
+    XYf_STf_RGBAf luax_checkmeshvertex(lua_State* L, int index)
+    {
+        luaL_checktype(L, index, LUA_TTABLE);
+
+        /* relative indices move as the fields are pushed */
+        if (index < 0 && index > LUA_REGISTRYINDEX)
+            index += lua_gettop(L) + 1;
+
+        for (int field = 1; field <= 8; field++)
+            lua_rawgeti(L, index, field);
+
+        XYf_STf_RGBAf vertex {};
+        vertex.x     = luaL_checknumber(L, -8);
+        vertex.y     = luaL_checknumber(L, -7);
+        vertex.s     = luaL_optnumber(L, -6, 0.0);
+        vertex.t     = luaL_optnumber(L, -5, 0.0);
+        vertex.color = Color(luaL_optnumber(L, -4, 1.0), luaL_optnumber(L, -3, 1.0),
+                             luaL_optnumber(L, -2, 1.0), luaL_optnumber(L, -1, 1.0));
+
+        lua_pop(L, 8);
+
+        return vertex;
+    }
+
+    std::vector<XYf_STf_RGBAf> luax_checkmeshvertices(lua_State* L, int index)
+    {
+        luaL_checktype(L, index, LUA_TTABLE);
+
+        size_t count = luax_objlen(L, index);
+
+        std::vector<XYf_STf_RGBAf> vertices {};
+        vertices.reserve(count);
+
+        for (size_t vertex = 0; vertex < count; vertex++)
+        {
+            lua_rawgeti(L, index, vertex + 1);
+            vertices.push_back(luax_checkmeshvertex(L, -1));
+            lua_pop(L, 1);
+        }
+
+        return vertices;
+    }
+
+    int open_mesh(lua_State* L)
+    {
+        return luax_register_type(L, &MeshBase::type, functions);
+    }
+} // namespace love
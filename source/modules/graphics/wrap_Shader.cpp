@@ -1,54 +1,162 @@
-#include <modules/graphics/wrap_Shader.hpp>
-#include <common/luax.hpp>
-#include <modules/graphics/Shader.hpp>
+#include "modules/graphics/wrap_Shader.hpp"
+#include "modules/graphics/Shader.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 using namespace love;
 
-ShaderBase* Wrap_Shader::CheckShader(lua_State* L, int index)
+/* converts one Lua number or boolean to the 32-bit representation of `type` */
+static uint32_t checkUniformValue(lua_State* L, int index, ShaderBase::UniformType type)
 {
-#ifdef __WIIU__
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "[WII U DEBUG] Wrap_Shader::CheckShader() CALLED with index=%d\n", index);
-        fprintf(logFile, "[WII U DEBUG] Lua state: %p\n", L);
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
-
-    try {
-        ShaderBase* result = luax_checktype<ShaderBase>(L, index);
-        
-#ifdef __WIIU__
-        FILE* logFile2 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile2) {
-            fprintf(logFile2, "[WII U DEBUG] Wrap_Shader::CheckShader() - luax_checktype returned: %p\n", result);
-            fflush(logFile2);
-            fclose(logFile2);
+    uint32_t result = 0;
+
+    switch (type)
+    {
+        case ShaderBase::UNIFORM_INT:
+        {
+            int32_t value = (int32_t)luaL_checkinteger(L, index);
+            std::memcpy(&result, &value, sizeof(value));
+            break;
         }
-#endif
-
-        return result;
-        
-    } catch (const std::exception& e) {
-#ifdef __WIIU__
-        FILE* logFile3 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile3) {
-            fprintf(logFile3, "[WII U DEBUG] Wrap_Shader::CheckShader() - EXCEPTION: %s\n", e.what());
-            fflush(logFile3);
-            fclose(logFile3);
+        case ShaderBase::UNIFORM_UINT:
+            result = (uint32_t)luaL_checkinteger(L, index);
+            break;
+        case ShaderBase::UNIFORM_BOOL:
+            result = luax_toboolean(L, index) ? 1 : 0;
+            break;
+        default:
+        {
+            float value = (float)luaL_checknumber(L, index);
+            std::memcpy(&result, &value, sizeof(value));
+            break;
+        }
+    }
+
+    return result;
+}
+
+/*
+** Reads one element at `index`: a number (or boolean) for scalars, a table
+** of components for vectors, and for matrices either a table of rows or a
+** flat table in row-major order. Written out column by column.
+*/
+static void checkUniformElement(lua_State* L, int index, const ShaderBase::UniformInfo* info,
+                                uint32_t* out)
+{
+    const int components = info->components;
+    const int columns    = info->columns;
+
+    if (components == 1 && columns == 1 && !lua_istable(L, index))
+    {
+        out[0] = checkUniformValue(L, index, info->type);
+        return;
+    }
+
+    luaL_checktype(L, index, LUA_TTABLE);
+
+    if (columns == 1)
+    {
+        for (int component = 0; component < components; component++)
+        {
+            lua_rawgeti(L, index, component + 1);
+            out[component] = checkUniformValue(L, -1, info->type);
+            lua_pop(L, 1);
         }
-#endif
-        throw;
-    } catch (...) {
-#ifdef __WIIU__
-        FILE* logFile4 = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile4) {
-            fprintf(logFile4, "[WII U DEBUG] Wrap_Shader::CheckShader() - UNKNOWN EXCEPTION\n");
-            fflush(logFile4);
-            fclose(logFile4);
+
+        return;
+    }
+
+    lua_rawgeti(L, index, 1);
+    const bool nested = lua_istable(L, -1);
+    lua_pop(L, 1);
+
+    for (int row = 0; row < components; row++)
+    {
+        if (nested)
+            lua_rawgeti(L, index, row + 1);
+
+        for (int column = 0; column < columns; column++)
+        {
+            if (nested)
+                lua_rawgeti(L, -1, column + 1);
+            else
+                lua_rawgeti(L, index, row * columns + column + 1);
+
+            out[column * components + row] = checkUniformValue(L, -1, info->type);
+            lua_pop(L, 1);
         }
-#endif
-        throw;
+
+        if (nested)
+            lua_pop(L, 1);
     }
 }
+
+int Wrap_Shader::send(lua_State* L)
+{
+    auto* self       = luax_checkshader(L, 1);
+    const char* name = luaL_checkstring(L, 2);
+
+    const auto* info = self->getUniformInfo(name);
+
+    if (info == nullptr || !info->active)
+        return luaL_error(L, "Shader uniform '%s' does not exist.\n"
+                             "A common error is to define but not use the variable.", name);
+
+    if (info->components == 0)
+        return luaL_error(L, "Shader uniform '%s' can not be set with Shader:send.", name);
+
+    const int count         = std::max(lua_gettop(L) - 2, 1);
+    const int elementValues = info->components * info->columns;
+
+    std::vector<uint32_t> values(count * elementValues);
+
+    for (int element = 0; element < count; element++)
+        checkUniformElement(L, element + 3, info, values.data() + element * elementValues);
+
+    luax_catchexcept(L, [&]() { self->sendUniform(info, values.data(), count); });
+
+    return 0;
+}
+
+int Wrap_Shader::hasUniform(lua_State* L)
+{
+    auto* self       = luax_checkshader(L, 1);
+    const char* name = luaL_checkstring(L, 2);
+
+    luax_pushboolean(L, self->hasUniform(name));
+
+    return 1;
+}
+
+int Wrap_Shader::getWarnings(lua_State* L)
+{
+    auto* self = luax_checkshader(L, 1);
+
+    luax_pushstring(L, ((Shader*)self)->getWarnings());
+
+    return 1;
+}
+
+// clang-format off
+static constexpr luaL_Reg functions[] =
+{
+    { "send",        Wrap_Shader::send        },
+    { "hasUniform",  Wrap_Shader::hasUniform  },
+    { "getWarnings", Wrap_Shader::getWarnings }
+};
+// clang-format on
+
+namespace love
+{
+    ShaderBase* luax_checkshader(lua_State* L, int index)
+    {
+        return luax_checktype<ShaderBase>(L, index);
+    }
+
+    int open_shader(lua_State* L)
+    {
+        return luax_register_type(L, &ShaderBase::type, functions);
+    }
+} // namespace love
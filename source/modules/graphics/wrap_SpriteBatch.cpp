@@ -183,6 +183,24 @@ int Wrap_SpriteBatch::getDrawRange(lua_State* L)
     return 2;
 }
 
+int Wrap_SpriteBatch::setSpatialIndexEnabled(lua_State* L)
+{
+    auto* self  = luax_checkspritebatch(L, 1);
+    bool enable = luax_checkboolean(L, 2);
+
+    luax_catchexcept(L, [&]() { self->setSpatialIndexEnabled(enable); });
+
+    return 0;
+}
+
+int Wrap_SpriteBatch::isSpatialIndexEnabled(lua_State* L)
+{
+    auto* self = luax_checkspritebatch(L, 1);
+    luax_pushboolean(L, self->isSpatialIndexEnabled());
+
+    return 1;
+}
+
 // clang-format off
 static constexpr luaL_Reg functions[] =
 {
@@ -199,7 +217,9 @@ static constexpr luaL_Reg functions[] =
     { "getCount",      Wrap_SpriteBatch::getCount      },
     { "getBufferSize", Wrap_SpriteBatch::getBufferSize },
     { "setDrawRange",  Wrap_SpriteBatch::setDrawRange  },
-    { "getDrawRange",  Wrap_SpriteBatch::getDrawRange  }
+    { "getDrawRange",  Wrap_SpriteBatch::getDrawRange  },
+    { "setSpatialIndexEnabled", Wrap_SpriteBatch::setSpatialIndexEnabled },
+    { "isSpatialIndexEnabled",  Wrap_SpriteBatch::isSpatialIndexEnabled  }
 };
 // clang-format on
 
@@ -1,3 +1,4 @@
+#include "common/Logger.hpp"
 #include "driver/EventQueue.hpp"
 
 #include "modules/joystick/JoystickModule.hpp"
@@ -7,30 +8,14 @@ namespace love
     JoystickModule::JoystickModule() : Module(M_JOYSTICK, "love.joystick")
     {
         int joystickCount = joystick::getJoystickCount();
-        
-        // Use a simple file write for debug since printf might not show up
-        FILE* debugFile = fopen("joystick_debug.txt", "w");
-        if (debugFile) {
-            fprintf(debugFile, "JoystickModule: Detected %d joystick(s)\n", joystickCount);
-            fclose(debugFile);
-        }
-        
+        LOVE_LOG_DEBUG(INPUT, "Detected %d joystick(s)", joystickCount);
+
         for (size_t index = 0; index < (size_t)joystickCount; index++)
         {
-            debugFile = fopen("joystick_debug.txt", "a");
-            if (debugFile) {
-                fprintf(debugFile, "JoystickModule: Adding joystick %zu\n", index);
-                fclose(debugFile);
-            }
-            
             this->addJoystick(index);
             EventQueue::getInstance().sendJoystickStatus(true, index);
-            
-            debugFile = fopen("joystick_debug.txt", "a");
-            if (debugFile) {
-                fprintf(debugFile, "JoystickModule: Successfully added joystick %zu\n", index);
-                fclose(debugFile);
-            }
+
+            LOVE_LOG_DEBUG(INPUT, "Added joystick %zu", index);
         }
     }
 
@@ -1,3 +1,4 @@
+#include "common/Logger.hpp"
 #include "common/luax.hpp"
 #include "common/version.hpp"
 
@@ -174,6 +175,23 @@ static int love_hasOSSpeedup(lua_State* L)
 }
 #endif
 
+/*
+** love._log(level, message)
+** Lets the embedded Lua scripts write to the engine log.
+*/
+static int love_log(lua_State* L)
+{
+    static constexpr const char* levels[] = { "trace", "debug", "info", "warn", "error", nullptr };
+
+    const auto level     = (love::Logger::Level)luaL_checkoption(L, 1, nullptr, levels);
+    const char* message = luaL_checkstring(L, 2);
+
+    if (level >= LOVE_LOG_LEVEL && love::Logger::isEnabled(level, love::Logger::CATEGORY_LUA))
+        love::Logger::write(level, love::Logger::CATEGORY_LUA, "%s", message);
+
+    return 0;
+}
+
 static constexpr const char* ERROR_PANIC = "PANIC: unprotected error in call to Lua API (%s)";
 
 /*
@@ -213,36 +231,15 @@ static void luax_addcompatibilityalias(lua_State* L, const char* module, const c
 
 int love_initialize(lua_State* L)
 {
-#ifdef __WIIU__
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "[WII U DEBUG] love_initialize() - starting module preloading\n");
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
+    LOVE_LOG_DEBUG(CORE, "love_initialize() - preloading modules");
 
     for (auto& module : modules)
     {
-#ifdef __WIIU__
-        logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-        if (logFile) {
-            fprintf(logFile, "[WII U DEBUG] love_initialize() - preloading module: %s\n", module.name);
-            fflush(logFile);
-            fclose(logFile);
-        }
-#endif
+        LOVE_LOG_TRACE(CORE, "love_initialize() - preloading module: %s", module.name);
         love::luax_preload(L, module.func, module.name);
     }
 
-#ifdef __WIIU__
-    logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile) {
-        fprintf(logFile, "[WII U DEBUG] love_initialize() - all modules preloaded\n");
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
+    LOVE_LOG_DEBUG(CORE, "love_initialize() - all modules preloaded");
 
     love::luax_insistpinnedthread(L);
     love::luax_insistglobal(L, "love");
@@ -265,6 +262,9 @@ int love_initialize(lua_State* L)
     lua_pushcfunction(L, love_openConsole);
     lua_setfield(L, -2, "_openConsole");
 
+    lua_pushcfunction(L, love_log);
+    lua_setfield(L, -2, "_log");
+
     lua_register(L, "print", love_print);
 
     lua_newtable(L);
@@ -430,24 +430,8 @@ int love_print(lua_State* L)
     }
 
     std::printf("[LOVE] %s\r\n", result.c_str());
-    
-#ifdef __WIIU__
-    // Also log to file for debugging
-    FILE* logFile = fopen("fs:/vol/external01/simple_debug.log", "a");
-    if (logFile == nullptr) {
-        logFile = fopen("/vol/external01/simple_debug.log", "a");
-    }
-    if (logFile == nullptr) {
-        logFile = fopen("simple_debug.log", "a");
-    }
-    
-    if (logFile != nullptr) {
-        fprintf(logFile, "[LOVE] %s\n", result.c_str());
-        fflush(logFile);
-        fclose(logFile);
-    }
-#endif
-    
+    LOVE_LOG_INFO(LUA, "%s", result.c_str());
+
     return 0;
 }
 
@@ -258,127 +258,31 @@ end
 
 local utf8 = require("utf8")
 
+local function log(level, message)
+    if love._log then
+        love._log(level, message)
+    end
+end
+
 local function error_printer(msg, layer)
     -- Get the full traceback immediately
     local trace = debug.traceback("Error: " .. tostring(msg), 1 + (layer or 1))
+    log("error", tostring(trace))
     
-    -- Add Wii U specific logging for error_printer
-    if love._console_name == "cafe" then
-        local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-        if logFile then
-            logFile:write("=== ERROR_PRINTER DETAILED LOG ===\n")
-            logFile:write("Raw message: " .. tostring(msg) .. "\n")
-            logFile:write("Layer: " .. tostring(layer) .. "\n")
-            logFile:write("Full trace with context:\n" .. tostring(trace) .. "\n")
-            logFile:write("================================\n")
-            logFile:flush()
-            logFile:close()
-        end
-    end
-    
-    -- Print to console (this may or may not work depending on system state)
     print(trace:gsub("\n[^\n]+$", ""))
-    
-    if love._console_name == "cafe" then
-        local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-        if logFile then
-            logFile:write("error_printer print() call completed\n")
-            logFile:flush()
-            logFile:close()
-        end
-    end
 end
 
 function love.errhand(msg)
     msg = tostring(msg)
 
-    -- PRIORITY: Immediately log the full error to file before doing ANYTHING else
-    -- Multiple fallback attempts to ensure the error gets logged somewhere
-    local logged = false
-    
-    if love._console_name == "cafe" then
-        -- Try primary log location
-        local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-        if logFile then
-            logFile:write("\n" .. string.rep("=", 80) .. "\n")
-            logFile:write("CRITICAL ERROR DETECTED AT " .. tostring(os.date()) .. "\n")
-            logFile:write(string.rep("=", 80) .. "\n")
-            logFile:write("ERROR MESSAGE:\n" .. tostring(msg) .. "\n")
-            logFile:write(string.rep("-", 40) .. "\n")
-            
-            -- Get and log the full traceback immediately
-            local trace = debug.traceback()
-            logFile:write("FULL TRACEBACK:\n" .. tostring(trace) .. "\n")
-            logFile:write(string.rep("-", 40) .. "\n")
-            
-            -- Log system state
-            logFile:write("SYSTEM STATE:\n")
-            logFile:write("- Window exists: " .. tostring(love.window ~= nil) .. "\n")
-            logFile:write("- Graphics exists: " .. tostring(love.graphics ~= nil) .. "\n")
-            logFile:write("- Event exists: " .. tostring(love.event ~= nil) .. "\n")
-            
-            if love.window then
-                logFile:write("- Window open: " .. tostring(love.window.isOpen()) .. "\n")
-            end
-            if love.graphics then
-                logFile:write("- Graphics created: " .. tostring(love.graphics.isCreated()) .. "\n")
-                logFile:write("- Graphics active: " .. tostring(love.graphics.isActive()) .. "\n")
-            end
-            
-            logFile:write(string.rep("=", 80) .. "\n\n")
-            logFile:flush()
-            logFile:close()
-            logged = true
-        end
-        
-        -- If primary logging failed, try backup location
-        if not logged then
-            local backupLog = io.open("fs:/vol/save/error_backup.log", "a") 
-            if backupLog then
-                backupLog:write("BACKUP ERROR LOG - PRIMARY FAILED\n")
-                backupLog:write("Error: " .. tostring(msg) .. "\n")
-                backupLog:write("Trace: " .. tostring(debug.traceback()) .. "\n")
-                backupLog:flush()
-                backupLog:close()
-                logged = true
-            end
-        end
-        
-        -- If file logging completely failed, at least try to print to console
-        if not logged then
-            print("CRITICAL ERROR LOGGING FAILED")
-            print("Error: " .. tostring(msg))
-            print("Trace: " .. tostring(debug.traceback()))
-        end
-    end
+    log("error", "errhand: " .. msg)
+    log("debug", string.format("errhand: window=%s, graphics=%s, event=%s", tostring(love.window ~= nil),
+        tostring(love.graphics ~= nil), tostring(love.event ~= nil)))
 
     error_printer(msg, 2)
 
-    if love._console_name == "cafe" then
-        local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-        if logFile then
-            logFile:write("error_printer() completed\n")
-            logFile:write("Checking modules: window=" .. tostring(love.window ~= nil) .. 
-                         ", graphics=" .. tostring(love.graphics ~= nil) .. 
-                         ", event=" .. tostring(love.event ~= nil) .. "\n")
-            logFile:flush()
-            logFile:close()
-        end
-    end
-
     if not love.window or not love.graphics or not love.event then
-        if love._console_name == "cafe" then
-            local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-            if logFile then
-                logFile:write("CRITICAL: Essential modules missing - cannot display error screen\n")
-                logFile:write("Window: " .. tostring(love.window ~= nil) .. "\n")
-                logFile:write("Graphics: " .. tostring(love.graphics ~= nil) .. "\n") 
-                logFile:write("Event: " .. tostring(love.event ~= nil) .. "\n")
-                logFile:write("Error handling will terminate here, but error is logged above.\n")
-                logFile:flush()
-                logFile:close()
-            end
-        end
+        log("error", "errhand: essential modules missing, cannot display error screen")
         return
     end
 
@@ -389,57 +293,21 @@ function love.errhand(msg)
     
     if success and errorScreenFunction then
         return errorScreenFunction
-    else
-        -- Graphics error display failed, log this and return
-        if love._console_name == "cafe" then
-            local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-            if logFile then
-                logFile:write("CRITICAL: Error screen creation failed\n")
-                logFile:write("Failure reason: " .. tostring(errorScreenFunction or "unknown") .. "\n")
-                logFile:write("Error handling will terminate, but full error is logged above.\n")
-                logFile:flush()
-                logFile:close()
-            end
-        end
-        return
     end
+
+    log("error", "errhand: error screen creation failed: " .. tostring(errorScreenFunction or "unknown"))
 end
 
 function love.errhand_create_error_screen(msg)
 
     if not love.graphics.isCreated() or not love.window.isOpen() then
-        if love._console_name == "cafe" then
-            local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-            if logFile then
-                logFile:write("Graphics not created or window not open, trying to set mode\n")
-                logFile:flush()
-                logFile:close()
-            end
-        end
-        
         local success, status = pcall(love.window.setMode, 800, 600)
         if not success or not status then
-            if love._console_name == "cafe" then
-                local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-                if logFile then
-                    logFile:write("EARLY RETURN: Failed to set window mode\n")
-                    logFile:flush()
-                    logFile:close()
-                end
-            end
+            log("error", "errhand: failed to set window mode")
             return
         end
     end
 
-    if love._console_name == "cafe" then
-        local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-        if logFile then
-            logFile:write("About to reset graphics and continue with error display\n")
-            logFile:flush()
-            logFile:close()
-        end
-    end
-
     -- Reset state.
     if love.mouse then
         love.mouse.setVisible(true)
@@ -462,14 +330,7 @@ function love.errhand_create_error_screen(msg)
     -- Use larger font for Wii U since it's displayed on TV and needs to be readable
     local font_size = 15
     if love._console_name == "cafe" then
-        font_size = 32  -- Much larger for TV display
-        
-        local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-        if logFile then
-            logFile:write("Using larger font size for Wii U: " .. font_size .. "\n")
-            logFile:flush()
-            logFile:close()
-        end
+        font_size = 32
     end
     
     love.graphics.setFont(love.graphics.newFont(font_size))
@@ -510,54 +371,15 @@ function love.errhand_create_error_screen(msg)
     p = p:gsub("%[string \"(.-)\"%]", "%1")
 
     local function draw()
-        if love._console_name == "cafe" then
-            local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-            if logFile then
-                logFile:write("=== ERROR SCREEN DRAW() CALLED ===\n")
-                logFile:write("Graphics active: " .. tostring(love.graphics.isActive()) .. "\n")
-                logFile:flush()
-                logFile:close()
-            end
-        end
-        
         if not love.graphics.isActive() then 
-            if love._console_name == "cafe" then
-                local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-                if logFile then
-                    logFile:write("EARLY RETURN: Graphics not active\n")
-                    logFile:flush()
-                    logFile:close()
-                end
-            end
             return 
         end
         
         local pos = 70
         
-        if love._console_name == "cafe" then
-            local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-            if logFile then
-                logFile:write("About to draw blue error screen\n")
-                logFile:write("Error text length: " .. string.len(p) .. "\n")
-                logFile:write("Error text preview: " .. string.sub(p, 1, 100) .. "\n")
-                logFile:write("Screen dimensions: " .. love.graphics.getWidth() .. "x" .. love.graphics.getHeight() .. "\n")
-                logFile:flush()
-                logFile:close()
-            end
-        end
-        
         love.graphics.clear(89 / 255, 157 / 255, 220 / 255)
         love.graphics.printf(p, pos, pos, love.graphics.getWidth() - pos)
         love.graphics.present()
-        
-        if love._console_name == "cafe" then
-            local logFile = io.open("fs:/vol/external01/simple_debug.log", "a")
-            if logFile then
-                logFile:write("Blue error screen draw completed\n")
-                logFile:flush()
-                logFile:close()
-            end
-        end
     end
 
     local fullErrorText = p
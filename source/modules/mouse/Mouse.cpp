@@ -2,7 +2,7 @@
 
 namespace love
 {
-    Mouse::Mouse() : MouseBase()
+    Mouse::Mouse() : Module(M_MOUSE, "love.mouse")
     {}
 
     void Mouse::getPosition(double& x, double& y) const
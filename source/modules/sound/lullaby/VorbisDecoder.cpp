@@ -82,18 +82,23 @@ namespace love
 
         long read = 0;
 
-#if defined(__WIIU__)
+#if !defined(__3DS__) && !defined(__SWITCH__)
         int word = (this->getBitDepth() == 16 ? 2 : 1);
+    #if defined(LOVE_BIG_ENDIAN)
+        const int bigEndian = 1;
+    #else
+        const int bigEndian = 0;
+    #endif
 #endif
 
         while (size < this->bufferSize)
         {
             int length = this->bufferSize - size;
 
-#if !defined(__WIIU__)
+#if defined(__3DS__) || defined(__SWITCH__)
             read = ov_read(&this->handle, (char*)this->buffer + size, length, &section);
 #else
-            read = ov_read(&this->handle, (char*)this->buffer + size, length, 1, word, 1, &section);
+            read = ov_read(&this->handle, (char*)this->buffer + size, length, bigEndian, word, 1, &section);
 #endif
 
             if (read == OV_HOLE)
@@ -0,0 +1,154 @@
+#include "modules/sound/wrap_Sound.hpp"
+
+#include "common/Logger.hpp"
+
+#include "modules/data/DataStream.hpp"
+#include "modules/filesystem/wrap_Filesystem.hpp"
+
+#include "modules/sound/wrap_Decoder.hpp"
+#include "modules/sound/wrap_SoundData.hpp"
+
+using namespace love;
+
+#define instance() (Module::getInstance<Sound>(Module::M_SOUND))
+
+int Wrap_Sound::newDecoder(lua_State* L)
+{
+    if (LOVE_LOG_ENABLED(DEBUG, AUDIO))
+    {
+        LOVE_LOG_DEBUG(AUDIO, "newDecoder() called with %d arguments", lua_gettop(L));
+
+        for (int index = 1; index <= lua_gettop(L); index++)
+            LOVE_LOG_DEBUG(AUDIO, "  argument %d: %s", index, luaL_typename(L, index));
+    }
+
+    int bufferSize = luaL_optinteger(L, 2, Decoder::DEFAULT_BUFFER_SIZE);
+    Stream* stream = nullptr;
+
+    LOVE_LOG_DEBUG(AUDIO, "newDecoder() - bufferSize: %d, checking if can get file", bufferSize);
+
+    if (luax_cangetfile(L, 1))
+    {
+        LOVE_LOG_DEBUG(AUDIO, "newDecoder() - can get file, processing file input");
+        Decoder::StreamSource source = Decoder::STREAM_FILE;
+        const char* sourceType       = lua_isnoneornil(L, 3) ? nullptr : luaL_checkstring(L, 3);
+
+        if (sourceType != nullptr && !Decoder::getConstant(sourceType, source))
+            return luax_enumerror(L, "stream type", Decoder::StreamSources, sourceType);
+
+        if (source == Decoder::STREAM_FILE)
+        {
+            LOVE_LOG_DEBUG(AUDIO, "newDecoder() - about to get file and open for reading");
+            auto* file = luax_getfile(L, 1);
+            luax_catchexcept(L, [&]() { file->open(File::MODE_READ); });
+            stream = file;
+            LOVE_LOG_DEBUG(AUDIO, "newDecoder() - file opened successfully, stream: %p", stream);
+        }
+        else
+        {
+            LOVE_LOG_DEBUG(AUDIO, "newDecoder() - creating DataStream from file data");
+            luax_catchexcept(L, [&]() {
+                StrongRef<FileData> data(luax_getfiledata(L, 1), Acquire::NO_RETAIN);
+                stream = new DataStream(data);
+            });
+        }
+    }
+    else if (luax_istype(L, 1, Data::type))
+    {
+        LOVE_LOG_DEBUG(AUDIO, "newDecoder() - processing Data type input");
+        Data* data = luax_checktype<Data>(L, 1);
+        luax_catchexcept(L, [&]() { stream = new DataStream(data); });
+    }
+    else
+    {
+        LOVE_LOG_DEBUG(AUDIO, "newDecoder() - processing Stream type input");
+        stream = luax_checktype<Stream>(L, 1);
+        stream->retain();
+    }
+
+    Decoder* decoder = nullptr;
+
+    LOVE_LOG_DEBUG(AUDIO, "newDecoder() - about to create decoder with stream: %p, bufferSize: %d", stream, bufferSize);
+
+    // clang-format off
+    luax_catchexcept(L, [&]() {
+        decoder = instance()->newDecoder(stream, bufferSize); },
+        [&](bool) { stream->release(); }
+    );
+    // clang-format on
+
+    LOVE_LOG_DEBUG(AUDIO, "newDecoder() - decoder created: %p", decoder);
+
+    luax_pushtype(L, decoder);
+    decoder->release();
+
+    LOVE_LOG_DEBUG(AUDIO, "newDecoder() - completed successfully");
+
+    return 1;
+}
+
+int Wrap_Sound::newSoundData(lua_State* L)
+{
+    SoundData* soundData = nullptr;
+
+    if (lua_isnumber(L, 1))
+    {
+        int samples    = luaL_checkinteger(L, 1);
+        int sampleRate = luaL_optinteger(L, 2, Decoder::DEFAULT_SAMPLE_RATE);
+        int bitDepth   = luaL_optinteger(L, 3, Decoder::DEFAULT_BIT_DEPTH);
+        int channels   = luaL_optinteger(L, 4, Decoder::DEFAULT_CHANNELS);
+
+        luax_catchexcept(L, [&]() {
+            soundData = instance()->newSoundData(samples, sampleRate, bitDepth, channels);
+        });
+    }
+    else
+    {
+        if (!luax_istype(L, 1, Decoder::type))
+        {
+            Wrap_Sound::newDecoder(L);
+            lua_replace(L, 1);
+        }
+
+        auto* decoder = luax_checkdecoder(L, 1);
+        luax_catchexcept(L, [&]() { soundData = instance()->newSoundData(decoder); });
+    }
+
+    luax_pushtype(L, soundData);
+    soundData->release();
+
+    return 1;
+}
+
+// clang-format off
+static constexpr luaL_Reg functions[] =
+{
+    { "newDecoder",   Wrap_Sound::newDecoder   },
+    { "newSoundData", Wrap_Sound::newSoundData }
+};
+
+static constexpr lua_CFunction types[] =
+{
+    open_sounddata,
+    open_decoder
+};
+// clang-format on
+
+int Wrap_Sound::open(lua_State* L)
+{
+    Sound* instance = instance();
+
+    if (instance == nullptr)
+        luax_catchexcept(L, [&]() { instance = new Sound(); });
+    else
+        instance->retain();
+
+    WrappedModule module {};
+    module.instance  = instance;
+    module.name      = "sound";
+    module.type      = &Module::type;
+    module.functions = functions;
+    module.types     = types;
+
+    return luax_register_module(L, module);
+}
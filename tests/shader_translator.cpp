@@ -0,0 +1,206 @@
+/*
+** ShaderTranslator against the std::regex chain it replaced in ShaderCompiler.
+** Plain shaders must translate exactly as before, the cases where the regex
+** output was wrong are checked for the intended result instead.
+*/
+
+#include "ShaderTranslator.hpp"
+
+#include <cstdio>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    int failures = 0;
+
+#define CHECK(condition)                                                               \
+    do                                                                                 \
+    {                                                                                  \
+        if (!(condition))                                                              \
+        {                                                                              \
+            std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                                \
+        }                                                                              \
+    } while (false)
+
+    /* the chain ShaderCompiler ran before ShaderTranslator */
+    std::string processShaderDefines(const std::string& source)
+    {
+        std::string result = source;
+
+        result = std::regex_replace(result, std::regex("#ifdef LOVE_SHADER_VERTEX[\\s\\S]*?#endif"), "");
+        result = std::regex_replace(result, std::regex("#ifdef LOVE_SHADER_PIXEL[\\s\\S]*?#endif"), "");
+
+        return result;
+    }
+
+    std::string referenceVertex(const std::string& source)
+    {
+        std::string result = processShaderDefines(source);
+        result             = std::regex_replace(result, std::regex("attribute"), "in");
+        return std::regex_replace(result, std::regex("varying"), "out");
+    }
+
+    std::string referencePixel(const std::string& source)
+    {
+        std::string result = processShaderDefines(source);
+        result             = std::regex_replace(result, std::regex("varying"), "in");
+
+        if (result.find("main") != std::string::npos)
+        {
+            result = std::regex_replace(result, std::regex("gl_FragColor"), "love_Pixelcolor");
+            result = std::regex_replace(result, std::regex("texture2D"), "texture");
+        }
+
+        return result;
+    }
+
+    bool contains(const std::string& haystack, const std::string& needle)
+    {
+        return haystack.find(needle) != std::string::npos;
+    }
+
+    const std::string VERTEX_DEFINE = "#define LOVE_SHADER_VERTEX\n";
+    const std::string PIXEL_DEFINE  = "#define LOVE_SHADER_PIXEL\n";
+
+    const char* PLAIN_VERTEX = R"(attribute vec4 VertexPosition;
+attribute vec2 VertexTexCoord;
+varying vec2 uv;
+uniform mat4 transform;
+
+void main()
+{
+    uv = VertexTexCoord;
+    gl_Position = transform * VertexPosition;
+}
+)";
+
+    const char* PLAIN_PIXEL = R"(varying vec2 uv;
+uniform sampler2D tex;
+uniform vec4 tint;
+
+void main()
+{
+    gl_FragColor = texture2D(tex, uv) * tint;
+}
+)";
+
+    const char* STAGE_BLOCKS = R"(varying vec4 color;
+#ifdef LOVE_SHADER_VERTEX
+attribute vec4 position;
+void main() { color = vec4(1.0); gl_Position = position; }
+#endif
+#ifdef LOVE_SHADER_PIXEL
+void main() { gl_FragColor = color; }
+#endif
+)";
+
+    void testPlainShadersMatchReference()
+    {
+        auto vertex = ShaderTranslator::translate(PLAIN_VERTEX, ShaderTranslator::STAGE_VERTEX);
+        CHECK(vertex.source == VERTEX_DEFINE + referenceVertex(PLAIN_VERTEX));
+        CHECK(vertex.hasMain);
+
+        auto pixel = ShaderTranslator::translate(PLAIN_PIXEL, ShaderTranslator::STAGE_PIXEL);
+        CHECK(pixel.source == PIXEL_DEFINE + referencePixel(PLAIN_PIXEL));
+        CHECK(pixel.hasMain);
+    }
+
+    void testStageDefineInjection()
+    {
+        auto vertex = ShaderTranslator::translate(STAGE_BLOCKS, ShaderTranslator::STAGE_VERTEX);
+        auto pixel  = ShaderTranslator::translate(STAGE_BLOCKS, ShaderTranslator::STAGE_PIXEL);
+
+        /* each stage defines its own macro first and keeps both blocks for the preprocessor */
+        CHECK(vertex.source.starts_with(VERTEX_DEFINE));
+        CHECK(pixel.source.starts_with(PIXEL_DEFINE));
+
+        CHECK(contains(vertex.source, "#ifdef LOVE_SHADER_VERTEX\nin vec4 position;"));
+        CHECK(contains(vertex.source, "#ifdef LOVE_SHADER_PIXEL\n"));
+        CHECK(contains(pixel.source, "#ifdef LOVE_SHADER_PIXEL\nvoid main() { love_Pixelcolor = color; }"));
+
+        /* intentional difference: the regex chain dropped both blocks, whatever the stage */
+        CHECK(!contains(referenceVertex(STAGE_BLOCKS), "gl_Position"));
+        CHECK(contains(vertex.source, "gl_Position = position;"));
+    }
+
+    void testWholeIdentifiersOnly()
+    {
+        const std::string source = "varying vec4 myvaryingColor;\n"
+                                   "void main() { myvaryingColor = vec4(0.0); }\n";
+
+        auto result = ShaderTranslator::translate(source, ShaderTranslator::STAGE_VERTEX);
+
+        /* intentional difference: the regex rewrote identifiers that merely contain a keyword */
+        CHECK(contains(referenceVertex(source), "myoutColor"));
+        CHECK(contains(result.source, "out vec4 myvaryingColor;"));
+        CHECK(!contains(result.source, "myoutColor"));
+    }
+
+    void testCommentsUntouched()
+    {
+        const std::string source = "// varying and attribute are rewritten\n"
+                                   "/* texture2D */\n"
+                                   "void main() {}\n";
+
+        auto vertex = ShaderTranslator::translate(source, ShaderTranslator::STAGE_VERTEX);
+        auto pixel  = ShaderTranslator::translate(source, ShaderTranslator::STAGE_PIXEL);
+
+        CHECK(vertex.source == VERTEX_DEFINE + source);
+        CHECK(pixel.source == PIXEL_DEFINE + source);
+    }
+
+    void testPixelWithoutMain()
+    {
+        const std::string source = "vec4 effect(vec4 c, sampler2D t, vec2 uv)\n"
+                                   "{ return texture2D(t, uv) * c; }\n";
+
+        auto result = ShaderTranslator::translate(source, ShaderTranslator::STAGE_PIXEL);
+
+        /* intentional difference: the regex only rewrote pixel shaders that defined main */
+        CHECK(contains(referencePixel(source), "texture2D"));
+        CHECK(contains(result.source, "return texture(t, uv) * c;"));
+        CHECK(!result.hasMain);
+    }
+
+    void testUniformNames()
+    {
+        const std::string source = "uniform float a, b[2];\n"
+                                   "uniform vec4 c = vec4(1.0);\n"
+                                   "uniform Block { vec4 d; };\n"
+                                   "uniform sampler2D e;\n";
+
+        auto result = ShaderTranslator::translate(source, ShaderTranslator::STAGE_PIXEL);
+
+        const std::vector<std::string> expected = { "a", "b", "c", "e" };
+        CHECK(result.uniforms == expected);
+    }
+
+    void testNumbersAreNotIdentifiers()
+    {
+        const std::string source = "float x = 1e5 + 2.5e-3 + 0x1F;\n";
+
+        auto result = ShaderTranslator::translate(source, ShaderTranslator::STAGE_VERTEX);
+        CHECK(result.source == VERTEX_DEFINE + source);
+    }
+} // namespace
+
+int main()
+{
+    testPlainShadersMatchReference();
+    testStageDefineInjection();
+    testWholeIdentifiersOnly();
+    testCommentsUntouched();
+    testPixelWithoutMain();
+    testUniformNames();
+    testNumbersAreNotIdentifiers();
+
+    if (failures > 0)
+        std::printf("%d check(s) failed\n", failures);
+
+    return failures > 0 ? 1 : 0;
+}